@@ -272,7 +272,12 @@ class XMLHttpRequest extends EventTarget {
         break;
 
       case 'arraybuffer':
-        this._cachedResponse = base64.toByteArray(this._response).buffer;
+        // Some networking modules deliver 'base64' responses as ArrayBuffers
+        // directly, without encoding the body.
+        this._cachedResponse =
+          this._response instanceof ArrayBuffer
+            ? this._response
+            : base64.toByteArray(this._response).buffer;
         break;
 
       case 'blob':
@@ -140,6 +140,30 @@ describe('XMLHttpRequest', function () {
     expect(xhr.responseText).toBe('Some data');
   });
 
+  it('should expose arraybuffer responses correctly', function () {
+    xhr.responseType = 'arraybuffer';
+    xhr.open('GET', 'blabla');
+    xhr.send();
+    setRequestId(13);
+    xhr.__didReceiveData(requestId, 'AQID');
+    // $FlowFixMe[incompatible-type]
+    xhr.__didCompleteResponse(requestId, null);
+    expect(Array.from(new Uint8Array(xhr.response))).toEqual([1, 2, 3]);
+  });
+
+  it('should use ArrayBuffer responses as is', function () {
+    const buffer = new Uint8Array([1, 2, 3]).buffer;
+    xhr.responseType = 'arraybuffer';
+    xhr.open('GET', 'blabla');
+    xhr.send();
+    setRequestId(14);
+    // $FlowFixMe[incompatible-type]
+    xhr.__didReceiveData(requestId, buffer);
+    // $FlowFixMe[incompatible-type]
+    xhr.__didCompleteResponse(requestId, null);
+    expect(xhr.response).toBe(buffer);
+  });
+
   it('should call ontimeout function when the request times out', function () {
     xhr.open('GET', 'blabla');
     xhr.send();
@@ -30,6 +30,7 @@
 #import <react/featureflags/ReactNativeFeatureFlags.h>
 #import <react/renderer/componentregistry/ComponentDescriptorFactory.h>
 #import <react/renderer/components/text/BaseTextProps.h>
+#import <react/renderer/core/PropsInterningCache.h>
 #import <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #import <react/renderer/scheduler/SchedulerToolbox.h>
 #import <react/utils/ContextContainer.h>
@@ -115,6 +116,11 @@ class ReactRevisionMergeRunLoopObserverDelegate final : public RunLoopObserver::
                                              selector:@selector(_applicationWillTerminate)
                                                  name:UIApplicationWillTerminateNotification
                                                object:nil];
+
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(_applicationDidReceiveMemoryWarning)
+                                                 name:UIApplicationDidReceiveMemoryWarningNotification
+                                               object:nil];
   }
 
   return self;
@@ -330,6 +336,21 @@ class ReactRevisionMergeRunLoopObserverDelegate final : public RunLoopObserver::
   [self suspend];
 }
 
+- (void)_applicationDidReceiveMemoryWarning
+{
+  std::shared_ptr<PropsInterningCache> propsInterningCache;
+  {
+    std::lock_guard<std::mutex> lock(_schedulerLifeCycleMutex);
+    propsInterningCache =
+        _contextContainer->find<std::shared_ptr<PropsInterningCache>>(kPropsInterningCacheKey).value_or(nullptr);
+  }
+
+  // Interned props are only kept alive for reuse, dropping them is safe.
+  if (propsInterningCache) {
+    propsInterningCache->clear();
+  }
+}
+
 #pragma mark - RCTSchedulerDelegate
 
 - (void)schedulerDidFinishTransaction:(std::shared_ptr<const MountingCoordinator>)mountingCoordinator
@@ -17,6 +17,7 @@
 #include <concepts>
 #include <cstdint>
 #include <ranges>
+#include <string>
 
 namespace facebook::react::jsinspector_modern {
 
@@ -59,10 +60,14 @@ void emitNotificationsForTracingProfile(
   // Serialize each chunk once and send it to all eligible sessions.
   tracing::HostTracingProfileSerializer::emitAsDataCollectedChunks(
       std::move(hostTracingProfile),
-      [&](folly::dynamic &&serializedChunk) {
+      [&](std::string &&serializedChunk) {
+        // The chunk is already serialized, wrap it in the params object in
+        // place instead of parsing it back into a folly::dynamic.
+        serializedChunk.insert(0, R"({"value":)");
+        serializedChunk.push_back('}');
+        auto notification = cdp::jsonNotificationWithSerializedParams("Tracing.dataCollected", serializedChunk);
         for (auto &frontendChannel : channels) {
-          frontendChannel(
-              cdp::jsonNotification("Tracing.dataCollected", folly::dynamic::object("value", serializedChunk)));
+          frontendChannel(notification);
         }
       },
       TRACE_EVENT_CHUNK_MAX_BYTES,
@@ -58,6 +58,20 @@ std::string jsonNotification(
   return folly::toJson(std::move(dynamicNotification));
 }
 
+std::string jsonNotificationWithSerializedParams(
+    const std::string& method,
+    std::string_view serializedParams) {
+  auto serializedMethod = folly::toJson(method);
+  std::string notification;
+  notification.reserve(serializedMethod.size() + serializedParams.size() + 24);
+  notification.append(R"({"method":)");
+  notification.append(serializedMethod);
+  notification.append(R"(,"params":)");
+  notification.append(serializedParams);
+  notification.push_back('}');
+  return notification;
+}
+
 std::string jsonRequest(
     RequestId id,
     const std::string& method,
@@ -115,6 +115,18 @@ std::string jsonResult(RequestId id, const folly::dynamic &result = folly::dynam
  */
 std::string jsonNotification(const std::string &method, std::optional<folly::dynamic> params = std::nullopt);
 
+/**
+ * Returns a JSON-formatted string representing a unilateral notification
+ * whose payload has already been serialized, avoiding a round trip through
+ * folly::dynamic for large payloads.
+ *
+ * {"method": <method>, "params": <serializedParams>}
+ *
+ * \param method Notification (aka "event") method.
+ * \param serializedParams JSON-encoded payload object, inserted as-is.
+ */
+std::string jsonNotificationWithSerializedParams(const std::string &method, std::string_view serializedParams);
+
 /**
  * Returns a JSON-formatted string representing a request.
  *
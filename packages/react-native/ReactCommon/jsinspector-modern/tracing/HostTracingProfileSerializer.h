@@ -10,8 +10,10 @@
 #include "FrameTimingSequence.h"
 #include "HostTracingProfile.h"
 #include "TraceEvent.h"
+#include "TraceEventChunkWriter.h"
 
-#include <folly/dynamic.h>
+#include <functional>
+#include <string>
 #include <vector>
 
 namespace facebook::react::jsinspector_modern::tracing {
@@ -26,25 +28,24 @@ class HostTracingProfileSerializer {
    * Transforms the profile into a sequence of serialized Trace Events, which
    * is split in chunks of at most \p maxChunkBytes serialized bytes or
    * \p profileTraceEventsChunkSize events, depending on type, and sent with
-   * \p chunkCallback.
+   * \p chunkCallback. Each chunk is a serialized JSON array.
    */
   static void emitAsDataCollectedChunks(
       HostTracingProfile &&hostTracingProfile,
-      const std::function<void(folly::dynamic &&chunk)> &chunkCallback,
+      const std::function<void(std::string &&serializedChunk)> &chunkCallback,
       size_t maxChunkBytes,
       uint16_t profileTraceEventsChunkSize);
 
-  static void emitPerformanceTraceEvents(
-      std::vector<TraceEvent> &&events,
-      const std::function<void(folly::dynamic &&chunk)> &chunkCallback,
-      size_t maxChunkBytes);
+  static void emitPerformanceTraceEvents(std::vector<TraceEvent> &&events, TraceEventChunkWriter &writer);
 
+  /**
+   * The events of a frame are always written to the same chunk.
+   */
   static void emitFrameTimings(
       std::vector<FrameTimingSequence> &&frameTimings,
       ProcessId processId,
       HighResTimeStamp recordingStartTimestamp,
-      const std::function<void(folly::dynamic &&chunk)> &chunkCallback,
-      size_t maxChunkBytes);
+      TraceEventChunkWriter &writer);
 };
 
 } // namespace facebook::react::jsinspector_modern::tracing
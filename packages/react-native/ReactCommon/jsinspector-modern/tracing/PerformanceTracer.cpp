@@ -15,10 +15,16 @@
 #include <jsinspector-modern/network/HttpUtils.h>
 #include <oscompat/OSCompat.h>
 #include <react/timing/primitives.h>
+#include <react/utils/overloaded.h>
 
 #include <folly/json.h>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
 #include <mutex>
+#include <thread>
 
 using namespace facebook::react;
 
@@ -68,8 +74,6 @@ bool PerformanceTracer::startTracingImpl(
       return false;
     }
 
-    tracingAtomic_ = true;
-
     if (maxDuration && *maxDuration < MIN_VALUE_FOR_MAX_TRACE_DURATION_OPTION) {
       throw std::invalid_argument("maxDuration should be at least 1 second");
     }
@@ -77,6 +81,9 @@ bool PerformanceTracer::startTracingImpl(
     currentTraceStartTime_ = HighResTimeStamp::now();
     currentTraceMaxDuration_ = maxDuration;
 
+    // Publishes the fields above to the threads reporting events.
+    tracingAtomic_ = true;
+
     for (const auto& [id, callback] : tracingStateCallbacks_) {
       callbacksToNotify.push_back(callback);
     }
@@ -94,6 +101,7 @@ std::optional<std::vector<TraceEvent>> PerformanceTracer::stopTracing() {
   std::vector<TracingStateCallback> callbacksToNotify;
 
   auto currentTraceEndTime = HighResTimeStamp::now();
+  HighResTimeStamp currentTraceStartTime;
 
   {
     std::lock_guard lock(mutex_);
@@ -122,12 +130,14 @@ std::optional<std::vector<TraceEvent>> PerformanceTracer::stopTracing() {
 
     alreadyEmittedEntryForComponentsTrackOrdering_ = false;
     events = collectEventsAndClearBuffers(currentTraceEndTime);
-  }
 
-  auto currentTraceStartTime = currentTraceStartTime_;
-  if (currentTraceMaxDuration_ &&
-      currentTraceEndTime - *currentTraceMaxDuration_ > currentTraceStartTime) {
-    currentTraceStartTime = currentTraceEndTime - *currentTraceMaxDuration_;
+    currentTraceStartTime = currentTraceStartTime_;
+    if (currentTraceMaxDuration_ &&
+        currentTraceEndTime - *currentTraceMaxDuration_ >
+            currentTraceStartTime) {
+      currentTraceStartTime = currentTraceEndTime - *currentTraceMaxDuration_;
+    }
+    currentTraceMaxDuration_ = std::nullopt;
   }
 
   // This is synthetic Trace Event, which should not be represented on a
@@ -158,8 +168,6 @@ std::optional<std::vector<TraceEvent>> PerformanceTracer::stopTracing() {
           .tid = getCurrentThreadId(),
       });
 
-  currentTraceMaxDuration_ = std::nullopt;
-
   return events;
 }
 
@@ -171,18 +179,15 @@ void PerformanceTracer::reportMark(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracingAtomic_) {
-    return;
-  }
-
-  enqueueEvent(
-      PerformanceTracerEventMark{
-          .name = name,
-          .start = start,
-          .detail = std::move(detail),
-          .threadId = getCurrentThreadId(),
-      });
+  enqueueEvent([&](EventBuffer& buffer, HighResTimeStamp createdAt) {
+    return PerformanceTracerEventMark{
+        .name = buffer.intern(name),
+        .start = start,
+        .detail = buffer.store(std::move(detail)),
+        .threadId = getCurrentThreadId(),
+        .createdAt = createdAt,
+    };
+  });
 }
 
 void PerformanceTracer::reportMeasure(
@@ -195,20 +200,17 @@ void PerformanceTracer::reportMeasure(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracingAtomic_) {
-    return;
-  }
-
-  enqueueEvent(
-      PerformanceTracerEventMeasure{
-          .name = name,
-          .start = start,
-          .duration = duration,
-          .detail = std::move(detail),
-          .threadId = getCurrentThreadId(),
-          .stackTrace = std::move(stackTrace),
-      });
+  enqueueEvent([&](EventBuffer& buffer, HighResTimeStamp createdAt) {
+    return PerformanceTracerEventMeasure{
+        .name = buffer.intern(name),
+        .start = start,
+        .duration = duration,
+        .detail = buffer.store(std::move(detail)),
+        .threadId = getCurrentThreadId(),
+        .stackTrace = buffer.store(std::move(stackTrace)),
+        .createdAt = createdAt,
+    };
+  });
 }
 
 void PerformanceTracer::reportTimeStamp(
@@ -224,23 +226,38 @@ void PerformanceTracer::reportTimeStamp(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracingAtomic_) {
-    return;
-  }
-
-  enqueueEvent(
-      PerformanceTracerEventTimeStamp{
-          .name = name,
-          .start = std::move(start),
-          .end = std::move(end),
-          .trackName = std::move(trackName),
-          .trackGroup = std::move(trackGroup),
-          .color = std::move(color),
-          .detail = std::move(detail),
-          .stackTrace = std::move(stackTrace),
-          .threadId = getCurrentThreadId(),
-      });
+  enqueueEvent([&](EventBuffer& buffer, HighResTimeStamp createdAt) {
+    auto internEntry = [&](const std::optional<ConsoleTimeStampEntry>& entry)
+        -> std::optional<TimeStampEntry> {
+      if (!entry) {
+        return std::nullopt;
+      }
+      if (std::holds_alternative<HighResTimeStamp>(*entry)) {
+        return std::get<HighResTimeStamp>(*entry);
+      }
+      return buffer.intern(std::get<std::string>(*entry));
+    };
+    auto internOptional = [&](const std::optional<std::string>& string)
+        -> std::optional<StringId> {
+      if (!string) {
+        return std::nullopt;
+      }
+      return buffer.intern(*string);
+    };
+
+    return PerformanceTracerEventTimeStamp{
+        .name = buffer.intern(name),
+        .start = internEntry(start),
+        .end = internEntry(end),
+        .trackName = internOptional(trackName),
+        .trackGroup = internOptional(trackGroup),
+        .color = color,
+        .detail = buffer.store(std::move(detail)),
+        .stackTrace = buffer.store(std::move(stackTrace)),
+        .threadId = getCurrentThreadId(),
+        .createdAt = createdAt,
+    };
+  });
 }
 
 void PerformanceTracer::reportEventLoopTask(
@@ -250,17 +267,14 @@ void PerformanceTracer::reportEventLoopTask(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracingAtomic_) {
-    return;
-  }
-
-  enqueueEvent(
-      PerformanceTracerEventEventLoopTask{
-          .start = start,
-          .end = end,
-          .threadId = getCurrentThreadId(),
-      });
+  enqueueEvent([&](EventBuffer& /*buffer*/, HighResTimeStamp createdAt) {
+    return PerformanceTracerEventEventLoopTask{
+        .start = start,
+        .end = end,
+        .threadId = getCurrentThreadId(),
+        .createdAt = createdAt,
+    };
+  });
 }
 
 void PerformanceTracer::reportEventLoopMicrotasks(
@@ -270,17 +284,14 @@ void PerformanceTracer::reportEventLoopMicrotasks(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracingAtomic_) {
-    return;
-  }
-
-  enqueueEvent(
-      PerformanceTracerEventEventLoopMicrotask{
-          .start = start,
-          .end = end,
-          .threadId = getCurrentThreadId(),
-      });
+  enqueueEvent([&](EventBuffer& /*buffer*/, HighResTimeStamp createdAt) {
+    return PerformanceTracerEventEventLoopMicrotask{
+        .start = start,
+        .end = end,
+        .threadId = getCurrentThreadId(),
+        .createdAt = createdAt,
+    };
+  });
 }
 
 void PerformanceTracer::reportResourceSendRequest(
@@ -293,23 +304,20 @@ void PerformanceTracer::reportResourceSendRequest(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracingAtomic_) {
-    return;
-  }
-
   auto resourceType =
       jsinspector_modern::cdp::network::resourceTypeFromMimeType(
           jsinspector_modern::mimeTypeFromHeaders(headers));
-  enqueueEvent(
-      PerformanceTracerResourceSendRequest{
-          .requestId = devtoolsRequestId,
-          .url = url,
-          .start = start,
-          .requestMethod = requestMethod,
-          .resourceType = resourceType,
-          .threadId = getCurrentThreadId(),
-      });
+  enqueueEvent([&](EventBuffer& buffer, HighResTimeStamp createdAt) {
+    return PerformanceTracerResourceSendRequest{
+        .requestId = buffer.intern(devtoolsRequestId),
+        .url = buffer.intern(url),
+        .start = start,
+        .requestMethod = buffer.intern(requestMethod),
+        .resourceType = buffer.intern(resourceType),
+        .threadId = getCurrentThreadId(),
+        .createdAt = createdAt,
+    };
+  });
 }
 
 void PerformanceTracer::reportResourceReceivedData(
@@ -320,17 +328,15 @@ void PerformanceTracer::reportResourceReceivedData(
     return;
   };
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracingAtomic_) {
-    return;
-  }
-
-  enqueueEvent(
-      PerformanceTracerResourceReceivedData{
-          .requestId = devtoolsRequestId,
-          .start = start,
-          .encodedDataLength = encodedDataLength,
-          .threadId = getCurrentThreadId()});
+  enqueueEvent([&](EventBuffer& buffer, HighResTimeStamp createdAt) {
+    return PerformanceTracerResourceReceivedData{
+        .requestId = buffer.intern(devtoolsRequestId),
+        .start = start,
+        .encodedDataLength = encodedDataLength,
+        .threadId = getCurrentThreadId(),
+        .createdAt = createdAt,
+    };
+  });
 }
 
 void PerformanceTracer::reportResourceReceiveResponse(
@@ -344,23 +350,26 @@ void PerformanceTracer::reportResourceReceiveResponse(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracingAtomic_) {
-    return;
+  folly::dynamic headersEntries = folly::dynamic::array;
+  for (const auto& [key, value] : headers) {
+    headersEntries.push_back(
+        folly::dynamic::object("name", key)("value", value));
   }
-
-  enqueueEvent(
-      PerformanceTracerResourceReceiveResponse{
-          .requestId = devtoolsRequestId,
-          .start = start,
-          .encodedDataLength = encodedDataLength,
-          .headers = headers,
-          .mimeType = jsinspector_modern::mimeTypeFromHeaders(headers),
-          .protocol = "h2",
-          .statusCode = statusCode,
-          .timing = std::move(timingData),
-          .threadId = getCurrentThreadId(),
-      });
+  auto mimeType = jsinspector_modern::mimeTypeFromHeaders(headers);
+  enqueueEvent([&](EventBuffer& buffer, HighResTimeStamp createdAt) {
+    return PerformanceTracerResourceReceiveResponse{
+        .requestId = buffer.intern(devtoolsRequestId),
+        .start = start,
+        .encodedDataLength = encodedDataLength,
+        .headers = buffer.store(std::move(headersEntries)),
+        .mimeType = buffer.intern(mimeType),
+        .protocol = buffer.intern("h2"),
+        .statusCode = statusCode,
+        .timing = buffer.store(std::move(timingData)),
+        .threadId = getCurrentThreadId(),
+        .createdAt = createdAt,
+    };
+  });
 }
 
 void PerformanceTracer::reportResourceFinish(
@@ -372,19 +381,16 @@ void PerformanceTracer::reportResourceFinish(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracingAtomic_) {
-    return;
-  }
-
-  enqueueEvent(
-      PerformanceTracerResourceFinish{
-          .requestId = devtoolsRequestId,
-          .start = start,
-          .encodedDataLength = encodedDataLength,
-          .decodedBodyLength = decodedBodyLength,
-          .threadId = getCurrentThreadId(),
-      });
+  enqueueEvent([&](EventBuffer& buffer, HighResTimeStamp createdAt) {
+    return PerformanceTracerResourceFinish{
+        .requestId = buffer.intern(devtoolsRequestId),
+        .start = start,
+        .encodedDataLength = encodedDataLength,
+        .decodedBodyLength = decodedBodyLength,
+        .threadId = getCurrentThreadId(),
+        .createdAt = createdAt,
+    };
+  });
 }
 
 /* static */ TraceEvent PerformanceTracer::constructRuntimeProfileTraceEvent(
@@ -435,10 +441,17 @@ PerformanceTracer::constructRuntimeProfileChunkTraceEvent(
 #pragma mark - Tracing window methods
 
 /**
- * If a `maxDuration` value is set when starting a trace, we use 2 buffers
- * for events. Each buffer can contain entries for a range up to `maxDuration`.
- * When the current buffer is full, we clear the previous one and we start
- * collecting events in a new buffer, which becomes current.
+ * Every thread reports events to a buffer of its own, so that threads never
+ * contend with each other. Only the owning thread writes to a buffer while
+ * tracing, and buffers are only read once tracing has stopped, after the
+ * owning thread has finished writing an event it may have been reporting at
+ * that moment. Events are tagged with a global sequence number, which is used
+ * to merge the buffers in the order the events were reported.
+ *
+ * If a `maxDuration` value is set when starting a trace, each thread uses 2
+ * buffers for events. Each buffer can contain entries for a range up to
+ * `maxDuration`. When the current buffer is full, we clear the previous one
+ * and we start collecting events in a new buffer, which becomes current.
  *
  * Example:
  *   - Start:
@@ -459,46 +472,92 @@ PerformanceTracer::constructRuntimeProfileChunkTraceEvent(
  * clearing expired events is trivial (just clearing a vector).
  */
 
+PerformanceTracer::ThreadBuffer& PerformanceTracer::getThreadBuffer() {
+  // The tracer is a singleton, so every thread needs a single buffer. The
+  // tracer keeps it alive after the thread exits, until it is collected.
+  static thread_local const std::shared_ptr<ThreadBuffer> threadBuffer = [&] {
+    auto buffer = std::make_shared<ThreadBuffer>();
+    std::lock_guard lock(threadBuffersMutex_);
+    threadBuffers_.push_back(buffer);
+    return buffer;
+  }();
+  return *threadBuffer;
+}
+
 std::vector<TraceEvent> PerformanceTracer::collectEventsAndClearBuffers(
     HighResTimeStamp currentTraceEndTime) {
+  std::vector<SequencedEvent> sequencedEvents;
   std::vector<TraceEvent> events;
 
-  if (currentTraceMaxDuration_) {
+  std::lock_guard lock(threadBuffersMutex_);
+  for (const auto& threadBuffer : threadBuffers_) {
+    // Tracing has stopped, so the thread either sees it and doesn't write,
+    // or is writing an event that belongs to this trace.
+    while (threadBuffer->isWriting) {
+      std::this_thread::yield();
+    }
+
+    auto threadEventsStart = sequencedEvents.size();
     // Collect non-expired entries from the previous buffer
-    if (previousBuffer_ != nullptr) {
-      collectEventsAndClearBuffer(
-          events, *previousBuffer_, currentTraceEndTime);
+    if (threadBuffer->previousBuffer != nullptr) {
+      collectEventsFromBuffer(
+          sequencedEvents, *threadBuffer->previousBuffer, currentTraceEndTime);
     }
+    collectEventsFromBuffer(
+        sequencedEvents, *threadBuffer->currentBuffer, currentTraceEndTime);
+    std::inplace_merge(
+        sequencedEvents.begin(),
+        sequencedEvents.begin() + threadEventsStart,
+        sequencedEvents.end(),
+        [](const auto& lhs, const auto& rhs) {
+          return lhs.sequence < rhs.sequence;
+        });
+  }
 
-    collectEventsAndClearBuffer(events, *currentBuffer_, currentTraceEndTime);
+  // The strings and payloads of the events are still in the buffers.
+  events.reserve(sequencedEvents.size());
+  for (auto&& sequencedEvent : sequencedEvents) {
+    enqueueTraceEventsFromPerformanceTracerEvent(
+        events, std::move(sequencedEvent));
+  }
+
+  auto it = threadBuffers_.begin();
+  while (it != threadBuffers_.end()) {
+    auto& threadBuffer = **it;
 
     // Reset state.
-    currentBuffer_ = &buffer_;
-    previousBuffer_ = nullptr;
-  } else {
-    // Trivial case.
-    events.reserve(currentBuffer_->size());
-    for (auto&& event : *currentBuffer_) {
-      enqueueTraceEventsFromPerformanceTracerEvent(events, std::move(event));
+    threadBuffer.buffer.reset();
+    threadBuffer.altBuffer.reset();
+    threadBuffer.currentBuffer = &threadBuffer.buffer;
+    threadBuffer.previousBuffer = nullptr;
+    threadBuffer.currentBufferStartTime = std::nullopt;
+
+    // The buffer of a thread that has exited is only referenced from here.
+    if (it->use_count() == 1) {
+      it = threadBuffers_.erase(it);
+    } else {
+      ++it;
     }
-    currentBuffer_->clear();
   }
 
   return events;
 }
 
-void PerformanceTracer::collectEventsAndClearBuffer(
-    std::vector<TraceEvent>& events,
-    std::vector<PerformanceTracerEvent>& buffer,
+void PerformanceTracer::collectEventsFromBuffer(
+    std::vector<SequencedEvent>& events,
+    EventBuffer& buffer,
     HighResTimeStamp currentTraceEndTime) {
-  for (auto&& event : buffer) {
-    if (isInTracingWindow(currentTraceEndTime, getCreatedAt(event))) {
-      enqueueTraceEventsFromPerformanceTracerEvent(events, std::move(event));
-    }
-  }
-
-  buffer.clear();
-  buffer.shrink_to_fit();
+  auto bufferEventsStart = events.size();
+  buffer.decode(events);
+  events.erase(
+      std::remove_if(
+          events.begin() + bufferEventsStart,
+          events.end(),
+          [&](const SequencedEvent& sequencedEvent) {
+            return !isInTracingWindow(
+                currentTraceEndTime, getCreatedAt(sequencedEvent.event));
+          }),
+      events.end());
 }
 
 bool PerformanceTracer::isInTracingWindow(
@@ -511,21 +570,39 @@ bool PerformanceTracer::isInTracingWindow(
   return timeStampToCheck > now - *currentTraceMaxDuration_;
 }
 
-void PerformanceTracer::enqueueEvent(PerformanceTracerEvent&& event) {
-  if (currentTraceMaxDuration_) {
-    auto createdAt = getCreatedAt(event);
-    // Check if the current buffer is "full"
-    if (createdAt > currentBufferStartTime_ + *currentTraceMaxDuration_) {
-      // We moved past the current buffer. We need to switch the other buffer as
-      // current.
-      previousBuffer_ = currentBuffer_;
-      currentBuffer_ = currentBuffer_ == &buffer_ ? &altBuffer_ : &buffer_;
-      currentBuffer_->clear();
-      currentBufferStartTime_ = createdAt;
+template <typename CreateEvent>
+void PerformanceTracer::enqueueEvent(CreateEvent&& createEvent) {
+  auto& threadBuffer = getThreadBuffer();
+
+  // Both this and stopTracing use sequentially consistent operations: either
+  // this sees that tracing has stopped, or stopTracing sees that this thread is
+  // writing and waits for it to finish before collecting its buffer.
+  threadBuffer.isWriting = true;
+  if (tracingAtomic_) {
+    auto createdAt = HighResTimeStamp::now();
+    if (currentTraceMaxDuration_) {
+      if (!threadBuffer.currentBufferStartTime) {
+        threadBuffer.currentBufferStartTime = createdAt;
+      } else if (
+          createdAt >
+          *threadBuffer.currentBufferStartTime + *currentTraceMaxDuration_) {
+        // We moved past the current buffer. We need to switch the other buffer
+        // as current.
+        threadBuffer.previousBuffer = threadBuffer.currentBuffer;
+        threadBuffer.currentBuffer =
+            threadBuffer.currentBuffer == &threadBuffer.buffer
+            ? &threadBuffer.altBuffer
+            : &threadBuffer.buffer;
+        threadBuffer.currentBuffer->clear();
+        threadBuffer.currentBufferStartTime = createdAt;
+      }
     }
-  }
 
-  currentBuffer_->emplace_back(std::move(event));
+    threadBuffer.currentBuffer->append(
+        nextSequence_.fetch_add(1, std::memory_order_relaxed),
+        createEvent(*threadBuffer.currentBuffer, createdAt));
+  }
+  threadBuffer.isWriting.store(false, std::memory_order_release);
 }
 
 HighResTimeStamp PerformanceTracer::getCreatedAt(
@@ -534,21 +611,141 @@ HighResTimeStamp PerformanceTracer::getCreatedAt(
       [](const auto& variant) { return variant.createdAt; }, event);
 }
 
+#pragma mark - Event buffer methods
+
 namespace {
-template <class... Ts>
-struct overloaded : Ts... {
-  using Ts::operator()...;
-};
-template <class... Ts>
-overloaded(Ts...) -> overloaded<Ts...>;
+
+/**
+ * Decodes the bytes of the alternative at \p index of \p Variant, and
+ * returns the number of bytes read.
+ */
+template <typename Variant, size_t Index = 0>
+size_t decodeAlternative(size_t index, const uint8_t* bytes, Variant& result) {
+  using Alternative = std::variant_alternative_t<Index, Variant>;
+  static_assert(std::is_trivially_copyable_v<Alternative>);
+
+  if constexpr (Index + 1 < std::variant_size_v<Variant>) {
+    if (index != Index) {
+      return decodeAlternative<Variant, Index + 1>(index, bytes, result);
+    }
+  }
+
+  std::array<uint8_t, sizeof(Alternative)> alternativeBytes{};
+  std::memcpy(alternativeBytes.data(), bytes, sizeof(Alternative));
+  result.template emplace<Index>(
+      std::bit_cast<Alternative>(alternativeBytes));
+  return sizeof(Alternative);
+}
+
 } // namespace
 
+PerformanceTracer::StringId PerformanceTracer::EventBuffer::intern(
+    std::string_view string) {
+  auto it = stringIds_.find(string);
+  if (it != stringIds_.end()) {
+    return it->second;
+  }
+
+  auto id = static_cast<StringId>(strings_.size());
+  stringIds_.emplace(strings_.emplace_back(string), id);
+  return id;
+}
+
+const std::string& PerformanceTracer::EventBuffer::getString(
+    StringId id) const {
+  return strings_[id];
+}
+
+PerformanceTracer::PayloadId PerformanceTracer::EventBuffer::store(
+    folly::dynamic&& payload) {
+  if (payload == nullptr) {
+    return NO_PAYLOAD;
+  }
+
+  payloads_.push_back(std::move(payload));
+  return static_cast<PayloadId>(payloads_.size() - 1);
+}
+
+PerformanceTracer::PayloadId PerformanceTracer::EventBuffer::store(
+    std::optional<folly::dynamic>&& payload) {
+  if (!payload) {
+    return NO_PAYLOAD;
+  }
+
+  return store(std::move(*payload));
+}
+
+folly::dynamic PerformanceTracer::EventBuffer::takePayload(PayloadId id) {
+  if (id == NO_PAYLOAD) {
+    return nullptr;
+  }
+
+  return std::move(payloads_[id]);
+}
+
+void PerformanceTracer::EventBuffer::append(
+    uint64_t sequence,
+    const PerformanceTracerEvent& event) {
+  std::visit(
+      [&](const auto& alternative) {
+        auto offset = records_.size();
+        records_.resize(offset + 1 + sizeof(sequence) + sizeof(alternative));
+        auto* record = records_.data() + offset;
+        record[0] = static_cast<uint8_t>(event.index());
+        std::memcpy(record + 1, &sequence, sizeof(sequence));
+        std::memcpy(
+            record + 1 + sizeof(sequence), &alternative, sizeof(alternative));
+      },
+      event);
+}
+
+void PerformanceTracer::EventBuffer::decode(
+    std::vector<SequencedEvent>& events) {
+  size_t offset = 0;
+  while (offset < records_.size()) {
+    const auto* record = records_.data() + offset;
+    auto& sequencedEvent = events.emplace_back(
+        SequencedEvent{.sequence = 0, .event = {}, .buffer = this});
+    std::memcpy(
+        &sequencedEvent.sequence, record + 1, sizeof(sequencedEvent.sequence));
+    offset += 1 + sizeof(sequencedEvent.sequence);
+    offset += decodeAlternative(
+        record[0], records_.data() + offset, sequencedEvent.event);
+  }
+}
+
+void PerformanceTracer::EventBuffer::clear() {
+  records_.clear();
+  strings_.clear();
+  stringIds_.clear();
+  payloads_.clear();
+}
+
+void PerformanceTracer::EventBuffer::reset() {
+  clear();
+  records_.shrink_to_fit();
+  strings_.shrink_to_fit();
+  payloads_.shrink_to_fit();
+}
+
+#pragma mark - Trace event conversion
+
 void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
     std::vector<TraceEvent>& events,
-    PerformanceTracerEvent&& event) {
+    SequencedEvent&& sequencedEvent) {
+  auto& buffer = *sequencedEvent.buffer;
+  auto resolveEntry =
+      [&](const std::optional<TimeStampEntry>& entry) -> folly::dynamic {
+    if (std::holds_alternative<HighResTimeStamp>(*entry)) {
+      return highResTimeStampToTracingClockTimeStamp(
+          std::get<HighResTimeStamp>(*entry));
+    }
+    return buffer.getString(std::get<StringId>(*entry));
+  };
+
   std::visit(
       overloaded{
-          [&](PerformanceTracerEventEventLoopTask&& event) {
+          [&](const PerformanceTracerEventEventLoopTask& event) {
             events.emplace_back(
                 TraceEvent{
                     .name = "RunTask",
@@ -560,7 +757,7 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
                     .dur = event.end - event.start,
                 });
           },
-          [&](PerformanceTracerEventEventLoopMicrotask&& event) {
+          [&](const PerformanceTracerEventEventLoopMicrotask& event) {
             events.emplace_back(
                 TraceEvent{
                     .name = "RunMicrotasks",
@@ -572,18 +769,17 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
                     .dur = event.end - event.start,
                 });
           },
-          [&](PerformanceTracerEventMark&& event) {
-            folly::dynamic eventArgs = folly::dynamic::object();
-            if (event.detail != nullptr) {
-              eventArgs = folly::dynamic::object(
-                  "data",
-                  folly::dynamic::object(
-                      "detail", folly::toJson(event.detail)));
+          [&](const PerformanceTracerEventMark& event) {
+            TraceEventArgs eventArgs;
+            if (event.detail != NO_PAYLOAD) {
+              eventArgs = UserTimingMarkTraceEventArgs{
+                  .detail = folly::toJson(buffer.takePayload(event.detail)),
+              };
             }
 
             events.emplace_back(
                 TraceEvent{
-                    .name = std::move(event.name),
+                    .name = buffer.getString(event.name),
                     .cat = {Category::UserTiming},
                     .ph = 'I',
                     .ts = event.start,
@@ -592,15 +788,15 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
                     .args = std::move(eventArgs),
                 });
           },
-          [&](PerformanceTracerEventMeasure&& event) {
+          [&](const PerformanceTracerEventMeasure& event) {
             folly::dynamic beginEventArgs = folly::dynamic::object();
-            if (event.detail != nullptr) {
-              beginEventArgs =
-                  folly::dynamic::object("detail", folly::toJson(event.detail));
+            if (event.detail != NO_PAYLOAD) {
+              beginEventArgs = folly::dynamic::object(
+                  "detail", folly::toJson(buffer.takePayload(event.detail)));
             }
-            if (event.stackTrace) {
+            if (event.stackTrace != NO_PAYLOAD) {
               beginEventArgs["data"] = folly::dynamic::object(
-                  "rnStackTrace", std::move(*event.stackTrace));
+                  "rnStackTrace", buffer.takePayload(event.stackTrace));
             }
 
             auto eventId = ++performanceMeasureCount_;
@@ -608,7 +804,7 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
             events.emplace_back(
                 TraceEvent{
                     .id = eventId,
-                    .name = event.name,
+                    .name = buffer.getString(event.name),
                     .cat = {Category::UserTiming},
                     .ph = 'b',
                     .ts = event.start,
@@ -619,7 +815,7 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
             events.emplace_back(
                 TraceEvent{
                     .id = eventId,
-                    .name = std::move(event.name),
+                    .name = buffer.getString(event.name),
                     .cat = {Category::UserTiming},
                     .ph = 'e',
                     .ts = event.start + event.duration,
@@ -627,24 +823,15 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
                     .tid = event.threadId,
                 });
           },
-          [&](PerformanceTracerEventTimeStamp&& event) {
-            folly::dynamic data = folly::dynamic::object("name", event.name)(
-                "message", std::move(event.name));
+          [&](const PerformanceTracerEventTimeStamp& event) {
+            const auto& name = buffer.getString(event.name);
+            folly::dynamic data =
+                folly::dynamic::object("name", name)("message", name);
             if (event.start) {
-              if (std::holds_alternative<HighResTimeStamp>(*event.start)) {
-                data["start"] = highResTimeStampToTracingClockTimeStamp(
-                    std::get<HighResTimeStamp>(*event.start));
-              } else {
-                data["start"] = std::move(std::get<std::string>(*event.start));
-              }
+              data["start"] = resolveEntry(event.start);
             }
             if (event.end) {
-              if (std::holds_alternative<HighResTimeStamp>(*event.end)) {
-                data["end"] = highResTimeStampToTracingClockTimeStamp(
-                    std::get<HighResTimeStamp>(*event.end));
-              } else {
-                data["end"] = std::move(std::get<std::string>(*event.end));
-              }
+              data["end"] = resolveEntry(event.end);
             }
 
             // We add a custom synthetic entry here to manually put Components
@@ -652,7 +839,8 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
             // Frontend preserves track ordering and we upgrade the fork.
             if (!alreadyEmittedEntryForComponentsTrackOrdering_ &&
                 event.trackName && !event.trackGroup) {
-              if (*event.trackName == "Components \u269B") {
+              const auto& trackName = buffer.getString(*event.trackName);
+              if (trackName == "Components \u269B") {
                 alreadyEmittedEntryForComponentsTrackOrdering_ = true;
                 // React is using 0.003 for Scheduler sub-tracks.
                 auto timestamp = highResTimeStampToTracingClockTimeStamp(
@@ -670,29 +858,30 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
                             folly::dynamic::object(
                                 "name", "ReactNative-ComponentsTrack")(
                                 "start", timestamp)("end", timestamp)(
-                                "track", *event.trackName)),
+                                "track", trackName)),
                     });
               }
             }
 
             if (event.trackName) {
-              data["track"] = std::move(*event.trackName);
+              data["track"] = buffer.getString(*event.trackName);
             }
             if (event.trackGroup) {
-              data["trackGroup"] = std::move(*event.trackGroup);
+              data["trackGroup"] = buffer.getString(*event.trackGroup);
             }
             if (event.color) {
               data["color"] = consoleTimeStampColorToString(*event.color);
             }
-            if (event.detail) {
+            if (event.detail != NO_PAYLOAD) {
               folly::dynamic devtoolsDetail = folly::dynamic::object();
-              for (const auto& [key, value] : event.detail->items()) {
+              for (const auto& [key, value] :
+                   buffer.takePayload(event.detail).items()) {
                 devtoolsDetail[key] = value;
               }
               data["devtools"] = folly::toJson(devtoolsDetail);
             }
-            if (event.stackTrace) {
-              data["rnStackTrace"] = std::move(*event.stackTrace);
+            if (event.stackTrace != NO_PAYLOAD) {
+              data["rnStackTrace"] = buffer.takePayload(event.stackTrace);
             }
 
             events.emplace_back(
@@ -706,15 +895,7 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
                     .args = folly::dynamic::object("data", std::move(data)),
                 });
           },
-          [&](PerformanceTracerResourceSendRequest&& event) {
-            folly::dynamic data =
-                folly::dynamic::object("initiator", folly::dynamic::object())(
-                    "priority", "VeryHigh")("renderBlocking", "non_blocking")(
-                    "requestId", std::move(event.requestId))(
-                    "requestMethod", std::move(event.requestMethod))(
-                    "resourceType", std::move(event.resourceType))(
-                    "url", std::move(event.url));
-
+          [&](const PerformanceTracerResourceSendRequest& event) {
             events.emplace_back(
                 TraceEvent{
                     .name = "ResourceSendRequest",
@@ -724,14 +905,18 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
                     .pid = processId_,
                     .s = 't',
                     .tid = event.threadId,
-                    .args = folly::dynamic::object("data", std::move(data)),
+                    .args =
+                        ResourceSendRequestTraceEventArgs{
+                            .requestId = buffer.getString(event.requestId),
+                            .requestMethod =
+                                buffer.getString(event.requestMethod),
+                            .resourceType =
+                                buffer.getString(event.resourceType),
+                            .url = buffer.getString(event.url),
+                        },
                 });
           },
-          [&](PerformanceTracerResourceReceivedData&& event) {
-            folly::dynamic data = folly::dynamic::object(
-                "encodedDataLength", event.encodedDataLength)(
-                "requestId", std::move(event.requestId));
-
+          [&](const PerformanceTracerResourceReceivedData& event) {
             events.emplace_back(
                 TraceEvent{
                     .name = "ResourceReceivedData",
@@ -741,23 +926,14 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
                     .pid = processId_,
                     .s = 't',
                     .tid = event.threadId,
-                    .args = folly::dynamic::object("data", std::move(data)),
+                    .args =
+                        ResourceReceivedDataTraceEventArgs{
+                            .requestId = buffer.getString(event.requestId),
+                            .encodedDataLength = event.encodedDataLength,
+                        },
                 });
           },
-          [&](PerformanceTracerResourceReceiveResponse&& event) {
-            folly::dynamic headersEntries = folly::dynamic::array;
-            for (const auto& [key, value] : event.headers) {
-              headersEntries.push_back(
-                  folly::dynamic::object("name", key)("value", value));
-            }
-            folly::dynamic data = folly::dynamic::object(
-                "encodedDataLength", event.encodedDataLength)(
-                "headers", headersEntries)("mimeType", event.mimeType)(
-                "protocol", event.protocol)(
-                "requestId", std::move(event.requestId))(
-                "statusCode", event.statusCode)(
-                "timing", std::move(event.timing));
-
+          [&](const PerformanceTracerResourceReceiveResponse& event) {
             events.emplace_back(
                 TraceEvent{
                     .name = "ResourceReceiveResponse",
@@ -767,15 +943,19 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
                     .pid = processId_,
                     .s = 't',
                     .tid = event.threadId,
-                    .args = folly::dynamic::object("data", std::move(data)),
+                    .args =
+                        ResourceReceiveResponseTraceEventArgs{
+                            .requestId = buffer.getString(event.requestId),
+                            .encodedDataLength = event.encodedDataLength,
+                            .headers = buffer.takePayload(event.headers),
+                            .mimeType = buffer.getString(event.mimeType),
+                            .protocol = buffer.getString(event.protocol),
+                            .statusCode = event.statusCode,
+                            .timing = buffer.takePayload(event.timing),
+                        },
                 });
           },
-          [&](PerformanceTracerResourceFinish&& event) {
-            folly::dynamic data = folly::dynamic::object(
-                "decodedBodyLength", event.decodedBodyLength)("didFail", false)(
-                "encodedDataLength", event.encodedDataLength)(
-                "requestId", std::move(event.requestId));
-
+          [&](const PerformanceTracerResourceFinish& event) {
             events.emplace_back(
                 TraceEvent{
                     .name = "ResourceFinish",
@@ -785,11 +965,16 @@ void PerformanceTracer::enqueueTraceEventsFromPerformanceTracerEvent(
                     .pid = processId_,
                     .s = 't',
                     .tid = event.threadId,
-                    .args = folly::dynamic::object("data", std::move(data)),
+                    .args =
+                        ResourceFinishTraceEventArgs{
+                            .requestId = buffer.getString(event.requestId),
+                            .encodedDataLength = event.encodedDataLength,
+                            .decodedBodyLength = event.decodedBodyLength,
+                        },
                 });
           },
       },
-      std::move(event));
+      sequencedEvent.event);
 }
 
 uint32_t PerformanceTracer::subscribeToTracingStateChanges(
@@ -15,10 +15,16 @@
 
 #include <folly/dynamic.h>
 #include <atomic>
+#include <deque>
 #include <functional>
+#include <limits>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
 #include <vector>
 
 namespace facebook::react::jsinspector_modern::tracing {
@@ -223,89 +229,112 @@ class PerformanceTracer {
 
 #pragma mark - Internal trace event types
 
+  /**
+   * The index of a string interned in an EventBuffer.
+   */
+  using StringId = uint32_t;
+
+  /**
+   * The index of a folly::dynamic value stored in an EventBuffer, or
+   * NO_PAYLOAD if there is none.
+   */
+  using PayloadId = uint32_t;
+  static constexpr PayloadId NO_PAYLOAD = std::numeric_limits<PayloadId>::max();
+
+  /**
+   * An encoded ConsoleTimeStampEntry.
+   */
+  using TimeStampEntry = std::variant<HighResTimeStamp, StringId>;
+
+  // The internal trace event types are trivially copyable, and are stored as
+  // bytes in an EventBuffer: strings are interned and folly::dynamic values
+  // are stored aside, only when present. They are converted to TraceEvents
+  // when tracing stops.
+
   struct PerformanceTracerEventEventLoopTask {
     HighResTimeStamp start;
     HighResTimeStamp end;
     ThreadId threadId;
-    HighResTimeStamp createdAt = HighResTimeStamp::now();
+    HighResTimeStamp createdAt;
   };
 
   struct PerformanceTracerEventEventLoopMicrotask {
     HighResTimeStamp start;
     HighResTimeStamp end;
     ThreadId threadId;
-    HighResTimeStamp createdAt = HighResTimeStamp::now();
+    HighResTimeStamp createdAt;
   };
 
   struct PerformanceTracerEventMark {
-    std::string name;
+    StringId name;
     HighResTimeStamp start;
-    folly::dynamic detail;
+    PayloadId detail;
     ThreadId threadId;
-    HighResTimeStamp createdAt = HighResTimeStamp::now();
+    HighResTimeStamp createdAt;
   };
 
   struct PerformanceTracerEventMeasure {
-    std::string name;
+    StringId name;
     HighResTimeStamp start;
     HighResDuration duration;
-    folly::dynamic detail;
+    PayloadId detail;
     ThreadId threadId;
-    std::optional<folly::dynamic> stackTrace;
-    HighResTimeStamp createdAt = HighResTimeStamp::now();
+    PayloadId stackTrace;
+    HighResTimeStamp createdAt;
   };
 
   struct PerformanceTracerEventTimeStamp {
-    std::string name;
-    std::optional<ConsoleTimeStampEntry> start;
-    std::optional<ConsoleTimeStampEntry> end;
-    std::optional<std::string> trackName;
-    std::optional<std::string> trackGroup;
+    StringId name;
+    std::optional<TimeStampEntry> start;
+    std::optional<TimeStampEntry> end;
+    std::optional<StringId> trackName;
+    std::optional<StringId> trackGroup;
     std::optional<ConsoleTimeStampColor> color;
-    std::optional<folly::dynamic> detail;
-    std::optional<folly::dynamic> stackTrace;
+    PayloadId detail;
+    PayloadId stackTrace;
     ThreadId threadId;
-    HighResTimeStamp createdAt = HighResTimeStamp::now();
+    HighResTimeStamp createdAt;
   };
 
   struct PerformanceTracerResourceSendRequest {
-    std::string requestId;
-    std::string url;
+    StringId requestId;
+    StringId url;
     HighResTimeStamp start;
-    std::string requestMethod;
-    std::string resourceType;
+    StringId requestMethod;
+    StringId resourceType;
     ThreadId threadId;
-    HighResTimeStamp createdAt = HighResTimeStamp::now();
+    HighResTimeStamp createdAt;
   };
 
   struct PerformanceTracerResourceFinish {
-    std::string requestId;
+    StringId requestId;
     HighResTimeStamp start;
     int encodedDataLength;
     int decodedBodyLength;
     ThreadId threadId;
-    HighResTimeStamp createdAt = HighResTimeStamp::now();
+    HighResTimeStamp createdAt;
   };
 
   struct PerformanceTracerResourceReceivedData {
-    std::string requestId;
+    StringId requestId;
     HighResTimeStamp start;
     int encodedDataLength;
     ThreadId threadId;
-    HighResTimeStamp createdAt = HighResTimeStamp::now();
+    HighResTimeStamp createdAt;
   };
 
   struct PerformanceTracerResourceReceiveResponse {
-    std::string requestId;
+    StringId requestId;
     HighResTimeStamp start;
     int encodedDataLength;
-    Headers headers;
-    std::string mimeType;
-    std::string protocol;
+    // Already in the serialized form: an array of {name, value} objects.
+    PayloadId headers;
+    StringId mimeType;
+    StringId protocol;
     int statusCode;
-    folly::dynamic timing;
+    PayloadId timing;
     ThreadId threadId;
-    HighResTimeStamp createdAt = HighResTimeStamp::now();
+    HighResTimeStamp createdAt;
   };
 
   using PerformanceTracerEvent = std::variant<
@@ -319,15 +348,93 @@ class PerformanceTracer {
       PerformanceTracerResourceReceivedData,
       PerformanceTracerResourceFinish>;
 
+  class EventBuffer;
+
+  struct SequencedEvent {
+    /**
+     * The order in which the event was reported, across all threads.
+     */
+    uint64_t sequence;
+    PerformanceTracerEvent event;
+    /**
+     * The buffer holding the strings and payloads of the event.
+     */
+    EventBuffer *buffer;
+  };
+
+  /**
+   * A sequence of events, encoded as records: the index of the type of the
+   * event in PerformanceTracerEvent, its sequence number and the bytes of the
+   * event.
+   */
+  class EventBuffer {
+   public:
+    EventBuffer() = default;
+    EventBuffer(const EventBuffer &) = delete;
+    EventBuffer &operator=(const EventBuffer &) = delete;
+
+    StringId intern(std::string_view string);
+    const std::string &getString(StringId id) const;
+
+    /**
+     * Returns NO_PAYLOAD, without storing anything, for null values.
+     */
+    PayloadId store(folly::dynamic &&payload);
+    PayloadId store(std::optional<folly::dynamic> &&payload);
+    folly::dynamic takePayload(PayloadId id);
+
+    void append(uint64_t sequence, const PerformanceTracerEvent &event);
+
+    /**
+     * Appends the events in the buffer to \p events, in the order they were
+     * appended.
+     */
+    void decode(std::vector<SequencedEvent> &events);
+
+    void clear();
+
+    /**
+     * Clears the buffer and releases its memory.
+     */
+    void reset();
+
+   private:
+    std::vector<uint8_t> records_;
+    // A deque keeps the strings in place, so the map can point to them.
+    std::deque<std::string> strings_;
+    std::unordered_map<std::string_view, StringId> stringIds_;
+    std::vector<folly::dynamic> payloads_;
+  };
+
+  /**
+   * The events reported by a single thread during a trace.
+   * Written only by the owning thread while tracing, and only read once
+   * tracing has stopped and the owning thread is no longer writing.
+   */
+  struct ThreadBuffer {
+    /**
+     * Whether the owning thread is in the middle of reporting an event.
+     */
+    std::atomic<bool> isWriting{false};
+
+    EventBuffer buffer;
+
+    // These fields are only used when setting a max duration on the trace.
+    EventBuffer altBuffer;
+    EventBuffer *currentBuffer = &buffer;
+    EventBuffer *previousBuffer{};
+    std::optional<HighResTimeStamp> currentBufferStartTime;
+  };
+
 #pragma mark - Private fields and methods
 
   const ProcessId processId_;
 
   /**
    * The flag is atomic in order to enable any thread to read it (via
-   * isTracing()) without holding the mutex.
-   * Within this class, both reads and writes MUST be protected by the mutex to
-   * avoid false positives and data races.
+   * isTracing()) and report events without holding the mutex.
+   * Within this class, writes MUST be protected by the mutex to avoid false
+   * positives and data races.
    */
   std::atomic<bool> tracingAtomic_{false};
   /**
@@ -343,13 +450,17 @@ class PerformanceTracer {
 
   std::optional<HighResDuration> currentTraceMaxDuration_;
 
-  std::vector<PerformanceTracerEvent> buffer_;
+  /**
+   * The source of SequencedEvent::sequence.
+   */
+  std::atomic<uint64_t> nextSequence_{0};
 
-  // These fields are only used when setting a max duration on the trace.
-  std::vector<PerformanceTracerEvent> altBuffer_;
-  std::vector<PerformanceTracerEvent> *currentBuffer_ = &buffer_;
-  std::vector<PerformanceTracerEvent> *previousBuffer_{};
-  HighResTimeStamp currentBufferStartTime_;
+  /**
+   * The buffers of all threads that have reported events. Only locked when a
+   * thread reports its first event, and when collecting events.
+   */
+  std::mutex threadBuffersMutex_;
+  std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers_;
 
   // A flag that is used to ensure we only emit one auxiliary entry for the
   // ordering of Scheduler / Component tracks.
@@ -358,6 +469,7 @@ class PerformanceTracer {
   /**
    * Protects data members of this class for concurrent access, including
    * the tracingAtomic_, in order to eliminate potential "logic" races.
+   * Reporting events doesn't lock it.
    */
   std::mutex mutex_;
 
@@ -367,17 +479,25 @@ class PerformanceTracer {
 
   bool startTracingImpl(std::optional<HighResDuration> maxDuration = std::nullopt);
 
+  ThreadBuffer &getThreadBuffer();
   std::vector<TraceEvent> collectEventsAndClearBuffers(HighResTimeStamp currentTraceEndTime);
-  void collectEventsAndClearBuffer(
-      std::vector<TraceEvent> &events,
-      std::vector<PerformanceTracerEvent> &buffer,
+  void collectEventsFromBuffer(
+      std::vector<SequencedEvent> &events,
+      EventBuffer &buffer,
       HighResTimeStamp currentTraceEndTime);
   bool isInTracingWindow(HighResTimeStamp now, HighResTimeStamp timeStampToCheck) const;
-  void enqueueEvent(PerformanceTracerEvent &&event);
+
+  /**
+   * Appends the event created by \p createEvent to the buffer of the current
+   * thread, if tracing. \p createEvent is called with the buffer, to intern
+   * the strings of the event, and the creation time of the event.
+   */
+  template <typename CreateEvent>
+  void enqueueEvent(CreateEvent &&createEvent);
 
   HighResTimeStamp getCreatedAt(const PerformanceTracerEvent &event) const;
 
-  void enqueueTraceEventsFromPerformanceTracerEvent(std::vector<TraceEvent> &events, PerformanceTracerEvent &&event);
+  void enqueueTraceEventsFromPerformanceTracerEvent(std::vector<TraceEvent> &events, SequencedEvent &&sequencedEvent);
 };
 
 } // namespace facebook::react::jsinspector_modern::tracing
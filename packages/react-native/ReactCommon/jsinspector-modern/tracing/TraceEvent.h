@@ -11,6 +11,8 @@
 #include <react/timing/primitives.h>
 
 #include <folly/dynamic.h>
+#include <string>
+#include <variant>
 
 namespace facebook::react::jsinspector_modern::tracing {
 
@@ -22,6 +24,105 @@ using ThreadId = uint64_t;
  */
 using RuntimeProfileId = uint16_t;
 
+/**
+ * Arguments of an event that has none, serialized as an empty object.
+ */
+struct EmptyTraceEventArgs {};
+
+/**
+ * Arguments of the "BeginFrame" and "DrawFrame" events.
+ */
+struct FrameTraceEventArgs {
+  uint64_t frameSeqId;
+  int layerTreeId;
+};
+
+/**
+ * Arguments of the "SetLayerTreeId" event, serialized under "data".
+ */
+struct SetLayerTreeIdTraceEventArgs {
+  std::string frame;
+  int layerTreeId;
+};
+
+/**
+ * Arguments of the "Screenshot" event.
+ */
+struct ScreenshotTraceEventArgs {
+  /** Base64-encoded image. */
+  std::string snapshot;
+  int sourceId;
+  uint64_t frameSequence;
+  HighResTimeStamp expectedDisplayTime;
+};
+
+/**
+ * Arguments of a "performance.mark" user timing event with a detail,
+ * serialized under "data".
+ */
+struct UserTimingMarkTraceEventArgs {
+  /** JSON-serialized detail of the mark. */
+  std::string detail;
+};
+
+/**
+ * Arguments of the "ResourceSendRequest" event, serialized under "data".
+ */
+struct ResourceSendRequestTraceEventArgs {
+  std::string requestId;
+  std::string requestMethod;
+  std::string resourceType;
+  std::string url;
+};
+
+/**
+ * Arguments of the "ResourceReceiveResponse" event, serialized under "data".
+ */
+struct ResourceReceiveResponseTraceEventArgs {
+  std::string requestId;
+  int encodedDataLength;
+  /** An array of {name, value} objects. */
+  folly::dynamic headers;
+  std::string mimeType;
+  std::string protocol;
+  int statusCode;
+  folly::dynamic timing;
+};
+
+/**
+ * Arguments of the "ResourceReceivedData" event, serialized under "data".
+ */
+struct ResourceReceivedDataTraceEventArgs {
+  std::string requestId;
+  int encodedDataLength;
+};
+
+/**
+ * Arguments of the "ResourceFinish" event, serialized under "data".
+ */
+struct ResourceFinishTraceEventArgs {
+  std::string requestId;
+  int encodedDataLength;
+  int decodedBodyLength;
+};
+
+/**
+ * Arguments of a trace event. The built-in events with a fixed shape use a
+ * typed representation, so they can be serialized without going through
+ * folly::dynamic; any other event uses an arbitrary folly::dynamic object.
+ */
+using TraceEventArgs = std::variant<
+    EmptyTraceEventArgs,
+    folly::dynamic,
+    FrameTraceEventArgs,
+    SetLayerTreeIdTraceEventArgs,
+    ScreenshotTraceEventArgs,
+    UserTimingMarkTraceEventArgs,
+    ResourceSendRequestTraceEventArgs,
+    ResourceReceiveResponseTraceEventArgs,
+    ResourceReceivedDataTraceEventArgs,
+    ResourceFinishTraceEventArgs>;
+
 /**
  * A trace event to send to the debugger frontend, as defined by the Trace Event
  * Format.
@@ -66,7 +167,7 @@ struct TraceEvent {
   ThreadId tid;
 
   /** Any arguments provided for the event. */
-  folly::dynamic args = folly::dynamic::object();
+  TraceEventArgs args{};
 
   /**
    * The duration of the event, in microseconds (µs). Only applicable to
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TraceEventChunkWriter.h"
+#include "Timing.h"
+#include "TracingCategory.h"
+
+#include <folly/json.h>
+#include <react/utils/overloaded.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <string_view>
+
+namespace facebook::react::jsinspector_modern::tracing {
+
+namespace {
+
+/**
+ * Chunks are allocated upfront, up to this size.
+ */
+constexpr size_t MAX_RESERVED_CHUNK_BYTES = 16 * 1024 * 1024; // 16 MiB
+
+template <typename T>
+void appendNumber(std::string& output, T value, int base = 10) {
+  std::array<char, 24> buffer{};
+  auto result =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+  output.append(buffer.data(), result.ptr);
+}
+
+void appendString(std::string& output, std::string_view value) {
+  output.push_back('"');
+
+  size_t runStart = 0;
+  for (size_t index = 0; index < value.size(); index++) {
+    auto character = static_cast<unsigned char>(value[index]);
+    if (character >= 0x20 && character != '"' && character != '\\') {
+      continue;
+    }
+
+    output.append(value.data() + runStart, index - runStart);
+    runStart = index + 1;
+    switch (character) {
+      case '"':
+        output.append("\\\"");
+        break;
+      case '\\':
+        output.append("\\\\");
+        break;
+      case '\b':
+        output.append("\\b");
+        break;
+      case '\f':
+        output.append("\\f");
+        break;
+      case '\n':
+        output.append("\\n");
+        break;
+      case '\r':
+        output.append("\\r");
+        break;
+      case '\t':
+        output.append("\\t");
+        break;
+      default: {
+        constexpr std::string_view hexDigits = "0123456789abcdef";
+        output.append("\\u00");
+        output.push_back(hexDigits[character >> 4]);
+        output.push_back(hexDigits[character & 0xf]);
+        break;
+      }
+    }
+  }
+  output.append(value.data() + runStart, value.size() - runStart);
+
+  output.push_back('"');
+}
+
+void appendCategories(std::string& output, const Categories& categories) {
+  output.push_back('"');
+  for (size_t i = 0; i < categories.size(); ++i) {
+    if (i > 0) {
+      output.push_back(',');
+    }
+    // Category names never need escaping.
+    output.append(tracingCategoryToString(categories[i]));
+  }
+  output.push_back('"');
+}
+
+void appendArgs(std::string& output, const TraceEventArgs& eventArgs) {
+  std::visit(
+      overloaded{
+          [&](const EmptyTraceEventArgs&) { output.append("{}"); },
+          [&](const folly::dynamic& args) {
+            output.append(folly::toJson(args));
+          },
+          [&](const FrameTraceEventArgs& args) {
+            output.append("{\"frameSeqId\":");
+            appendNumber(output, args.frameSeqId);
+            output.append(",\"layerTreeId\":");
+            appendNumber(output, args.layerTreeId);
+            output.push_back('}');
+          },
+          [&](const SetLayerTreeIdTraceEventArgs& args) {
+            output.append("{\"data\":{\"frame\":");
+            appendString(output, args.frame);
+            output.append(",\"layerTreeId\":");
+            appendNumber(output, args.layerTreeId);
+            output.append("}}");
+          },
+          [&](const ScreenshotTraceEventArgs& args) {
+            output.append("{\"snapshot\":");
+            appendString(output, args.snapshot);
+            output.append(",\"source_id\":");
+            appendNumber(output, args.sourceId);
+            output.append(",\"frame_sequence\":");
+            appendNumber(output, args.frameSequence);
+            output.append(",\"expected_display_time\":");
+            appendNumber(
+                output,
+                highResTimeStampToTracingClockTimeStamp(
+                    args.expectedDisplayTime));
+            output.push_back('}');
+          },
+          [&](const UserTimingMarkTraceEventArgs& args) {
+            output.append("{\"data\":{\"detail\":");
+            appendString(output, args.detail);
+            output.append("}}");
+          },
+          [&](const ResourceSendRequestTraceEventArgs& args) {
+            output.append(
+                "{\"data\":{\"initiator\":{},\"priority\":\"VeryHigh\","
+                "\"renderBlocking\":\"non_blocking\",\"requestId\":");
+            appendString(output, args.requestId);
+            output.append(",\"requestMethod\":");
+            appendString(output, args.requestMethod);
+            output.append(",\"resourceType\":");
+            appendString(output, args.resourceType);
+            output.append(",\"url\":");
+            appendString(output, args.url);
+            output.append("}}");
+          },
+          [&](const ResourceReceiveResponseTraceEventArgs& args) {
+            output.append("{\"data\":{\"encodedDataLength\":");
+            appendNumber(output, args.encodedDataLength);
+            output.append(",\"headers\":");
+            output.append(folly::toJson(args.headers));
+            output.append(",\"mimeType\":");
+            appendString(output, args.mimeType);
+            output.append(",\"protocol\":");
+            appendString(output, args.protocol);
+            output.append(",\"requestId\":");
+            appendString(output, args.requestId);
+            output.append(",\"statusCode\":");
+            appendNumber(output, args.statusCode);
+            output.append(",\"timing\":");
+            output.append(folly::toJson(args.timing));
+            output.append("}}");
+          },
+          [&](const ResourceReceivedDataTraceEventArgs& args) {
+            output.append("{\"data\":{\"encodedDataLength\":");
+            appendNumber(output, args.encodedDataLength);
+            output.append(",\"requestId\":");
+            appendString(output, args.requestId);
+            output.append("}}");
+          },
+          [&](const ResourceFinishTraceEventArgs& args) {
+            output.append("{\"data\":{\"decodedBodyLength\":");
+            appendNumber(output, args.decodedBodyLength);
+            output.append(",\"didFail\":false,\"encodedDataLength\":");
+            appendNumber(output, args.encodedDataLength);
+            output.append(",\"requestId\":");
+            appendString(output, args.requestId);
+            output.append("}}");
+          },
+      },
+      eventArgs);
+}
+
+} // namespace
+
+TraceEventChunkWriter::TraceEventChunkWriter(
+    size_t maxChunkBytes,
+    ChunkCallback chunkCallback)
+    : maxChunkBytes_(maxChunkBytes), chunkCallback_(std::move(chunkCallback)) {
+  startChunk();
+}
+
+void TraceEventChunkWriter::write(const TraceEvent& event) {
+  auto offset = chunk_.size();
+  if (offset > 1) {
+    chunk_.push_back(',');
+  }
+  appendEvent(chunk_, event);
+
+  if (!groupOffset_) {
+    fitEventsFrom(offset);
+  }
+}
+
+void TraceEventChunkWriter::beginGroup() {
+  assert(!groupOffset_ && "Trace event groups can't be nested");
+  groupOffset_ = chunk_.size();
+}
+
+void TraceEventChunkWriter::endGroup() {
+  assert(groupOffset_ && "endGroup() called without beginGroup()");
+  auto offset = *groupOffset_;
+  groupOffset_.reset();
+  fitEventsFrom(offset);
+}
+
+void TraceEventChunkWriter::flush() {
+  assert(!groupOffset_ && "flush() called in the middle of a group");
+  if (chunk_.size() > 1) {
+    emitChunk();
+  }
+}
+
+void TraceEventChunkWriter::startChunk() {
+  chunk_.clear();
+  chunk_.reserve(std::min(maxChunkBytes_, MAX_RESERVED_CHUNK_BYTES));
+  chunk_.push_back('[');
+}
+
+void TraceEventChunkWriter::emitChunk() {
+  chunk_.push_back(']');
+  chunkCallback_(std::move(chunk_));
+  startChunk();
+}
+
+void TraceEventChunkWriter::fitEventsFrom(size_t offset) {
+  // Account for the closing bracket. If these are the first events of the
+  // chunk, there is nothing to gain from moving them.
+  if (chunk_.size() + 1 <= maxChunkBytes_ || offset <= 1) {
+    return;
+  }
+
+  // Skip the separator in front of the events.
+  auto events = chunk_.substr(offset + 1);
+  chunk_.resize(offset);
+  emitChunk();
+  chunk_.append(events);
+}
+
+/* static */ void TraceEventChunkWriter::appendEvent(
+    std::string& output,
+    const TraceEvent& event) {
+  output.push_back('{');
+  if (event.id.has_value()) {
+    output.append("\"id\":\"0x");
+    appendNumber(output, event.id.value(), 16);
+    output.append("\",");
+  }
+  output.append("\"name\":");
+  appendString(output, event.name);
+  output.append(",\"cat\":");
+  appendCategories(output, event.cat);
+  output.append(",\"ph\":");
+  appendString(output, std::string_view(&event.ph, 1));
+  output.append(",\"ts\":");
+  appendNumber(output, highResTimeStampToTracingClockTimeStamp(event.ts));
+  output.append(",\"pid\":");
+  appendNumber(output, event.pid);
+  if (event.s.has_value()) {
+    output.append(",\"s\":");
+    appendString(output, std::string_view(&event.s.value(), 1));
+  }
+  output.append(",\"tid\":");
+  appendNumber(output, event.tid);
+  output.append(",\"args\":");
+  appendArgs(output, event.args);
+  if (event.dur.has_value()) {
+    output.append(",\"dur\":");
+    appendNumber(
+        output, highResDurationToTracingClockDuration(event.dur.value()));
+  }
+  output.push_back('}');
+}
+
+} // namespace facebook::react::jsinspector_modern::tracing
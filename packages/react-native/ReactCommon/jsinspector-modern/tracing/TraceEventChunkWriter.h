@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include "TraceEvent.h"
+
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace facebook::react::jsinspector_modern::tracing {
+
+/**
+ * Serializes Trace Events straight into JSON, without building a
+ * folly::dynamic representation of them, and splits them into chunks: JSON
+ * arrays of at most a given number of bytes.
+ *
+ * The size of a chunk is exact, including its brackets and separators: an event
+ * that does not fit in the current chunk is moved to the next one. An event
+ * that is larger than the limit on its own is emitted in a chunk of its own.
+ */
+class TraceEventChunkWriter {
+ public:
+  using ChunkCallback = std::function<void(std::string &&serializedChunk)>;
+
+  /**
+   * \param maxChunkBytes The maximum size of a serialized chunk.
+   * \param chunkCallback Called with every full chunk, and with the last one
+   * when flush() is called.
+   */
+  TraceEventChunkWriter(size_t maxChunkBytes, ChunkCallback chunkCallback);
+
+  TraceEventChunkWriter(const TraceEventChunkWriter &) = delete;
+  TraceEventChunkWriter &operator=(const TraceEventChunkWriter &) = delete;
+
+  /**
+   * Appends a serialized Trace Event to the current chunk.
+   */
+  void write(const TraceEvent &event);
+
+  /**
+   * Events written between beginGroup() and endGroup() are emitted in the same
+   * chunk. Groups can't be nested.
+   */
+  void beginGroup();
+  void endGroup();
+
+  /**
+   * Emits the current chunk, if it has any events.
+   */
+  void flush();
+
+  /**
+   * Appends a Trace Event to \p output as a JSON object, in the same format as
+   * TraceEventSerializer::serialize.
+   */
+  static void appendEvent(std::string &output, const TraceEvent &event);
+
+ private:
+  void startChunk();
+  void emitChunk();
+
+  /**
+   * Moves the events serialized at \p offset and after to a new chunk if they
+   * don't fit in the current one.
+   */
+  void fitEventsFrom(size_t offset);
+
+  size_t maxChunkBytes_;
+  ChunkCallback chunkCallback_;
+  std::string chunk_;
+  std::optional<size_t> groupOffset_;
+};
+
+} // namespace facebook::react::jsinspector_modern::tracing
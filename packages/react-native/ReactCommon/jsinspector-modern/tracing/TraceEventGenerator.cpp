@@ -6,7 +6,6 @@
  */
 
 #include "TraceEventGenerator.h"
-#include "Timing.h"
 #include "TracingCategory.h"
 
 #include <react/utils/Base64.h>
@@ -19,9 +18,6 @@ namespace facebook::react::jsinspector_modern::tracing {
     ProcessId processId,
     ThreadId threadId,
     HighResTimeStamp timestamp) {
-  folly::dynamic data = folly::dynamic::object("frame", std::move(frame))(
-      "layerTreeId", layerTreeId);
-
   return TraceEvent{
       .name = "SetLayerTreeId",
       .cat = {Category::HiddenTimeline},
@@ -30,7 +26,9 @@ namespace facebook::react::jsinspector_modern::tracing {
       .pid = processId,
       .s = 't',
       .tid = threadId,
-      .args = folly::dynamic::object("data", std::move(data)),
+      .args =
+          SetLayerTreeIdTraceEventArgs{
+              .frame = std::move(frame), .layerTreeId = layerTreeId},
   };
 }
 
@@ -42,8 +40,8 @@ TraceEventGenerator::createFrameTimingsEvents(
     HighResTimeStamp endTimestamp,
     ProcessId processId,
     ThreadId threadId) {
-  folly::dynamic args = folly::dynamic::object("frameSeqId", sequenceId)(
-      "layerTreeId", layerTreeId);
+  auto args = FrameTraceEventArgs{
+      .frameSeqId = sequenceId, .layerTreeId = layerTreeId};
 
   auto beginEvent = TraceEvent{
       .name = "BeginFrame",
@@ -80,12 +78,6 @@ TraceEventGenerator::createFrameTimingsEvents(
   std::string snapshotBytes(snapshot.begin(), snapshot.end());
   std::string base64Snapshot = base64Encode(snapshotBytes);
 
-  folly::dynamic args =
-      folly::dynamic::object("snapshot", std::move(base64Snapshot))(
-          "source_id", sourceId)("frame_sequence", frameSequenceId)(
-          "expected_display_time",
-          highResTimeStampToTracingClockTimeStamp(expectedDisplayTime));
-
   return TraceEvent{
       .name = "Screenshot",
       .cat = {Category::Screenshot},
@@ -93,7 +85,12 @@ TraceEventGenerator::createFrameTimingsEvents(
       .ts = expectedDisplayTime,
       .pid = processId,
       .tid = threadId,
-      .args = std::move(args),
+      .args =
+          ScreenshotTraceEventArgs{
+              .snapshot = std::move(base64Snapshot),
+              .sourceId = sourceId,
+              .frameSequence = frameSequenceId,
+              .expectedDisplayTime = expectedDisplayTime},
   };
 }
 
@@ -10,6 +10,7 @@
 #include "TracingCategory.h"
 
 #include <react/timing/primitives.h>
+#include <react/utils/overloaded.h>
 
 namespace facebook::react::jsinspector_modern::tracing {
 
@@ -31,7 +32,7 @@ namespace facebook::react::jsinspector_modern::tracing {
     result["s"] = std::string(1, event.s.value());
   }
   result["tid"] = event.tid;
-  result["args"] = std::move(event.args);
+  result["args"] = serializeArgs(std::move(event.args));
   if (event.dur.has_value()) {
     result["dur"] = highResDurationToTracingClockDuration(event.dur.value());
   }
@@ -39,6 +40,82 @@ namespace facebook::react::jsinspector_modern::tracing {
   return result;
 }
 
+/* static */ folly::dynamic TraceEventSerializer::serializeArgs(
+    TraceEventArgs&& args) {
+  return std::visit(
+      overloaded{
+          [](EmptyTraceEventArgs&&) -> folly::dynamic {
+            return folly::dynamic::object();
+          },
+          [](folly::dynamic&& value) -> folly::dynamic {
+            return std::move(value);
+          },
+          [](FrameTraceEventArgs&& value) -> folly::dynamic {
+            return folly::dynamic::object("frameSeqId", value.frameSeqId)(
+                "layerTreeId", value.layerTreeId);
+          },
+          [](SetLayerTreeIdTraceEventArgs&& value) -> folly::dynamic {
+            return folly::dynamic::object(
+                "data",
+                folly::dynamic::object("frame", std::move(value.frame))(
+                    "layerTreeId", value.layerTreeId));
+          },
+          [](ScreenshotTraceEventArgs&& value) -> folly::dynamic {
+            return folly::dynamic::object(
+                "snapshot", std::move(value.snapshot))(
+                "source_id", value.sourceId)(
+                "frame_sequence", value.frameSequence)(
+                "expected_display_time",
+                highResTimeStampToTracingClockTimeStamp(
+                    value.expectedDisplayTime));
+          },
+          [](UserTimingMarkTraceEventArgs&& value) -> folly::dynamic {
+            return folly::dynamic::object(
+                "data",
+                folly::dynamic::object("detail", std::move(value.detail)));
+          },
+          [](ResourceSendRequestTraceEventArgs&& value) -> folly::dynamic {
+            return folly::dynamic::object(
+                "data",
+                folly::dynamic::object("initiator", folly::dynamic::object())(
+                    "priority", "VeryHigh")("renderBlocking", "non_blocking")(
+                    "requestId", std::move(value.requestId))(
+                    "requestMethod", std::move(value.requestMethod))(
+                    "resourceType", std::move(value.resourceType))(
+                    "url", std::move(value.url)));
+          },
+          [](ResourceReceiveResponseTraceEventArgs&& value) -> folly::dynamic {
+            return folly::dynamic::object(
+                "data",
+                folly::dynamic::object(
+                    "encodedDataLength", value.encodedDataLength)(
+                    "headers", std::move(value.headers))(
+                    "mimeType", std::move(value.mimeType))(
+                    "protocol", std::move(value.protocol))(
+                    "requestId", std::move(value.requestId))(
+                    "statusCode", value.statusCode)(
+                    "timing", std::move(value.timing)));
+          },
+          [](ResourceReceivedDataTraceEventArgs&& value) -> folly::dynamic {
+            return folly::dynamic::object(
+                "data",
+                folly::dynamic::object(
+                    "encodedDataLength", value.encodedDataLength)(
+                    "requestId", std::move(value.requestId)));
+          },
+          [](ResourceFinishTraceEventArgs&& value) -> folly::dynamic {
+            return folly::dynamic::object(
+                "data",
+                folly::dynamic::object(
+                    "decodedBodyLength", value.decodedBodyLength)(
+                    "didFail", false)(
+                    "encodedDataLength", value.encodedDataLength)(
+                    "requestId", std::move(value.requestId)));
+          },
+      },
+      std::move(args));
+}
+
 /* static */ folly::dynamic TraceEventSerializer::serializeProfileChunk(
     TraceEventProfileChunk&& profileChunk) {
   return folly::dynamic::object(
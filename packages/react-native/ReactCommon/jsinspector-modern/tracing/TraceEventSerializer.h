@@ -30,6 +30,15 @@ class TraceEventSerializer {
    */
   static folly::dynamic serialize(TraceEvent &&event);
 
+  /**
+   * Serializes the arguments of a TraceEvent to a folly::dynamic object.
+   *
+   * \param args rvalue reference to the TraceEventArgs.
+   * \return A folly::dynamic object that represents the serialized "args"
+   * property of a Trace Event for CDP.
+   */
+  static folly::dynamic serializeArgs(TraceEventArgs &&args);
+
   /**
    * Serialize a TraceEventProfileChunk to a folly::dynamic object.
    *
@@ -89,6 +98,9 @@ class TraceEventSerializer {
    * Estimates the JSON-serialized byte size of a folly::dynamic value.
    * This is a rough but conservative estimate to avoid the cost of
    * double-serialization (once to measure, once to emit).
+   *
+   * TraceEventChunkWriter tracks the exact size of the events it serializes,
+   * and should be preferred for chunking Trace Events.
    */
   static size_t estimateJsonSize(const folly::dynamic &value);
 };
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsinspector-modern/tracing/PerformanceTracer.h>
+
+#include <gtest/gtest.h>
+#include <map>
+#include <thread>
+
+namespace facebook::react::jsinspector_modern::tracing {
+
+TEST(PerformanceTracerTest, CollectsEventsFromAllThreads) {
+  constexpr int THREADS_COUNT = 4;
+  constexpr int EVENTS_PER_THREAD = 1000;
+
+  auto& tracer = PerformanceTracer::getInstance();
+  ASSERT_TRUE(tracer.startTracing());
+
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < THREADS_COUNT; thread++) {
+    threads.emplace_back([&tracer, thread]() {
+      for (int index = 0; index < EVENTS_PER_THREAD; index++) {
+        tracer.reportMark(
+            "Thread" + std::to_string(thread) + "-" + std::to_string(index),
+            HighResTimeStamp::now());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto events = tracer.stopTracing();
+  ASSERT_TRUE(events.has_value());
+
+  // Events of every thread are collected in the order they were reported.
+  std::map<std::string, int> nextIndexByThread;
+  for (const auto& event : *events) {
+    if (event.name.rfind("Thread", 0) != 0) {
+      continue;
+    }
+    auto separator = event.name.find('-');
+    auto thread = event.name.substr(0, separator);
+    auto index = std::stoi(event.name.substr(separator + 1));
+    EXPECT_EQ(index, nextIndexByThread[thread]++);
+  }
+  EXPECT_EQ(nextIndexByThread.size(), THREADS_COUNT);
+  for (const auto& [thread, count] : nextIndexByThread) {
+    EXPECT_EQ(count, EVENTS_PER_THREAD) << thread;
+  }
+}
+
+TEST(PerformanceTracerTest, MergesEventsFromThreadsInReportingOrder) {
+  auto& tracer = PerformanceTracer::getInstance();
+  ASSERT_TRUE(tracer.startTracing());
+
+  auto start = HighResTimeStamp::now();
+  for (int index = 0; index < 6; index++) {
+    std::thread([&tracer, index, start]() {
+      tracer.reportMark("Mark" + std::to_string(index), start);
+    }).join();
+    tracer.reportMark("Main" + std::to_string(index), start);
+  }
+
+  auto events = tracer.stopTracing();
+  ASSERT_TRUE(events.has_value());
+
+  std::vector<std::string> names;
+  for (const auto& event : *events) {
+    if (event.ph == 'I' && event.cat.front() == Category::UserTiming) {
+      names.push_back(event.name);
+    }
+  }
+  EXPECT_EQ(
+      names,
+      std::vector<std::string>(
+          {"Mark0",
+           "Main0",
+           "Mark1",
+           "Main1",
+           "Mark2",
+           "Main2",
+           "Mark3",
+           "Main3",
+           "Mark4",
+           "Main4",
+           "Mark5",
+           "Main5"}));
+}
+
+TEST(PerformanceTracerTest, ResolvesStringsOfEncodedEvents) {
+  auto& tracer = PerformanceTracer::getInstance();
+  ASSERT_TRUE(tracer.startTracing());
+
+  auto start = HighResTimeStamp::now();
+  for (int index = 0; index < 3; index++) {
+    tracer.reportMark("Mark", start);
+    tracer.reportMeasure(
+        "Measure" + std::to_string(index),
+        start,
+        HighResDuration::fromNanoseconds(index));
+  }
+
+  auto events = tracer.stopTracing();
+  ASSERT_TRUE(events.has_value());
+
+  std::vector<std::string> names;
+  for (const auto& event : *events) {
+    if (event.cat.front() == Category::UserTiming) {
+      names.push_back(std::string(1, event.ph) + ":" + event.name);
+    }
+  }
+  EXPECT_EQ(
+      names,
+      std::vector<std::string>(
+          {"I:Mark",
+           "b:Measure0",
+           "e:Measure0",
+           "I:Mark",
+           "b:Measure1",
+           "e:Measure1",
+           "I:Mark",
+           "b:Measure2",
+           "e:Measure2"}));
+}
+
+TEST(PerformanceTracerTest, DoesNotCollectEventsAfterTracingStopped) {
+  auto& tracer = PerformanceTracer::getInstance();
+  ASSERT_TRUE(tracer.startTracing());
+  tracer.reportMark("Before", HighResTimeStamp::now());
+  ASSERT_TRUE(tracer.stopTracing().has_value());
+
+  tracer.reportMark("Between", HighResTimeStamp::now());
+
+  ASSERT_TRUE(tracer.startTracing());
+  auto events = tracer.stopTracing();
+  ASSERT_TRUE(events.has_value());
+  for (const auto& event : *events) {
+    EXPECT_NE(event.name, "Before");
+    EXPECT_NE(event.name, "Between");
+  }
+}
+
+} // namespace facebook::react::jsinspector_modern::tracing
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsinspector-modern/tracing/Timing.h>
+#include <jsinspector-modern/tracing/TraceEventChunkWriter.h>
+#include <jsinspector-modern/tracing/TraceEventGenerator.h>
+#include <jsinspector-modern/tracing/TraceEventSerializer.h>
+
+#include <folly/json.h>
+#include <gtest/gtest.h>
+
+namespace facebook::react::jsinspector_modern::tracing {
+
+namespace {
+
+HighResTimeStamp timestamp(int64_t microseconds) {
+  return TRACING_TIME_ORIGIN +
+      HighResDuration::fromNanoseconds(microseconds * 1000);
+}
+
+TraceEvent createEvent(int index) {
+  return TraceEvent{
+      .name = "Event" + std::to_string(index),
+      .cat = {Category::Timeline},
+      .ph = 'X',
+      .ts = timestamp(index),
+      .pid = 1,
+      .tid = 2,
+      .dur = HighResDuration::fromNanoseconds(1000),
+  };
+}
+
+TraceEvent createInstantEvent(std::string name, TraceEventArgs args) {
+  return TraceEvent{
+      .name = std::move(name),
+      .cat = {Category::Timeline},
+      .ph = 'I',
+      .ts = timestamp(30),
+      .pid = 1,
+      .s = 't',
+      .tid = 2,
+      .args = std::move(args),
+  };
+}
+
+std::vector<TraceEvent> createEvents() {
+  std::vector<TraceEvent> events;
+  events.push_back(createEvent(0));
+  events.push_back(
+      TraceEvent{
+          .id = 0xbeef,
+          .name = "Escaped \"name\"\n\t\\ \x01 ⚛",
+          .cat = {Category::UserTiming, Category::Timeline},
+          .ph = 'b',
+          .ts = timestamp(42),
+          .pid = 1,
+          .tid = 2,
+          .args = folly::dynamic::object("detail", "{\"key\":1}")(
+              "data", folly::dynamic::object("rnStackTrace", "at foo")),
+      });
+  events.push_back(
+      TraceEventGenerator::createSetLayerTreeIdEvent(
+          "frame", 1, 1, 2, timestamp(1)));
+  auto [beginFrameEvent, drawFrameEvent] =
+      TraceEventGenerator::createFrameTimingsEvents(
+          7, 1, timestamp(10), timestamp(20), 1, 2);
+  events.push_back(std::move(beginFrameEvent));
+  events.push_back(std::move(drawFrameEvent));
+  events.push_back(
+      TraceEventGenerator::createScreenshotEvent(
+          7, 1, {0x89, 0x50, 0x4e, 0x47}, timestamp(20), 1, 2));
+  events.push_back(
+      createInstantEvent(
+          "Mark",
+          UserTimingMarkTraceEventArgs{.detail = "{\"key\":\"\\\"\"}"}));
+  events.push_back(
+      createInstantEvent(
+          "ResourceSendRequest",
+          ResourceSendRequestTraceEventArgs{
+              .requestId = "1",
+              .requestMethod = "GET",
+              .resourceType = "Fetch",
+              .url = "https://example.com/?q=\"",
+          }));
+  events.push_back(
+      createInstantEvent(
+          "ResourceReceiveResponse",
+          ResourceReceiveResponseTraceEventArgs{
+              .requestId = "1",
+              .encodedDataLength = 512,
+              .headers = folly::dynamic::array(
+                  folly::dynamic::object("name", "Content-Type")(
+                      "value", "text/plain")),
+              .mimeType = "text/plain",
+              .protocol = "h2",
+              .statusCode = 200,
+              .timing = folly::dynamic::object("requestTime", 1.5),
+          }));
+  events.push_back(
+      createInstantEvent(
+          "ResourceReceivedData",
+          ResourceReceivedDataTraceEventArgs{
+              .requestId = "1", .encodedDataLength = 256}));
+  events.push_back(
+      createInstantEvent(
+          "ResourceFinish",
+          ResourceFinishTraceEventArgs{
+              .requestId = "1",
+              .encodedDataLength = 512,
+              .decodedBodyLength = 1024,
+          }));
+  return events;
+}
+
+} // namespace
+
+TEST(TraceEventChunkWriterTest, SerializesSameJsonAsTraceEventSerializer) {
+  for (auto& event : createEvents()) {
+    std::string serializedEvent;
+    TraceEventChunkWriter::appendEvent(serializedEvent, event);
+
+    EXPECT_EQ(
+        folly::parseJson(serializedEvent),
+        TraceEventSerializer::serialize(std::move(event)))
+        << serializedEvent;
+  }
+}
+
+TEST(TraceEventChunkWriterTest, SplitsEventsInChunksOfAtMostMaxBytes) {
+  constexpr size_t MAX_CHUNK_BYTES = 1000;
+  constexpr int EVENTS_COUNT = 500;
+
+  std::vector<std::string> chunks;
+  TraceEventChunkWriter writer(
+      MAX_CHUNK_BYTES,
+      [&](std::string&& chunk) { chunks.push_back(std::move(chunk)); });
+  for (int index = 0; index < EVENTS_COUNT; index++) {
+    writer.write(createEvent(index));
+  }
+  writer.flush();
+
+  ASSERT_GT(chunks.size(), 1);
+  int expectedIndex = 0;
+  std::vector<int> firstIndices;
+  for (const auto& chunk : chunks) {
+    EXPECT_LE(chunk.size(), MAX_CHUNK_BYTES);
+    auto events = folly::parseJson(chunk);
+    ASSERT_TRUE(events.isArray());
+    firstIndices.push_back(expectedIndex);
+    for (const auto& event : events) {
+      EXPECT_EQ(event["name"], "Event" + std::to_string(expectedIndex++));
+    }
+  }
+  EXPECT_EQ(expectedIndex, EVENTS_COUNT);
+
+  // The first event of each chunk would not have fit in the previous one.
+  for (size_t index = 1; index < chunks.size(); index++) {
+    std::string serializedEvent;
+    TraceEventChunkWriter::appendEvent(
+        serializedEvent, createEvent(firstIndices[index]));
+    EXPECT_GT(
+        chunks[index - 1].size() + serializedEvent.size() + 1,
+        MAX_CHUNK_BYTES);
+  }
+}
+
+TEST(TraceEventChunkWriterTest, KeepsGroupsInTheSameChunk) {
+  std::string serializedEvent;
+  TraceEventChunkWriter::appendEvent(serializedEvent, createEvent(0));
+  auto maxChunkBytes = serializedEvent.size() * 4;
+
+  std::vector<std::string> chunks;
+  TraceEventChunkWriter writer(maxChunkBytes, [&](std::string&& chunk) {
+    chunks.push_back(std::move(chunk));
+  });
+  writer.write(createEvent(0));
+  writer.write(createEvent(1));
+  writer.beginGroup();
+  writer.write(createEvent(2));
+  writer.write(createEvent(3));
+  writer.write(createEvent(4));
+  writer.endGroup();
+  writer.flush();
+
+  ASSERT_EQ(chunks.size(), 2);
+  EXPECT_EQ(folly::parseJson(chunks[0]).size(), 2);
+  EXPECT_EQ(folly::parseJson(chunks[1]).size(), 3);
+}
+
+TEST(TraceEventChunkWriterTest, EmitsOversizedEventsInTheirOwnChunk) {
+  std::vector<std::string> chunks;
+  TraceEventChunkWriter writer(
+      64, [&](std::string&& chunk) { chunks.push_back(std::move(chunk)); });
+  writer.write(createEvent(0));
+  writer.write(createEvent(1));
+  writer.flush();
+  writer.flush();
+
+  ASSERT_EQ(chunks.size(), 2);
+  EXPECT_EQ(folly::parseJson(chunks[0])[0]["name"], "Event0");
+  EXPECT_EQ(folly::parseJson(chunks[1])[0]["name"], "Event1");
+}
+
+} // namespace facebook::react::jsinspector_modern::tracing
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsinspector-modern/tracing/PerformanceTracer.h>
+#include <mutex>
+#include <vector>
+
+namespace facebook::react::jsinspector_modern::tracing {
+
+namespace {
+
+// Every reported event is kept until tracing stops, this bounds the memory
+// used by a run.
+constexpr int64_t EVENTS_PER_THREAD = 100000;
+
+/*
+ * The previous approach: all threads report to a single buffer guarded by a
+ * mutex.
+ */
+class MutexEventBuffer {
+ public:
+  void reportEventLoopTask(HighResTimeStamp start, HighResTimeStamp end) {
+    std::lock_guard lock(mutex_);
+    events_.push_back({start, end, HighResTimeStamp::now()});
+  }
+
+  void clear() {
+    std::lock_guard lock(mutex_);
+    events_.clear();
+  }
+
+ private:
+  struct Event {
+    HighResTimeStamp start;
+    HighResTimeStamp end;
+    HighResTimeStamp createdAt;
+  };
+
+  std::mutex mutex_;
+  std::vector<Event> events_;
+};
+
+void reportEventLoopTaskWithMutex(benchmark::State& state) {
+  static MutexEventBuffer buffer;
+  for (auto _ : state) {
+    auto now = HighResTimeStamp::now();
+    buffer.reportEventLoopTask(now, now);
+  }
+  if (state.thread_index() == 0) {
+    buffer.clear();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(reportEventLoopTaskWithMutex)
+    ->ThreadRange(1, 8)
+    ->Iterations(EVENTS_PER_THREAD)
+    ->UseRealTime();
+
+void reportEventLoopTask(benchmark::State& state) {
+  auto& tracer = PerformanceTracer::getInstance();
+  if (state.thread_index() == 0) {
+    tracer.startTracing();
+  }
+  for (auto _ : state) {
+    auto now = HighResTimeStamp::now();
+    tracer.reportEventLoopTask(now, now);
+  }
+  if (state.thread_index() == 0) {
+    benchmark::DoNotOptimize(tracer.stopTracing());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(reportEventLoopTask)
+    ->ThreadRange(1, 8)
+    ->Iterations(EVENTS_PER_THREAD)
+    ->UseRealTime();
+
+void reportMark(benchmark::State& state) {
+  auto& tracer = PerformanceTracer::getInstance();
+  if (state.thread_index() == 0) {
+    tracer.startTracing();
+  }
+  for (auto _ : state) {
+    tracer.reportMark("ReactNative-Mark", HighResTimeStamp::now());
+  }
+  if (state.thread_index() == 0) {
+    benchmark::DoNotOptimize(tracer.stopTracing());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(reportMark)
+    ->ThreadRange(1, 8)
+    ->Iterations(EVENTS_PER_THREAD)
+    ->UseRealTime();
+
+} // namespace
+
+} // namespace facebook::react::jsinspector_modern::tracing
+
+BENCHMARK_MAIN();
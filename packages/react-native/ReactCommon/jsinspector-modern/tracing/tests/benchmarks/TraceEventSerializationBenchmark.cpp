@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/json.h>
+#include <jsinspector-modern/tracing/Timing.h>
+#include <jsinspector-modern/tracing/TraceEventChunkWriter.h>
+#include <jsinspector-modern/tracing/TraceEventGenerator.h>
+#include <jsinspector-modern/tracing/TraceEventSerializer.h>
+#include <string>
+#include <vector>
+
+namespace facebook::react::jsinspector_modern::tracing {
+
+namespace {
+
+constexpr size_t MAX_CHUNK_BYTES = 10 * 1024 * 1024; // 10 MiB
+
+/*
+ * Events in the proportions of a trace of a busy app: event loop tasks
+ * without arguments, console.timeStamp entries and frame timings.
+ */
+std::vector<TraceEvent> createEvents(int64_t count) {
+  std::vector<TraceEvent> events;
+  events.reserve(count);
+  for (int64_t index = 0; events.size() < static_cast<size_t>(count);
+       index++) {
+    auto timestamp =
+        TRACING_TIME_ORIGIN + HighResDuration::fromNanoseconds(index * 1000);
+    switch (index % 4) {
+      case 0:
+        events.push_back(
+            TraceEvent{
+                .name = "RunTask",
+                .cat = {Category::HiddenTimeline},
+                .ph = 'X',
+                .ts = timestamp,
+                .pid = 1,
+                .tid = 2,
+                .dur = HighResDuration::fromNanoseconds(500),
+            });
+        break;
+      case 1:
+        events.push_back(
+            TraceEvent{
+                .name = "TimeStamp",
+                .cat = {Category::Timeline},
+                .ph = 'I',
+                .ts = timestamp,
+                .pid = 1,
+                .tid = 2,
+                .args = folly::dynamic::object(
+                    "data",
+                    folly::dynamic::object("name", "Render")(
+                        "message", "Render")("start", index)("end", index + 1)(
+                        "track", "Components ⚛")),
+            });
+        break;
+      default: {
+        auto [beginFrameEvent, drawFrameEvent] =
+            TraceEventGenerator::createFrameTimingsEvents(
+                index, 1, timestamp, timestamp, 1, 2);
+        events.push_back(std::move(beginFrameEvent));
+        events.push_back(std::move(drawFrameEvent));
+        break;
+      }
+    }
+  }
+  events.erase(events.begin() + count, events.end());
+  return events;
+}
+
+/*
+ * The previous implementation: every event is converted into a folly::dynamic
+ * object, with an estimated size, and each chunk is serialized as a whole.
+ */
+void serializeThroughDynamic(benchmark::State& state) {
+  auto events = createEvents(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto eventsCopy = events;
+    state.ResumeTiming();
+
+    size_t serializedBytes = 0;
+    folly::dynamic chunk = folly::dynamic::array();
+    size_t currentChunkBytes = 0;
+    for (auto& event : eventsCopy) {
+      auto serializedEvent = TraceEventSerializer::serialize(std::move(event));
+      size_t eventBytes =
+          TraceEventSerializer::estimateJsonSize(serializedEvent);
+      if (currentChunkBytes + eventBytes > MAX_CHUNK_BYTES && !chunk.empty()) {
+        serializedBytes += folly::toJson(chunk).size();
+        chunk = folly::dynamic::array();
+        currentChunkBytes = 0;
+      }
+      chunk.push_back(std::move(serializedEvent));
+      currentChunkBytes += eventBytes;
+    }
+    if (!chunk.empty()) {
+      serializedBytes += folly::toJson(chunk).size();
+    }
+    benchmark::DoNotOptimize(serializedBytes);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(serializeThroughDynamic)->Arg(10000)->Arg(100000);
+
+void serializeWithChunkWriter(benchmark::State& state) {
+  auto events = createEvents(state.range(0));
+  for (auto _ : state) {
+    size_t serializedBytes = 0;
+    TraceEventChunkWriter writer(
+        MAX_CHUNK_BYTES,
+        [&](std::string&& chunk) { serializedBytes += chunk.size(); });
+    for (const auto& event : events) {
+      writer.write(event);
+    }
+    writer.flush();
+    benchmark::DoNotOptimize(serializedBytes);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(serializeWithChunkWriter)->Arg(10000)->Arg(100000);
+
+} // namespace
+
+} // namespace facebook::react::jsinspector_modern::tracing
+
+BENCHMARK_MAIN();
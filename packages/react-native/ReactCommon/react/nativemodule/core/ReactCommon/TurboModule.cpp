@@ -39,6 +39,34 @@ TurboModule::TurboModule(
     std::shared_ptr<CallInvoker> jsInvoker)
     : name_(std::move(name)), jsInvoker_(std::move(jsInvoker)) {}
 
+jsi::Value TurboModule::createMethodsOnJsRepresentation(
+    jsi::Runtime& runtime,
+    const jsi::PropNameID& propName) {
+  auto jsRepresentation = jsRepresentation_->lock(runtime);
+  if (!jsRepresentation.isObject()) {
+    return jsi::Value::undefined();
+  }
+
+  auto jsRepresentationObject = jsRepresentation.asObject(runtime);
+  auto propNameUtf8 = propName.utf8(runtime);
+  jsi::Value requestedMethod = jsi::Value::undefined();
+  for (const auto& [methodName, meta] : methodMap_) {
+    auto methodPropName = jsi::PropNameID::forUtf8(runtime, methodName);
+    jsi::Value method = meta.invoker != nullptr
+        ? jsi::Value(createHostFunction(runtime, methodPropName, meta))
+        : create(runtime, methodPropName);
+    if (method.isUndefined()) {
+      continue;
+    }
+    if (requestedMethod.isUndefined() && methodName == propNameUtf8) {
+      requestedMethod = jsi::Value(runtime, method);
+    }
+    jsRepresentationObject.setProperty(
+        runtime, methodPropName, std::move(method));
+  }
+  return requestedMethod;
+}
+
 void TurboModule::emitDeviceEvent(
     const std::string& eventName,
     ArgFactory&& argFactory) {
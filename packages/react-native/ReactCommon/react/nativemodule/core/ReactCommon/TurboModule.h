@@ -54,6 +54,15 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
   // between RTTI and non-RTTI compilation units
   jsi::Value get(jsi::Runtime &runtime, const jsi::PropNameID &propName) override
   {
+    // The first lookup creates all methods at once, so that startup code
+    // touching many methods doesn't go through this HostObject for each one.
+    if (jsRepresentation_ && !jsRepresentationHasMethods_) {
+      jsRepresentationHasMethods_ = true;
+      if (auto method = createMethodsOnJsRepresentation(runtime, propName); !method.isUndefined()) {
+        return method;
+      }
+    }
+
     auto prop = create(runtime, propName);
     // If we have a JS wrapper, cache the result of this lookup
     // We don't cache misses, to allow for methodMap_ to dynamically be
@@ -117,15 +126,7 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
   {
     std::string propNameUtf8 = propName.utf8(runtime);
     if (auto methodIter = methodMap_.find(propNameUtf8); methodIter != methodMap_.end()) {
-      const MethodMetadata &meta = methodIter->second;
-      return jsi::Function::createFromHostFunction(
-          runtime,
-          propName,
-          static_cast<unsigned int>(meta.argCount),
-          [this, meta](
-              jsi::Runtime &rt, [[maybe_unused]] const jsi::Value &thisVal, const jsi::Value *args, size_t count) {
-            return meta.invoker(rt, *this, args, count);
-          });
+      return createHostFunction(runtime, propName, methodIter->second);
     } else if (auto eventEmitterIter = eventEmitterMap_.find(propNameUtf8);
                eventEmitterIter != eventEmitterMap_.end()) {
       return eventEmitterIter->second->get(runtime, jsInvoker_);
@@ -138,6 +139,27 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
  private:
   friend class TurboModuleBinding;
   std::unique_ptr<jsi::WeakObject> jsRepresentation_;
+  // Whether the methods in methodMap_ were cached on jsRepresentation_.
+  bool jsRepresentationHasMethods_{false};
+
+  jsi::Function createHostFunction(jsi::Runtime &runtime, const jsi::PropNameID &propName, const MethodMetadata &meta)
+  {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        propName,
+        static_cast<unsigned int>(meta.argCount),
+        [this, meta](
+            jsi::Runtime &rt, [[maybe_unused]] const jsi::Value &thisVal, const jsi::Value *args, size_t count) {
+          return meta.invoker(rt, *this, args, count);
+        });
+  }
+
+  /**
+   * Creates every method in methodMap_ and caches it on the JS representation.
+   * Methods without an invoker (e.g. those of interop modules) are created
+   * through `create`. Returns the method named \p propName, if any.
+   */
+  jsi::Value createMethodsOnJsRepresentation(jsi::Runtime &runtime, const jsi::PropNameID &propName);
 };
 
 /**
@@ -197,6 +197,7 @@ jsi::Value TurboModuleBinding::getModule(
     jsi::Object jsRepresentation(runtime);
     weakJsRepresentation =
         std::make_unique<jsi::WeakObject>(runtime, jsRepresentation);
+    module->jsRepresentationHasMethods_ = false;
 
     // Lazily populate the jsRepresentation, on property access.
     //
@@ -206,7 +207,8 @@ jsi::Value TurboModuleBinding::getModule(
     //   search jsRepresentation's prototype: jsi::Object(TurboModule).
     //   3. TurboModule::get(runtime, propKey) executes. This creates the
     //   property, caches it on jsRepresentation, then returns it to
-    //   JavaScript.
+    //   JavaScript. The first lookup also caches every method of the module,
+    //   so later method lookups are resolved by jsRepresentation itself.
     auto hostObject =
         jsi::Object::createFromHostObject(runtime, std::move(module));
     jsRepresentation.setProperty(runtime, "__proto__", std::move(hostObject));
@@ -44,62 +44,24 @@ JavaInteropTurboModule::JavaInteropTurboModule(
       methodDescriptors_(methodDescriptors),
       methodIDs_(methodDescriptors.size()),
       constantsCache_(jsi::Value::undefined()) {
-  for (const auto& methodDescriptor : methodDescriptors) {
+  methodDescriptorIndices_.reserve(methodDescriptors.size());
+  for (size_t i = 0; i < methodDescriptors.size(); i += 1) {
+    const auto& methodDescriptor = methodDescriptors[i];
     methodMap_[methodDescriptor.methodName] = MethodMetadata{
         .argCount = static_cast<size_t>(methodDescriptor.jsArgCount),
         .invoker = nullptr};
+    methodDescriptorIndices_.emplace(methodDescriptor.methodName, i);
   }
 }
 
 jsi::Value JavaInteropTurboModule::create(
     jsi::Runtime& runtime,
     const jsi::PropNameID& propName) {
-  for (size_t i = 0; i < methodDescriptors_.size(); i += 1) {
-    if (methodDescriptors_[i].methodName == propName.utf8(runtime)) {
-      if (propName.utf8(runtime) == "getConstants") {
-        return jsi::Function::createFromHostFunction(
-            runtime,
-            propName,
-            static_cast<unsigned int>(methodDescriptors_[i].jsArgCount),
-            [this, i](
-                jsi::Runtime& rt,
-                const jsi::Value& /*thisVal*/,
-                const jsi::Value* args,
-                size_t count) mutable {
-              if (!this->constantsCache_.isUndefined()) {
-                return jsi::Value(rt, this->constantsCache_);
-              }
-
-              jsi::Value ret = this->invokeJavaMethod(
-                  rt,
-                  this->methodDescriptors_[i].jsiReturnKind,
-                  this->methodDescriptors_[i].methodName,
-                  this->methodDescriptors_[i].jniSignature,
-                  args,
-                  count,
-                  this->methodIDs_[i]);
-
-              bool isRetValid = ret.isUndefined() || ret.isNull() ||
-                  (ret.isObject() && !ret.asObject(rt).isFunction(rt));
-
-              if (!isRetValid) {
-                throw new jsi::JSError(
-                    rt,
-                    "Expected NativeModule " + this->name_ +
-                        ".getConstants() to return: null, undefined, or an object. But, got: " +
-                        getType(rt, ret));
-              }
-
-              if (ret.isUndefined() || ret.isNull()) {
-                this->constantsCache_ = jsi::Object(rt);
-              } else {
-                this->constantsCache_ = jsi::Value(rt, ret);
-              }
-
-              return ret;
-            });
-      }
-
+  std::string propNameUtf8 = propName.utf8(runtime);
+  if (auto indexIter = methodDescriptorIndices_.find(propNameUtf8);
+      indexIter != methodDescriptorIndices_.end()) {
+    size_t i = indexIter->second;
+    if (propNameUtf8 == "getConstants") {
       return jsi::Function::createFromHostFunction(
           runtime,
           propName,
@@ -108,8 +70,12 @@ jsi::Value JavaInteropTurboModule::create(
               jsi::Runtime& rt,
               const jsi::Value& /*thisVal*/,
               const jsi::Value* args,
-              size_t count) {
-            return this->invokeJavaMethod(
+              size_t count) mutable {
+            if (!this->constantsCache_.isUndefined()) {
+              return jsi::Value(rt, this->constantsCache_);
+            }
+
+            jsi::Value ret = this->invokeJavaMethod(
                 rt,
                 this->methodDescriptors_[i].jsiReturnKind,
                 this->methodDescriptors_[i].methodName,
@@ -117,8 +83,46 @@ jsi::Value JavaInteropTurboModule::create(
                 args,
                 count,
                 this->methodIDs_[i]);
+
+            bool isRetValid = ret.isUndefined() || ret.isNull() ||
+                (ret.isObject() && !ret.asObject(rt).isFunction(rt));
+
+            if (!isRetValid) {
+              throw new jsi::JSError(
+                  rt,
+                  "Expected NativeModule " + this->name_ +
+                      ".getConstants() to return: null, undefined, or an object. But, got: " +
+                      getType(rt, ret));
+            }
+
+            if (ret.isUndefined() || ret.isNull()) {
+              this->constantsCache_ = jsi::Object(rt);
+            } else {
+              this->constantsCache_ = jsi::Value(rt, ret);
+            }
+
+            return ret;
           });
     }
+
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        propName,
+        static_cast<unsigned int>(methodDescriptors_[i].jsArgCount),
+        [this, i](
+            jsi::Runtime& rt,
+            const jsi::Value& /*thisVal*/,
+            const jsi::Value* args,
+            size_t count) {
+          return this->invokeJavaMethod(
+              rt,
+              this->methodDescriptors_[i].jsiReturnKind,
+              this->methodDescriptors_[i].methodName,
+              this->methodDescriptors_[i].jniSignature,
+              args,
+              count,
+              this->methodIDs_[i]);
+        });
   }
 
   jsi::Object constants = getConstants(runtime).asObject(runtime);
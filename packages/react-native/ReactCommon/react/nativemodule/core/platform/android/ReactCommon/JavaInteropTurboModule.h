@@ -10,6 +10,7 @@
 #ifndef RCT_REMOVE_LEGACY_MODULE_INTEROP
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <ReactCommon/TurboModule.h>
@@ -40,6 +41,8 @@ class JSI_EXPORT JavaInteropTurboModule : public JavaTurboModule {
 
  private:
   std::vector<MethodDescriptor> methodDescriptors_;
+  // Index of each method in methodDescriptors_, by method name.
+  std::unordered_map<std::string, size_t> methodDescriptorIndices_;
   std::vector<jmethodID> methodIDs_;
   jsi::Value constantsCache_;
 
@@ -10,6 +10,7 @@
 #ifndef RCT_REMOVE_LEGACY_MODULE_INTEROP
 
 #import <string>
+#import <unordered_map>
 #import <vector>
 
 #import <ReactCommon/TurboModule.h>
@@ -79,6 +80,8 @@ class JSI_EXPORT ObjCInteropTurboModule : public ObjCTurboModule {
 
  private:
   std::vector<MethodDescriptor> methodDescriptors_;
+  // Index of each method in methodDescriptors_, by method name.
+  std::unordered_map<std::string, size_t> methodDescriptorIndices_;
   NSDictionary<NSString *, NSArray<NSString *> *> *methodArgumentTypeNames_;
   jsi::Value constantsCache_;
   std::unordered_set<std::string> warnedModuleInvocation_;
@@ -255,74 +255,79 @@ ObjCInteropTurboModule::ObjCInteropTurboModule(const ObjCTurboModule::InitParams
       });
     }
   }
+
+  methodDescriptorIndices_.reserve(methodDescriptors_.size());
+  for (size_t i = 0; i < methodDescriptors_.size(); i += 1) {
+    methodDescriptorIndices_.emplace(methodDescriptors_[i].methodName, i);
+  }
 }
 
 jsi::Value ObjCInteropTurboModule::create(jsi::Runtime &runtime, const jsi::PropNameID &propName)
 {
-  for (size_t i = 0; i < methodDescriptors_.size(); i += 1) {
-    if (methodDescriptors_[i].methodName == propName.utf8(runtime)) {
-      if (propName.utf8(runtime) == "getConstants") {
-        return jsi::Function::createFromHostFunction(
-            runtime,
-            propName,
-            static_cast<unsigned int>(methodDescriptors_[i].jsArgCount),
-            [this, i](jsi::Runtime &rt, const jsi::Value &thisVal, const jsi::Value *args, size_t count) mutable {
-              if (!this->constantsCache_.isUndefined()) {
-                return jsi::Value(rt, this->constantsCache_);
-              }
-              const std::string &methodName = this->methodDescriptors_[i].methodName;
-              NSString *moduleName = [[this->instance_ class] description];
-              this->_logLegacyArchitectureWarning(moduleName, methodName);
-
-              // TODO: Dispatch getConstants to the main queue, if the module requires main queue setup
-              jsi::Value ret = this->invokeObjCMethod(
-                  rt,
-                  this->methodDescriptors_[i].jsReturnKind,
-                  methodName,
-                  this->methodDescriptors_[i].selector,
-                  args,
-                  count);
-
-              bool isRetValid = ret.isUndefined() || ret.isNull() ||
-                  (ret.isObject() && !ret.asObject(rt).isFunction(rt) && !ret.asObject(rt).isArray(rt));
-
-              if (!isRetValid) {
-                std::string methodJsSignature = name_ + ".getConstants()";
-                std::string errorPrefix = methodJsSignature + ": ";
-                throw jsi::JSError(
-                    rt,
-                    errorPrefix + "Expected return value to be null, undefined, or a plain object. But, got: " +
-                        getType(rt, ret));
-              }
-
-              if (ret.isUndefined() || ret.isNull()) {
-                this->constantsCache_ = jsi::Object(rt);
-              } else {
-                this->constantsCache_ = jsi::Value(rt, ret);
-              }
-
-              return ret;
-            });
-      }
-
+  std::string propNameUtf8 = propName.utf8(runtime);
+  if (auto indexIter = methodDescriptorIndices_.find(propNameUtf8); indexIter != methodDescriptorIndices_.end()) {
+    size_t i = indexIter->second;
+    if (propNameUtf8 == "getConstants") {
       return jsi::Function::createFromHostFunction(
           runtime,
           propName,
           static_cast<unsigned int>(methodDescriptors_[i].jsArgCount),
-          [this, i](jsi::Runtime &rt, const jsi::Value &thisVal, const jsi::Value *args, size_t count) {
+          [this, i](jsi::Runtime &rt, const jsi::Value &thisVal, const jsi::Value *args, size_t count) mutable {
+            if (!this->constantsCache_.isUndefined()) {
+              return jsi::Value(rt, this->constantsCache_);
+            }
             const std::string &methodName = this->methodDescriptors_[i].methodName;
             NSString *moduleName = [[this->instance_ class] description];
             this->_logLegacyArchitectureWarning(moduleName, methodName);
 
-            return this->invokeObjCMethod(
+            // TODO: Dispatch getConstants to the main queue, if the module requires main queue setup
+            jsi::Value ret = this->invokeObjCMethod(
                 rt,
                 this->methodDescriptors_[i].jsReturnKind,
                 methodName,
                 this->methodDescriptors_[i].selector,
                 args,
                 count);
+
+            bool isRetValid = ret.isUndefined() || ret.isNull() ||
+                (ret.isObject() && !ret.asObject(rt).isFunction(rt) && !ret.asObject(rt).isArray(rt));
+
+            if (!isRetValid) {
+              std::string methodJsSignature = name_ + ".getConstants()";
+              std::string errorPrefix = methodJsSignature + ": ";
+              throw jsi::JSError(
+                  rt,
+                  errorPrefix + "Expected return value to be null, undefined, or a plain object. But, got: " +
+                      getType(rt, ret));
+            }
+
+            if (ret.isUndefined() || ret.isNull()) {
+              this->constantsCache_ = jsi::Object(rt);
+            } else {
+              this->constantsCache_ = jsi::Value(rt, ret);
+            }
+
+            return ret;
           });
     }
+
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        propName,
+        static_cast<unsigned int>(methodDescriptors_[i].jsArgCount),
+        [this, i](jsi::Runtime &rt, const jsi::Value &thisVal, const jsi::Value *args, size_t count) {
+          const std::string &methodName = this->methodDescriptors_[i].methodName;
+          NSString *moduleName = [[this->instance_ class] description];
+          this->_logLegacyArchitectureWarning(moduleName, methodName);
+
+          return this->invokeObjCMethod(
+              rt,
+              this->methodDescriptors_[i].jsReturnKind,
+              methodName,
+              this->methodDescriptors_[i].selector,
+              args,
+              count);
+        });
   }
 
   jsi::Object constants = getConstants(runtime).asObject(runtime);
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <ReactCommon/TestCallInvoker.h>
+#include <ReactCommon/TurboModule.h>
+#include <ReactCommon/TurboModuleBinding.h>
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * A module with three methods, a method without an invoker that is created by
+ * `create` (like those of interop modules), an event emitter and a constant
+ * that isn't in methodMap_. Counts the calls to `create` per property name.
+ */
+class CountingTurboModule : public TurboModule {
+ public:
+  explicit CountingTurboModule(std::shared_ptr<CallInvoker> jsInvoker)
+      : TurboModule("CountingModule", std::move(jsInvoker)) {
+    for (const auto* methodName : {"method0", "method1", "method2"}) {
+      methodMap_[methodName] = MethodMetadata{
+          .argCount = 0,
+          .invoker = [](jsi::Runtime& /*rt*/,
+                        TurboModule& /*turboModule*/,
+                        const jsi::Value* /*args*/,
+                        size_t /*count*/) { return jsi::Value(42); },
+      };
+    }
+    methodMap_["interopMethod"] =
+        MethodMetadata{.argCount = 0, .invoker = nullptr};
+    eventEmitterMap_["onChange"] = std::make_shared<AsyncEventEmitter<>>();
+  }
+
+  int createCount(const std::string& propName) const {
+    auto it = createCounts_.find(propName);
+    return it == createCounts_.end() ? 0 : it->second;
+  }
+
+ protected:
+  jsi::Value create(jsi::Runtime& runtime, const jsi::PropNameID& propName)
+      override {
+    auto propNameUtf8 = propName.utf8(runtime);
+    createCounts_[propNameUtf8]++;
+    if (propNameUtf8 == "constant") {
+      return jsi::Value(7);
+    }
+    if (propNameUtf8 == "interopMethod") {
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          propName,
+          0,
+          [](jsi::Runtime& /*rt*/,
+             const jsi::Value& /*thisVal*/,
+             const jsi::Value* /*args*/,
+             size_t /*count*/) { return jsi::Value(24); });
+    }
+    return TurboModule::create(runtime, propName);
+  }
+
+ private:
+  std::unordered_map<std::string, int> createCounts_;
+};
+
+} // namespace
+
+class TurboModuleTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = hermes::makeHermesRuntime();
+    jsInvoker_ = std::make_shared<TestCallInvoker>(*runtime_);
+    module_ = std::make_shared<CountingTurboModule>(jsInvoker_);
+    // Like TurboModuleManager, the provider returns the same module instance
+    // every time, so it outlives its JS representations.
+    TurboModuleBinding::install(
+        *runtime_,
+        [module = module_](jsi::Runtime& /*runtime*/, const std::string& name)
+            -> std::shared_ptr<TurboModule> {
+          return name == "CountingModule" ? module : nullptr;
+        });
+  }
+
+  void TearDown() override {
+    module_ = nullptr;
+    jsInvoker_ = nullptr;
+    runtime_ = nullptr;
+  }
+
+  jsi::Value eval(const std::string& code) {
+    return runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(code), "test.js");
+  }
+
+  std::shared_ptr<jsi::Runtime> runtime_;
+  std::shared_ptr<TestCallInvoker> jsInvoker_;
+  std::shared_ptr<CountingTurboModule> module_;
+};
+
+TEST_F(TurboModuleTest, firstAccessCachesAllMethods) {
+  eval("var module = __turboModuleProxy('CountingModule');");
+
+  // Methods with an invoker are created straight from methodMap_, the others
+  // through `create`.
+  EXPECT_EQ(eval("module.method1()").getNumber(), 42);
+  EXPECT_EQ(module_->createCount("method0"), 0);
+  EXPECT_EQ(module_->createCount("method1"), 0);
+  EXPECT_EQ(module_->createCount("method2"), 0);
+  EXPECT_EQ(module_->createCount("interopMethod"), 1);
+
+  // All methods are own properties of the JS representation now, so they
+  // are resolved without going through the HostObject again.
+  EXPECT_TRUE(
+      eval("['method0', 'method1', 'method2', 'interopMethod'].every("
+           "  name => Object.prototype.hasOwnProperty.call(module, name))")
+          .getBool());
+  EXPECT_EQ(eval("module.method0() + module.method2()").getNumber(), 84);
+  EXPECT_EQ(eval("module.interopMethod()").getNumber(), 24);
+  EXPECT_EQ(module_->createCount("method0"), 0);
+  EXPECT_EQ(module_->createCount("method2"), 0);
+  EXPECT_EQ(module_->createCount("interopMethod"), 1);
+}
+
+TEST_F(TurboModuleTest, firstAccessOfMethodCreatedByCreate) {
+  eval("var module = __turboModuleProxy('CountingModule');");
+
+  EXPECT_EQ(eval("module.interopMethod()").getNumber(), 24);
+  EXPECT_EQ(module_->createCount("interopMethod"), 1);
+  EXPECT_EQ(eval("module.method0()").getNumber(), 42);
+  EXPECT_EQ(module_->createCount("method0"), 0);
+}
+
+TEST_F(TurboModuleTest, propertiesMissingFromMethodMapFallThroughToCreate) {
+  eval("var module = __turboModuleProxy('CountingModule');");
+
+  // The first access is not a method: the methods are cached anyway, and the
+  // event emitter is still created and cached on its own.
+  EXPECT_EQ(
+      eval("typeof module.onChange").getString(*runtime_).utf8(*runtime_),
+      "function");
+  EXPECT_EQ(module_->createCount("onChange"), 1);
+  EXPECT_TRUE(
+      eval("Object.prototype.hasOwnProperty.call(module, 'method0')")
+          .getBool());
+  EXPECT_TRUE(eval("module.onChange === module.onChange").getBool());
+  EXPECT_EQ(module_->createCount("onChange"), 1);
+
+  // Other properties defined by `create` are cached the same way.
+  EXPECT_EQ(eval("module.constant + module.constant").getNumber(), 14);
+  EXPECT_EQ(module_->createCount("constant"), 1);
+
+  // Misses are not cached, so methodMap_ can still be extended later.
+  EXPECT_TRUE(eval("module.missing").isUndefined());
+  EXPECT_TRUE(eval("module.missing").isUndefined());
+  EXPECT_EQ(module_->createCount("missing"), 2);
+
+  EXPECT_EQ(eval("module.method0()").getNumber(), 42);
+  EXPECT_EQ(module_->createCount("method0"), 0);
+}
+
+TEST_F(TurboModuleTest, firstAccessOfNewJsRepresentationCachesAllMethods) {
+  eval("__turboModuleProxy('CountingModule').method0();");
+  EXPECT_EQ(module_->createCount("interopMethod"), 1);
+
+  // Nothing retains the JS representation, so once it is collected the
+  // binding creates a new one for the same module.
+  runtime_->instrumentation().collectGarbage("test");
+
+  eval("var module = __turboModuleProxy('CountingModule');");
+  EXPECT_EQ(eval("module.method2()").getNumber(), 42);
+  EXPECT_EQ(module_->createCount("interopMethod"), 2);
+  EXPECT_EQ(module_->createCount("method2"), 0);
+  EXPECT_TRUE(
+      eval("Object.prototype.hasOwnProperty.call(module, 'method1')")
+          .getBool());
+}
+
+} // namespace facebook::react
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <ReactCommon/TestCallInvoker.h>
+#include <ReactCommon/TurboModule.h>
+#include <ReactCommon/TurboModuleBinding.h>
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+
+#include <memory>
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int METHODS_COUNT = 64;
+
+class BenchmarkTurboModule : public TurboModule {
+ public:
+  explicit BenchmarkTurboModule(std::shared_ptr<CallInvoker> jsInvoker)
+      : TurboModule("BenchmarkModule", std::move(jsInvoker)) {
+    for (int index = 0; index < METHODS_COUNT; index++) {
+      methodMap_["method" + std::to_string(index)] = MethodMetadata{
+          .argCount = 0,
+          .invoker = [](jsi::Runtime& /*rt*/,
+                        TurboModule& /*turboModule*/,
+                        const jsi::Value* /*args*/,
+                        size_t /*count*/) { return jsi::Value::undefined(); },
+      };
+    }
+  }
+};
+
+/*
+ * Simulates startup code: gets the module from a fresh runtime and looks up
+ * `state.range(0)` of its methods, twice.
+ */
+void lookUpModuleMethods(benchmark::State& state) {
+  std::string source =
+      "const module = __turboModuleProxy('BenchmarkModule');\n"
+      "for (let pass = 0; pass < 2; pass++) {\n"
+      "  for (let i = 0; i < " +
+      std::to_string(state.range(0)) +
+      "; i++) {\n"
+      "    module['method' + i];\n"
+      "  }\n"
+      "}\n";
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::shared_ptr<jsi::Runtime> runtime = hermes::makeHermesRuntime();
+    auto jsInvoker = std::make_shared<TestCallInvoker>(*runtime);
+    TurboModuleBinding::install(
+        *runtime,
+        [jsInvoker](jsi::Runtime& /*runtime*/, const std::string& name)
+            -> std::shared_ptr<TurboModule> {
+          if (name == "BenchmarkModule") {
+            return std::make_shared<BenchmarkTurboModule>(jsInvoker);
+          }
+          return nullptr;
+        });
+    auto preparedSource = runtime->prepareJavaScript(
+        std::make_shared<jsi::StringBuffer>(source), "benchmark.js");
+    state.ResumeTiming();
+
+    runtime->evaluatePreparedJavaScript(preparedSource);
+
+    state.PauseTiming();
+    runtime.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(lookUpModuleMethods)->Arg(1)->Arg(16)->Arg(METHODS_COUNT);
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -11,6 +11,7 @@
 #include <react/renderer/dom/DOM.h>
 #include <react/renderer/uimanager/PointerEventsProcessor.h>
 #include <react/renderer/uimanager/UIManagerBinding.h>
+#include <unordered_map>
 
 #ifdef RN_DISABLE_OSS_PLUGIN_HEADER
 #include "Plugins.h"
@@ -85,6 +86,33 @@ bool isRootShadowNode(const ShadowNode& shadowNode) {
   return shadowNode.getTraits().check(ShadowNodeTraits::Trait::RootNodeKind);
 }
 
+class Float64Buffer final : public jsi::MutableBuffer {
+ public:
+  explicit Float64Buffer(std::vector<double> values)
+      : values_(std::move(values)) {}
+
+  size_t size() const override {
+    return values_.size() * sizeof(double);
+  }
+
+  uint8_t* data() override {
+    return reinterpret_cast<uint8_t*>(values_.data());
+  }
+
+ private:
+  std::vector<double> values_;
+};
+
+jsi::Value createFloat64Array(
+    jsi::Runtime& runtime,
+    std::vector<double> values) {
+  auto arrayBuffer = jsi::ArrayBuffer(
+      runtime, std::make_shared<Float64Buffer>(std::move(values)));
+  return runtime.global()
+      .getPropertyAsFunction(runtime, "Float64Array")
+      .callAsConstructor(runtime, arrayBuffer);
+}
+
 } // namespace
 
 #pragma mark - NativeDOM
@@ -274,6 +302,47 @@ NativeDOM::getBoundingClientRect(
   return std::tuple{domRect.x, domRect.y, domRect.width, domRect.height};
 }
 
+jsi::Value NativeDOM::getBoundingClientRects(
+    jsi::Runtime& rt,
+    std::vector<std::shared_ptr<const ShadowNode>> shadowNodes,
+    bool includeTransform) {
+  constexpr size_t kValuesPerRect = 4;
+  auto values = std::vector<double>(shadowNodes.size() * kValuesPerRect);
+
+  // Nodes are measured against the current revision of their surface, so they
+  // are grouped by surface to walk each revision once.
+  auto indicesBySurfaceId =
+      std::unordered_map<SurfaceId, std::vector<size_t>>{};
+  for (size_t index = 0; index < shadowNodes.size(); index++) {
+    indicesBySurfaceId[shadowNodes[index]->getSurfaceId()].push_back(index);
+  }
+
+  for (const auto& [surfaceId, indices] : indicesBySurfaceId) {
+    auto currentRevision = getCurrentShadowTreeRevision(rt, surfaceId);
+    if (currentRevision == nullptr) {
+      continue;
+    }
+
+    auto surfaceShadowNodes = std::vector<std::shared_ptr<const ShadowNode>>{};
+    surfaceShadowNodes.reserve(indices.size());
+    for (auto index : indices) {
+      surfaceShadowNodes.push_back(shadowNodes[index]);
+    }
+
+    auto domRects = dom::getBoundingClientRects(
+        currentRevision, surfaceShadowNodes, includeTransform);
+    for (size_t i = 0; i < indices.size(); i++) {
+      auto* rectValues = values.data() + indices[i] * kValuesPerRect;
+      rectValues[0] = domRects[i].x;
+      rectValues[1] = domRects[i].y;
+      rectValues[2] = domRects[i].width;
+      rectValues[3] = domRects[i].height;
+    }
+  }
+
+  return createFloat64Array(rt, std::move(values));
+}
+
 std::tuple</* width: */ int, /* height: */ int> NativeDOM::getInnerSize(
     jsi::Runtime& rt,
     std::shared_ptr<const ShadowNode> shadowNode) {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #if __has_include("FBReactNativeSpecJSI.h") // CocoaPod headers on Apple
 #include "FBReactNativeSpecJSI.h"
@@ -58,6 +59,15 @@ class NativeDOM : public NativeDOMCxxSpec<NativeDOM> {
       /* height: */ double>
   getBoundingClientRect(jsi::Runtime &rt, std::shared_ptr<const ShadowNode> shadowNode, bool includeTransform);
 
+  /*
+   * Returns a `Float64Array` with `x`, `y`, `width` and `height` for each node
+   * in `shadowNodes`, like calling `getBoundingClientRect` for each of them.
+   */
+  jsi::Value getBoundingClientRects(
+      jsi::Runtime &rt,
+      std::vector<std::shared_ptr<const ShadowNode>> shadowNodes,
+      bool includeTransform);
+
   std::tuple</* width: */ int, /* height: */ int> getInnerSize(
       jsi::Runtime &rt,
       std::shared_ptr<const ShadowNode> shadowNode);
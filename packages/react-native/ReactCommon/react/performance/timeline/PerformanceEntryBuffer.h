@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <shared_mutex>
 #include <vector>
 #include "PerformanceEntry.h"
 
@@ -25,6 +26,13 @@ class PerformanceEntryBuffer {
   HighResDuration durationThreshold = DEFAULT_DURATION_THRESHOLD;
   size_t droppedEntriesCount{0};
 
+  /**
+   * Guards the entries of this buffer. Buffers of different entry types are
+   * locked independently, so that reporting entries of one type doesn't
+   * contend with reading or reporting entries of another type.
+   */
+  mutable std::shared_mutex mutex;
+
   explicit PerformanceEntryBuffer() = default;
   virtual ~PerformanceEntryBuffer() = default;
 
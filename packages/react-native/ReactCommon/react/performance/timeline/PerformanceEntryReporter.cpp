@@ -113,9 +113,10 @@ PerformanceEntryReporter::getSupportedEntryTypes() {
 
 uint32_t PerformanceEntryReporter::getDroppedEntriesCount(
     PerformanceEntryType entryType) const noexcept {
-  std::shared_lock lock(buffersMutex_);
+  const auto& buffer = getBuffer(entryType);
+  std::shared_lock lock(buffer.mutex);
 
-  return (uint32_t)getBuffer(entryType).droppedEntriesCount;
+  return (uint32_t)buffer.droppedEntriesCount;
 }
 
 std::vector<PerformanceEntry> PerformanceEntryReporter::getEntries() const {
@@ -126,10 +127,10 @@ std::vector<PerformanceEntry> PerformanceEntryReporter::getEntries() const {
 
 void PerformanceEntryReporter::getEntries(
     std::vector<PerformanceEntry>& dest) const {
-  std::shared_lock lock(buffersMutex_);
-
   for (auto entryType : getSupportedEntryTypes()) {
-    getBuffer(entryType).getEntries(dest);
+    const auto& buffer = getBuffer(entryType);
+    std::shared_lock lock(buffer.mutex);
+    buffer.getEntries(dest);
   }
 }
 
@@ -143,9 +144,10 @@ std::vector<PerformanceEntry> PerformanceEntryReporter::getEntries(
 void PerformanceEntryReporter::getEntries(
     std::vector<PerformanceEntry>& dest,
     PerformanceEntryType entryType) const {
-  std::shared_lock lock(buffersMutex_);
+  const auto& buffer = getBuffer(entryType);
+  std::shared_lock lock(buffer.mutex);
 
-  getBuffer(entryType).getEntries(dest);
+  buffer.getEntries(dest);
 }
 
 std::vector<PerformanceEntry> PerformanceEntryReporter::getEntries(
@@ -160,31 +162,34 @@ void PerformanceEntryReporter::getEntries(
     std::vector<PerformanceEntry>& dest,
     PerformanceEntryType entryType,
     const std::string& entryName) const {
-  std::shared_lock lock(buffersMutex_);
+  const auto& buffer = getBuffer(entryType);
+  std::shared_lock lock(buffer.mutex);
 
-  getBuffer(entryType).getEntries(dest, entryName);
+  buffer.getEntries(dest, entryName);
 }
 
 void PerformanceEntryReporter::clearEntries() {
-  std::unique_lock lock(buffersMutex_);
-
   for (auto entryType : getSupportedEntryTypes()) {
-    getBufferRef(entryType).clear();
+    auto& buffer = getBufferRef(entryType);
+    std::unique_lock lock(buffer.mutex);
+    buffer.clear();
   }
 }
 
 void PerformanceEntryReporter::clearEntries(PerformanceEntryType entryType) {
-  std::unique_lock lock(buffersMutex_);
+  auto& buffer = getBufferRef(entryType);
+  std::unique_lock lock(buffer.mutex);
 
-  getBufferRef(entryType).clear();
+  buffer.clear();
 }
 
 void PerformanceEntryReporter::clearEntries(
     PerformanceEntryType entryType,
     const std::string& entryName) {
-  std::unique_lock lock(buffersMutex_);
+  auto& buffer = getBufferRef(entryType);
+  std::unique_lock lock(buffer.mutex);
 
-  getBufferRef(entryType).clear(entryName);
+  buffer.clear(entryName);
 }
 
 void PerformanceEntryReporter::reportMark(
@@ -197,7 +202,7 @@ void PerformanceEntryReporter::reportMark(
 
   // Add to buffers & notify observers
   {
-    std::unique_lock lock(buffersMutex_);
+    std::unique_lock lock(markBuffer_.mutex);
     markBuffer_.add(entry);
   }
 
@@ -218,7 +223,7 @@ void PerformanceEntryReporter::reportMeasure(
 
   // Add to buffers & notify observers
   {
-    std::unique_lock lock(buffersMutex_);
+    std::unique_lock lock(measureBuffer_.mutex);
     measureBuffer_.add(entry);
   }
 
@@ -235,13 +240,29 @@ void PerformanceEntryReporter::reportMeasure(
   }
 }
 
+std::vector<std::pair<std::string, uint32_t>>
+PerformanceEntryReporter::getEventCounts() const {
+  std::shared_lock lock(eventCountsMutex_);
+
+  std::vector<std::pair<std::string, uint32_t>> eventCounts;
+  eventCounts.reserve(eventNameIds_.size());
+  for (const auto& [name, id] : eventNameIds_) {
+    eventCounts.emplace_back(
+        name, eventCounts_[id].load(std::memory_order_relaxed));
+  }
+  return eventCounts;
+}
+
 void PerformanceEntryReporter::clearEventCounts() {
+  std::unique_lock lock(eventCountsMutex_);
+
+  eventNameIds_.clear();
   eventCounts_.clear();
 }
 
 std::optional<HighResTimeStamp> PerformanceEntryReporter::getMarkTime(
     const std::string& markName) const {
-  std::shared_lock lock(buffersMutex_);
+  std::shared_lock lock(markBuffer_.mutex);
 
   if (auto it = markBuffer_.find(markName); it) {
     return std::visit(
@@ -259,7 +280,7 @@ void PerformanceEntryReporter::reportEvent(
     HighResTimeStamp processingEnd,
     HighResTimeStamp taskEndTime,
     uint32_t interactionId) {
-  eventCounts_[name]++;
+  countEvent(name);
 
   if (duration < eventBuffer_.durationThreshold) {
     // The entries duration is lower than the desired reporting threshold,
@@ -275,7 +296,7 @@ void PerformanceEntryReporter::reportEvent(
       interactionId};
 
   {
-    std::unique_lock lock(buffersMutex_);
+    std::unique_lock lock(eventBuffer_.mutex);
     eventBuffer_.add(entry);
   }
 
@@ -293,6 +314,24 @@ void PerformanceEntryReporter::reportEvent(
   }
 }
 
+void PerformanceEntryReporter::countEvent(const std::string& name) {
+  {
+    std::shared_lock lock(eventCountsMutex_);
+    if (auto it = eventNameIds_.find(name); it != eventNameIds_.end()) {
+      eventCounts_[it->second].fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+
+  // First event with this name since the counts were cleared.
+  std::unique_lock lock(eventCountsMutex_);
+  auto [it, inserted] = eventNameIds_.try_emplace(name, eventCounts_.size());
+  if (inserted) {
+    eventCounts_.emplace_back(0);
+  }
+  eventCounts_[it->second].fetch_add(1, std::memory_order_relaxed);
+}
+
 void PerformanceEntryReporter::reportLongTask(
     HighResTimeStamp startTime,
     HighResDuration duration) {
@@ -302,7 +341,7 @@ void PerformanceEntryReporter::reportLongTask(
        .duration = duration}};
 
   {
-    std::unique_lock lock(buffersMutex_);
+    std::unique_lock lock(longTaskBuffer_.mutex);
     longTaskBuffer_.add(entry);
   }
 
@@ -337,7 +376,7 @@ void PerformanceEntryReporter::reportResourceTiming(
 
   // Add to buffers & notify observers
   {
-    std::unique_lock lock(buffersMutex_);
+    std::unique_lock lock(resourceTimingBuffer_.mutex);
     resourceTimingBuffer_.add(entry);
   }
 
@@ -15,9 +15,12 @@
 #include <folly/dynamic.h>
 #include <react/timing/primitives.h>
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <optional>
 #include <shared_mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace facebook::react {
@@ -66,10 +69,11 @@ class PerformanceEntryReporter {
 
   uint32_t getDroppedEntriesCount(PerformanceEntryType type) const noexcept;
 
-  const std::unordered_map<std::string, uint32_t> &getEventCounts() const
-  {
-    return eventCounts_;
-  }
+  /**
+   * Returns the number of events reported for each event name, since the
+   * counts were last cleared.
+   */
+  std::vector<std::pair<std::string, uint32_t>> getEventCounts() const;
 
   void clearEventCounts();
 
@@ -113,14 +117,21 @@ class PerformanceEntryReporter {
  private:
   std::unique_ptr<PerformanceObserverRegistry> observerRegistry_;
 
-  mutable std::shared_mutex buffersMutex_;
+  // Each buffer is guarded by its own mutex (PerformanceEntryBuffer::mutex).
   PerformanceEntryCircularBuffer eventBuffer_{EVENT_BUFFER_SIZE};
   PerformanceEntryCircularBuffer longTaskBuffer_{LONG_TASK_BUFFER_SIZE};
   PerformanceEntryCircularBuffer resourceTimingBuffer_{RESOURCE_TIMING_BUFFER_SIZE};
   PerformanceEntryKeyedBuffer markBuffer_;
   PerformanceEntryKeyedBuffer measureBuffer_;
 
-  std::unordered_map<std::string, uint32_t> eventCounts_;
+  /**
+   * Event names are interned on their first report, after which counting an
+   * event only takes a shared lock and an atomic increment. The deque keeps
+   * the counters in place as new names are added.
+   */
+  mutable std::shared_mutex eventCountsMutex_;
+  std::unordered_map<std::string, size_t> eventNameIds_;
+  std::deque<std::atomic<uint32_t>> eventCounts_;
 
   mutable std::shared_mutex listenersMutex_;
   std::vector<PerformanceEntryReporterEventListener *> eventListeners_{};
@@ -165,6 +176,8 @@ class PerformanceEntryReporter {
     }
   }
 
+  void countEvent(const std::string &name);
+
   void traceMark(const PerformanceMark &entry, UserTimingDetailProvider &&detailProvider) const;
   void traceMeasure(const PerformanceMeasure &entry, const std::optional<UserTimingDetailProvider> &detailProvider)
       const;
@@ -11,7 +11,9 @@
 
 #include "../PerformanceEntryReporter.h"
 
+#include <algorithm>
 #include <array>
+#include <thread>
 #include <variant>
 
 using namespace facebook::react;
@@ -371,3 +373,44 @@ TEST(PerformanceEntryReporter, PerformanceEntryReporterTestClearMarks) {
     ASSERT_EQ(entries.size(), 0);
   }
 }
+
+TEST(PerformanceEntryReporter, PerformanceEntryReporterTestEventCounts) {
+  auto reporter = PerformanceEntryReporter::getInstance();
+  auto timeOrigin = HighResTimeStamp::now();
+
+  reporter->clearEventCounts();
+
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < 4; thread++) {
+    threads.emplace_back([&reporter, timeOrigin]() {
+      for (int index = 0; index < 100; index++) {
+        reporter->reportEvent(
+            index % 2 == 0 ? "click" : "keydown",
+            timeOrigin,
+            HighResDuration::zero(),
+            timeOrigin,
+            timeOrigin,
+            timeOrigin,
+            0);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  {
+    auto eventCounts = reporter->getEventCounts();
+    std::sort(eventCounts.begin(), eventCounts.end());
+    std::vector<std::pair<std::string, uint32_t>> expected = {
+        {"click", 200}, {"keydown", 200}};
+    ASSERT_EQ(expected, eventCounts);
+  }
+
+  reporter->clearEventCounts();
+
+  {
+    auto eventCounts = reporter->getEventCounts();
+    ASSERT_EQ(eventCounts.size(), 0);
+  }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/performance/timeline/PerformanceEntryReporter.h>
+
+namespace facebook::react {
+
+namespace {
+
+void reportEvent(PerformanceEntryReporter& reporter) {
+  auto now = HighResTimeStamp::now();
+  reporter.reportEvent(
+      "click",
+      now,
+      HighResDuration::fromMilliseconds(16),
+      now,
+      now,
+      now,
+      0);
+}
+
+void reportLongTask(PerformanceEntryReporter& reporter) {
+  reporter.reportLongTask(
+      HighResTimeStamp::now(), HighResDuration::fromMilliseconds(60));
+}
+
+/*
+ * All threads report Event Timing entries, which are counted and stored in
+ * the same buffer.
+ */
+void reportEvents(benchmark::State& state) {
+  auto& reporter = *PerformanceEntryReporter::getInstance();
+  for (auto _ : state) {
+    reportEvent(reporter);
+  }
+  if (state.thread_index() == 0) {
+    reporter.clearEntries();
+    reporter.clearEventCounts();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(reportEvents)->ThreadRange(1, 8)->UseRealTime();
+
+/*
+ * Half of the threads report Event Timing entries while the other half report
+ * long tasks, which are stored in a different buffer.
+ */
+void reportEventsAndLongTasks(benchmark::State& state) {
+  auto& reporter = *PerformanceEntryReporter::getInstance();
+  bool reportsEvents = state.thread_index() % 2 == 0;
+  for (auto _ : state) {
+    if (reportsEvents) {
+      reportEvent(reporter);
+    } else {
+      reportLongTask(reporter);
+    }
+  }
+  if (state.thread_index() == 0) {
+    reporter.clearEntries();
+    reporter.clearEventCounts();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(reportEventsAndLongTasks)->ThreadRange(2, 8)->UseRealTime();
+
+/*
+ * Threads report events while others read the buffered entries, as
+ * PerformanceObserver does for buffered observers.
+ */
+void reportEventsWhileReadingEntries(benchmark::State& state) {
+  auto& reporter = *PerformanceEntryReporter::getInstance();
+  bool readsEntries = state.thread_index() == 0;
+  for (auto _ : state) {
+    if (readsEntries) {
+      benchmark::DoNotOptimize(
+          reporter.getEntries(PerformanceEntryType::LONGTASK));
+    } else {
+      reportEvent(reporter);
+    }
+  }
+  if (state.thread_index() == 0) {
+    reporter.clearEntries();
+    reporter.clearEventCounts();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(reportEventsWhileReadingEntries)->ThreadRange(2, 8)->UseRealTime();
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
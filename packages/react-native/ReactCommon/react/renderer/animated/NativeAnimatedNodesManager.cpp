@@ -44,26 +44,6 @@ void g_setNativeAnimatedNowTimestampFunction(TimePointFunction nowFunction) {
   g_now = nowFunction;
 }
 
-namespace {
-
-struct NodesQueueItem {
-  AnimatedNode* node;
-  bool connectedToFinishedAnimation;
-};
-
-void mergeObjects(folly::dynamic& out, const folly::dynamic& objectToMerge) {
-  react_native_assert(objectToMerge.isObject());
-  if (out.isObject() && !out.empty()) {
-    for (const auto& pair : objectToMerge.items()) {
-      out[pair.first] = pair.second;
-    }
-  } else {
-    out = objectToMerge;
-  }
-}
-
-} // namespace
-
 thread_local bool NativeAnimatedNodesManager::isOnRenderThread_{false};
 
 NativeAnimatedNodesManager::NativeAnimatedNodesManager(
@@ -191,6 +171,7 @@ void NativeAnimatedNodesManager::createAnimatedNode(
   if (node) {
     std::lock_guard<std::mutex> lock(connectedAnimatedNodesMutex_);
     animatedNodes_.emplace(tag, std::move(node));
+    graphOrder_.invalidate();
     updatedNodeTags_.insert(tag);
   }
 }
@@ -206,6 +187,7 @@ void NativeAnimatedNodesManager::connectAnimatedNodes(
 
   if ((parentNode != nullptr) && (childNode != nullptr)) {
     parentNode->addChild(childTag);
+    graphOrder_.invalidate();
     updatedNodeTags_.insert(childTag);
   } else {
     LOG(WARNING) << "Cannot ConnectAnimatedNodes, parentTag = " << parentTag
@@ -283,6 +265,7 @@ void NativeAnimatedNodesManager::disconnectAnimatedNodes(
 
   if ((parentNode != nullptr) && (childNode != nullptr)) {
     parentNode->removeChild(childTag);
+    graphOrder_.invalidate();
   } else {
     LOG(WARNING) << "Cannot DisconnectAnimatedNodes, parentTag = " << parentTag
                  << ", childTag = " << childTag
@@ -298,7 +281,9 @@ void NativeAnimatedNodesManager::restoreDefaultValues(Tag tag) noexcept {
 
 void NativeAnimatedNodesManager::dropAnimatedNode(Tag tag) noexcept {
   std::lock_guard<std::mutex> lock(connectedAnimatedNodesMutex_);
-  animatedNodes_.erase(tag);
+  if (animatedNodes_.erase(tag) != 0) {
+    graphOrder_.invalidate();
+  }
 }
 
 #pragma mark - Mutations
@@ -616,177 +601,51 @@ bool NativeAnimatedNodesManager::isAnimationUpdateNeeded() const noexcept {
 
 void NativeAnimatedNodesManager::updateNodes(
     const std::set<int>& finishedAnimationValueNodes) noexcept {
-  auto nodesQueue = std::deque<NodesQueueItem>{};
-
-  const auto is_node_connected_to_finished_animation =
-      [&finishedAnimationValueNodes](
-          AnimatedNode* node,
-          int nodeTag,
-          bool parentFinishedAnimation) -> bool {
-    return parentFinishedAnimation ||
-        (node->type() == AnimatedNodeType::Value &&
-         finishedAnimationValueNodes.contains(nodeTag));
-  };
-
-#ifdef REACT_NATIVE_DEBUG
-  int activeNodesCount = 0;
-  int updatedNodesCount = 0;
-#endif
-
-  // STEP 1.
-  // BFS over graph of nodes. Update `mIncomingNodes` attribute for each node
-  // during that BFS. Store number of visited nodes in `activeNodesCount`. We
-  // "execute" active animations as a part of this step.
-
-  animatedGraphBFSColor_++;
-  if (animatedGraphBFSColor_ == AnimatedNode::INITIAL_BFS_COLOR) {
-    animatedGraphBFSColor_++;
-  }
-
-  for (const auto& nodeTag : updatedNodeTags_) {
-    if (auto node = getAnimatedNode<AnimatedNode>(nodeTag)) {
-      if (node->bfsColor != animatedGraphBFSColor_) {
-        node->bfsColor = animatedGraphBFSColor_;
+  // The topological order of the graph is only rebuilt after nodes were
+  // created, dropped, connected or disconnected. Evaluating the nodes that
+  // depend on `updatedNodeTags_` is then a scan over the cached order of the
+  // components containing them: a node is only visited after all its
+  // "predecessors" have been, as nodes often use the values of their
+  // predecessors to calculate their own "next state".
+  if (!graphOrder_.isValid()) {
+    [[maybe_unused]] auto skippedNodesCount = graphOrder_.build(animatedNodes_);
+    graphStats_.orderRebuildsCount++;
 #ifdef REACT_NATIVE_DEBUG
-        activeNodesCount++;
-#endif
-        const auto connectedToFinishedAnimation =
-            is_node_connected_to_finished_animation(node, nodeTag, false);
-        nodesQueue.emplace_back(
-            NodesQueueItem{
-                .node = node,
-                .connectedToFinishedAnimation = connectedToFinishedAnimation});
-      }
+    // In Fabric there can be race conditions between the JS thread setting up
+    // or tearing down animated nodes, and Fabric executing them on the UI
+    // thread, leading to temporary inconsistent states.
+    if (skippedNodesCount > 0) {
+      LOG(ERROR) << "Detected animation cycle. Looks like animated nodes "
+                 << "graph has cycles, there are " << animatedNodes_.size()
+                 << " nodes but toposort ordered only " << graphOrder_.size();
     }
-  }
-
-  while (!nodesQueue.empty()) {
-    auto nextNode = nodesQueue.front();
-    nodesQueue.pop_front();
-    // in Animated, value nodes like RGBA are parents and Color node is child
-    // (the opposite of tree structure)
-    for (const auto childTag : nextNode.node->getChildren()) {
-      if (auto child = getAnimatedNode<AnimatedNode>(childTag)) {
-        child->activeIncomingNodes++;
-        if (child->bfsColor != animatedGraphBFSColor_) {
-          child->bfsColor = animatedGraphBFSColor_;
-#ifdef REACT_NATIVE_DEBUG
-          activeNodesCount++;
 #endif
-          const auto connectedToFinishedAnimation =
-              is_node_connected_to_finished_animation(
-                  child, childTag, nextNode.connectedToFinishedAnimation);
-          nodesQueue.emplace_back(
-              NodesQueueItem{
-                  .node = child,
-                  .connectedToFinishedAnimation =
-                      connectedToFinishedAnimation});
-        }
-      }
-    }
-  }
-
-  // STEP 2
-  // BFS over the graph of active nodes in topological order -> visit node only
-  // when all its "predecessors" in the graph have already been visited. It is
-  // important to visit nodes in that order as they may often use values of
-  // their predecessors in order to calculate "next state" of their own. We
-  // start by determining the starting set of nodes by looking for nodes with
-  // `activeIncomingNodes = 0` (those can only be the ones that we start BFS in
-  // the previous step). We store number of visited nodes in this step in
-  // `updatedNodesCount`
-
-  animatedGraphBFSColor_++;
-  if (animatedGraphBFSColor_ == AnimatedNode::INITIAL_BFS_COLOR) {
-    animatedGraphBFSColor_++;
   }
 
   for (const auto& nodeTag : updatedNodeTags_) {
-    if (auto node = getAnimatedNode<AnimatedNode>(nodeTag)) {
-      if (node->activeIncomingNodes == 0 &&
-          node->bfsColor != animatedGraphBFSColor_) {
-        node->bfsColor = animatedGraphBFSColor_;
-#ifdef REACT_NATIVE_DEBUG
-        updatedNodesCount++;
-#endif
-        const auto connectedToFinishedAnimation =
-            is_node_connected_to_finished_animation(node, nodeTag, false);
-        nodesQueue.emplace_back(
-            NodesQueueItem{
-                .node = node,
-                .connectedToFinishedAnimation = connectedToFinishedAnimation});
-      }
-    }
+    graphOrder_.markUpdated(nodeTag);
   }
 
-// Run main "update" loop
-#ifdef REACT_NATIVE_DEBUG
-  int cyclesDetected = 0;
-#endif
-  while (!nodesQueue.empty()) {
-    auto nextNode = nodesQueue.front();
-    nodesQueue.pop_front();
-    if (nextNode.connectedToFinishedAnimation &&
-        nextNode.node->type() == AnimatedNodeType::Props) {
-      if (auto propsNode = dynamic_cast<PropsAnimatedNode*>(nextNode.node)) {
-        propsNode->update(/*forceFabricCommit*/ true);
-      };
-    } else {
-      nextNode.node->update();
-    }
-
-    for (auto childTag : nextNode.node->getChildren()) {
-      if (auto child = getAnimatedNode<AnimatedNode>(childTag)) {
-        child->activeIncomingNodes--;
-        if (child->activeIncomingNodes == 0 &&
-            child->bfsColor != animatedGraphBFSColor_) {
-          child->bfsColor = animatedGraphBFSColor_;
-#ifdef REACT_NATIVE_DEBUG
-          updatedNodesCount++;
-#endif
-          const auto connectedToFinishedAnimation =
-              is_node_connected_to_finished_animation(
-                  child, childTag, nextNode.connectedToFinishedAnimation);
-          nodesQueue.emplace_back(
-              NodesQueueItem{
-                  .node = child,
-                  .connectedToFinishedAnimation =
-                      connectedToFinishedAnimation});
-        }
-#ifdef REACT_NATIVE_DEBUG
-        else if (child->bfsColor == animatedGraphBFSColor_) {
-          cyclesDetected++;
+  const auto evaluatedNodesCount = graphOrder_.evaluate(
+      [&finishedAnimationValueNodes](
+          AnimatedNode& node, bool connectedToFinishedAnimation) {
+        // in Animated, value nodes like RGBA are parents and Color node is
+        // child (the opposite of tree structure)
+        connectedToFinishedAnimation = connectedToFinishedAnimation ||
+            (node.type() == AnimatedNodeType::Value &&
+             finishedAnimationValueNodes.contains(node.tag()));
+
+        if (connectedToFinishedAnimation &&
+            node.type() == AnimatedNodeType::Props) {
+          static_cast<PropsAnimatedNode&>(node).update(
+              /*forceFabricCommit*/ true);
+        } else {
+          node.update();
         }
-#endif
-      }
-    }
-  }
-
-#ifdef REACT_NATIVE_DEBUG
-  // Verify that we've visited *all* active nodes. Throw otherwise as this could
-  // mean there is a cycle in animated node graph, or that the graph is only
-  // partially set up. We also take advantage of the fact that all active nodes
-  // are visited in the step above so that all the nodes properties
-  // `activeIncomingNodes` are set to zero. In Fabric there can be race
-  // conditions between the JS thread setting up or tearing down animated nodes,
-  // and Fabric executing them on the UI thread, leading to temporary
-  // inconsistent states.
-  if (activeNodesCount != updatedNodesCount) {
-    if (warnedAboutGraphTraversal_) {
-      return;
-    }
-    warnedAboutGraphTraversal_ = true;
-    auto reason = cyclesDetected > 0
-        ? ("cycles (" + std::to_string(cyclesDetected) + ")")
-        : "disconnected regions";
-    LOG(ERROR) << "Detected animation cycle or disconnected graph. "
-               << "Looks like animated nodes graph has " << reason
-               << ", there are " << activeNodesCount
-               << " but toposort visited only " << updatedNodesCount;
-  } else {
-    warnedAboutGraphTraversal_ = false;
-  }
-#endif
+        return connectedToFinishedAnimation;
+      });
+  graphStats_.lastEvaluatedNodesCount = evaluatedNodesCount;
+  graphStats_.totalEvaluatedNodesCount += evaluatedNodesCount;
 
   updatedNodeTags_.clear();
 }
@@ -795,9 +654,8 @@ bool NativeAnimatedNodesManager::onAnimationFrame(double timestamp) {
   // Run all active animations
   auto hasFinishedAnimations = false;
   std::set<int> finishedAnimationValueNodes;
+  animationDriverBatch_.runAnimationStep(activeAnimations_, timestamp);
   for (const auto& [_id, driver] : activeAnimations_) {
-    driver->runAnimationStep(timestamp);
-
     if (driver->getIsComplete()) {
       hasFinishedAnimations = true;
       finishedAnimationValueNodes.insert(driver->getAnimatedValueTag());
@@ -841,7 +699,7 @@ folly::dynamic NativeAnimatedNodesManager::getManagedProps(
         unsyncedDirectViewPropsMutex_);
     if (auto it = unsyncedDirectViewProps_.find(tag);
         it != unsyncedDirectViewProps_.end()) {
-      return it->second;
+      return it->second.toDynamic();
     }
   }
 
@@ -918,7 +776,7 @@ void NativeAnimatedNodesManager::stopListeningToAnimatedNodeValue(
 
 void NativeAnimatedNodesManager::schedulePropsCommit(
     Tag viewTag,
-    const folly::dynamic& props,
+    const AnimatedViewProps& props,
     bool layoutStyleUpdated,
     bool forceFabricCommit,
     ShadowNodeFamily::Weak shadowNodeFamily) noexcept {
@@ -930,7 +788,7 @@ void NativeAnimatedNodesManager::schedulePropsCommit(
         ? updateViewPropsForBackend_[viewTag]
         : updateViewPropsDirectForBackend_[viewTag];
     current.first = std::move(shadowNodeFamily);
-    mergeObjects(current.second, props);
+    current.second.merge(props);
     return;
   }
 
@@ -942,23 +800,24 @@ void NativeAnimatedNodesManager::schedulePropsCommit(
   if (fabricCommitCallback_ != nullptr &&
       (layoutStyleUpdated || forceFabricCommit ||
        directManipulationCallback_ == nullptr)) {
-    mergeObjects(updateViewProps_[viewTag], props);
+    updateViewProps_[viewTag].merge(props);
 
     // Must call direct manipulation to set final values on components.
-    mergeObjects(updateViewPropsDirect_[viewTag], props);
+    updateViewPropsDirect_[viewTag].merge(props);
   } else if (!layoutStyleUpdated && directManipulationCallback_ != nullptr) {
-    mergeObjects(updateViewPropsDirect_[viewTag], props);
+    updateViewPropsDirect_[viewTag].merge(props);
     if (!ReactNativeFeatureFlags::
             overrideBySynchronousMountPropsAtMountingAndroid()) {
       std::lock_guard<std::mutex> lock(unsyncedDirectViewPropsMutex_);
-      mergeObjects(unsyncedDirectViewProps_[viewTag], props);
+      unsyncedDirectViewProps_[viewTag].merge(props);
     }
   }
 }
 
 void NativeAnimatedNodesManager::insertMutations(
-    std::unordered_map<Tag, std::pair<ShadowNodeFamily::Weak, folly::dynamic>>&
-        updates,
+    std::unordered_map<
+        Tag,
+        std::pair<ShadowNodeFamily::Weak, AnimatedViewProps>>& updates,
     AnimationMutations& mutations,
     AnimatedPropsBuilder& propsBuilder,
     bool hasLayoutUpdates) {
@@ -966,7 +825,7 @@ void NativeAnimatedNodesManager::insertMutations(
     auto weakFamily = update.first;
 
     if (auto family = weakFamily.lock()) {
-      propsBuilder.storeDynamic(update.second);
+      update.second.storeInto(propsBuilder);
       if (shouldRequestAsyncFlush_.contains(tag)) {
         mutations.asyncFlushSurfaces.insert(family->getSurfaceId());
       }
@@ -989,9 +848,8 @@ AnimationMutations NativeAnimatedNodesManager::onAnimationFrameForBackend(
   // Run all active animations
   auto hasFinishedAnimations = false;
   std::set<int> finishedAnimationValueNodes;
+  animationDriverBatch_.runAnimationStep(activeAnimations_, timestampMs);
   for (const auto& [_id, driver] : activeAnimations_) {
-    driver->runAnimationStep(timestampMs);
-
     if (driver->getIsComplete()) {
       hasFinishedAnimations = true;
       finishedAnimationValueNodes.insert(driver->getAnimatedValueTag());
@@ -1115,6 +973,7 @@ void NativeAnimatedNodesManager::flushAnimatedNodesCreatedAsync() noexcept {
       animatedNodes_.insert({tag, std::move(node)});
       updatedNodeTags_.insert(tag);
     }
+    graphOrder_.invalidate();
   }
 }
 
@@ -1193,7 +1052,12 @@ bool NativeAnimatedNodesManager::commitProps() {
 
   if (fabricCommitCallback_ != nullptr) {
     if (!updateViewProps_.empty()) {
-      fabricCommitCallback_(updateViewProps_);
+      std::unordered_map<Tag, folly::dynamic> updateViewProps;
+      updateViewProps.reserve(updateViewProps_.size());
+      for (const auto& [viewTag, props] : updateViewProps_) {
+        updateViewProps.emplace(viewTag, props.toDynamic());
+      }
+      fabricCommitCallback_(updateViewProps);
     }
   }
 
@@ -1201,7 +1065,7 @@ bool NativeAnimatedNodesManager::commitProps() {
 
   if (directManipulationCallback_ != nullptr) {
     for (const auto& [viewTag, props] : updateViewPropsDirect_) {
-      directManipulationCallback_(viewTag, folly::dynamic(props));
+      directManipulationCallback_(viewTag, props.toDynamic());
     }
   }
 
@@ -16,7 +16,10 @@
 #include <react/bridging/Function.h>
 #include <react/debug/flags.h>
 #include <react/renderer/animated/EventEmitterListener.h>
+#include <react/renderer/animated/drivers/AnimationDriverBatch.h>
 #include <react/renderer/animated/event_drivers/EventAnimationDriver.h>
+#include <react/renderer/animated/internal/AnimatedGraphOrder.h>
+#include <react/renderer/animated/internal/AnimatedViewProps.h>
 #include <react/renderer/animationbackend/AnimatedPropsBuilder.h>
 #include <react/renderer/animationbackend/AnimationBackend.h>
 #include <react/renderer/core/ReactPrimitives.h>
@@ -120,7 +123,7 @@ class NativeAnimatedNodesManager : public std::enable_shared_from_this<NativeAni
   void setAnimatedNodeOffset(Tag tag, double offset);
 
   void insertMutations(
-      std::unordered_map<Tag, std::pair<ShadowNodeFamily::Weak, folly::dynamic>> &updates,
+      std::unordered_map<Tag, std::pair<ShadowNodeFamily::Weak, AnimatedViewProps>> &updates,
       AnimationMutations &mutations,
       AnimatedPropsBuilder &propsBuilder,
       bool hasLayoutUpdates = false);
@@ -154,7 +157,7 @@ class NativeAnimatedNodesManager : public std::enable_shared_from_this<NativeAni
 
   void schedulePropsCommit(
       Tag viewTag,
-      const folly::dynamic &props,
+      const AnimatedViewProps &props,
       bool layoutStyleUpdated,
       bool forceFabricCommit,
       ShadowNodeFamily::Weak shadowNodeFamily = {}) noexcept;
@@ -165,7 +168,8 @@ class NativeAnimatedNodesManager : public std::enable_shared_from_this<NativeAni
    * This method is the final step in the animation pipeline that applies
    * calculated property values to the actual UI components. It uses
    * Fabric-based updates if layout properties are affected, otherwise uses
-   * direct manipulation.
+   * direct manipulation. Props are converted to `folly::dynamic` only here,
+   * at the boundary with the platform callbacks.
    *
    * returns boolean indicating whether any changes were committed to views.
    *         Returns true if no changes were made, which helps the animation
@@ -192,6 +196,11 @@ class NativeAnimatedNodesManager : public std::enable_shared_from_this<NativeAni
 
   void updateNodes(const std::set<int> &finishedAnimationValueNodes = {}) noexcept;
 
+  const AnimatedGraphStats &getGraphStats() const noexcept
+  {
+    return graphStats_;
+  }
+
   folly::dynamic getManagedProps(Tag tag) const noexcept;
 
   bool hasManagedProps() const noexcept;
@@ -228,6 +237,7 @@ class NativeAnimatedNodesManager : public std::enable_shared_from_this<NativeAni
   std::unordered_map<Tag, std::unique_ptr<AnimatedNode>> animatedNodes_;
   std::unordered_map<Tag, Tag> connectedAnimatedNodes_;
   std::unordered_map<int, std::unique_ptr<AnimationDriver>> activeAnimations_;
+  AnimationDriverBatch animationDriverBatch_;
   std::unordered_map<
       EventAnimationDriverKey,
       std::vector<std::unique_ptr<EventAnimationDriver>>,
@@ -264,10 +274,10 @@ class NativeAnimatedNodesManager : public std::enable_shared_from_this<NativeAni
 
   std::shared_ptr<EventEmitterListener> eventEmitterListener_{nullptr};
 
-  std::unordered_map<Tag, folly::dynamic> updateViewProps_{};
-  std::unordered_map<Tag, folly::dynamic> updateViewPropsDirect_{};
-  std::unordered_map<Tag, std::pair<ShadowNodeFamily::Weak, folly::dynamic>> updateViewPropsForBackend_{};
-  std::unordered_map<Tag, std::pair<ShadowNodeFamily::Weak, folly::dynamic>> updateViewPropsDirectForBackend_{};
+  std::unordered_map<Tag, AnimatedViewProps> updateViewProps_{};
+  std::unordered_map<Tag, AnimatedViewProps> updateViewPropsDirect_{};
+  std::unordered_map<Tag, std::pair<ShadowNodeFamily::Weak, AnimatedViewProps>> updateViewPropsForBackend_{};
+  std::unordered_map<Tag, std::pair<ShadowNodeFamily::Weak, AnimatedViewProps>> updateViewPropsDirectForBackend_{};
   std::unordered_set<Tag> shouldRequestAsyncFlush_{};
   /*
    * Sometimes a view is not longer connected to a PropsAnimatedNode, but
@@ -277,12 +287,10 @@ class NativeAnimatedNodesManager : public std::enable_shared_from_this<NativeAni
    * manipulation result on this view.
    */
   mutable std::mutex unsyncedDirectViewPropsMutex_;
-  std::unordered_map<Tag, folly::dynamic> unsyncedDirectViewProps_{};
+  std::unordered_map<Tag, AnimatedViewProps> unsyncedDirectViewProps_{};
 
-  int animatedGraphBFSColor_ = 0;
-#ifdef REACT_NATIVE_DEBUG
-  bool warnedAboutGraphTraversal_ = false;
-#endif
+  AnimatedGraphOrder graphOrder_;
+  AnimatedGraphStats graphStats_;
 
   CallbackId animationBackendCallbackId_{0};
 
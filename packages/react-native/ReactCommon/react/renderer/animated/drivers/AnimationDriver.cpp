@@ -36,11 +36,13 @@ AnimationDriver::AnimationDriver(
     Tag animatedValueTag,
     std::optional<AnimationEndCallback> endCallback,
     folly::dynamic config,
-    NativeAnimatedNodesManager* manager)
+    NativeAnimatedNodesManager* manager,
+    AnimationDriverType type)
     : endCallback_(std::move(endCallback)),
       id_(id),
       animatedValueTag_(animatedValueTag),
       manager_(manager),
+      type_(type),
       config_(std::move(config)) {
   onConfigChanged();
 }
@@ -62,8 +64,15 @@ void AnimationDriver::stopAnimation(bool /*ignoreCompletedHandlers*/) {
 }
 
 void AnimationDriver::runAnimationStep(double renderingTime) {
+  if (auto step = beginAnimationStep(renderingTime)) {
+    endAnimationStep(update(step->timeDeltaMs, step->restarting));
+  }
+}
+
+std::optional<AnimationDriver::AnimationStep>
+AnimationDriver::beginAnimationStep(double renderingTime) {
   if (!isStarted_ || isComplete_) {
-    return;
+    return std::nullopt;
   }
 
   const auto frameTimeMs = renderingTime;
@@ -73,9 +82,11 @@ void AnimationDriver::runAnimationStep(double renderingTime) {
     restarting = true;
   }
 
-  const auto timeDeltaMs = frameTimeMs - startFrameTimeMs_;
-  const auto isComplete = update(timeDeltaMs, restarting);
+  return AnimationStep{
+      .timeDeltaMs = frameTimeMs - startFrameTimeMs_, .restarting = restarting};
+}
 
+void AnimationDriver::endAnimationStep(bool isComplete) {
   if (isComplete) {
     if (iterations_ == -1 || ++currentIteration_ < iterations_) {
       startFrameTimeMs_ = -1;
@@ -29,7 +29,8 @@ class AnimationDriver {
       Tag animatedValueTag,
       std::optional<AnimationEndCallback> endCallback,
       folly::dynamic config,
-      NativeAnimatedNodesManager *manager);
+      NativeAnimatedNodesManager *manager,
+      AnimationDriverType type);
   virtual ~AnimationDriver() = default;
   void startAnimation();
   void stopAnimation(bool ignoreCompletedHandlers = false);
@@ -44,6 +45,11 @@ class AnimationDriver {
     return animatedValueTag_;
   }
 
+  AnimationDriverType type() const noexcept
+  {
+    return type_;
+  }
+
   bool getIsComplete() const noexcept
   {
     return isComplete_;
@@ -63,6 +69,19 @@ class AnimationDriver {
   static std::optional<AnimationDriverType> getDriverTypeByName(const std::string &driverTypeName);
 
  protected:
+  struct AnimationStep {
+    double timeDeltaMs;
+    bool restarting;
+  };
+
+  /*
+   * `runAnimationStep` is `beginAnimationStep`, `update` and
+   * `endAnimationStep`. AnimationDriverBatch calls them separately so it can
+   * evaluate the drivers of the same type together.
+   */
+  std::optional<AnimationStep> beginAnimationStep(double renderingTime);
+  void endAnimationStep(bool isComplete);
+
   virtual bool update(double /*timeDeltaMs*/, bool /*restarting*/)
   {
     return true;
@@ -78,6 +97,7 @@ class AnimationDriver {
   Tag animatedValueTag_{}; // Tag of a ValueAnimatedNode
   int iterations_{0};
   NativeAnimatedNodesManager *manager_;
+  AnimationDriverType type_;
 
   bool isComplete_{false};
   int currentIteration_{0};
@@ -90,6 +110,8 @@ class AnimationDriver {
 
  private:
   void onConfigChanged();
+
+  friend class AnimationDriverBatch;
 };
 
 } // namespace facebook::react
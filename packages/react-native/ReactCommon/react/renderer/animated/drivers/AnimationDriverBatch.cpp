@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AnimationDriverBatch.h"
+
+#include <react/renderer/animated/drivers/AnimationDriver.h>
+#include <react/renderer/animated/drivers/AnimationDriverUtils.h>
+#include <react/renderer/animated/drivers/DecayAnimationDriver.h>
+#include <react/renderer/animated/drivers/SpringAnimationDriver.h>
+#include <react/renderer/animated/nodes/ValueAnimatedNode.h>
+
+namespace facebook::react {
+
+namespace {
+
+void evaluateUnderdampedSprings(AnimationDriverBatch::SpringLanes& springs) {
+  const auto count = springs.drivers.size();
+  springs.value.resize(count);
+  springs.velocity.resize(count);
+
+  const auto* time = springs.time.data();
+  const auto* fromValue = springs.fromValue.data();
+  const auto* toValue = springs.toValue.data();
+  const auto* initialVelocity = springs.initialVelocity.data();
+  const auto* zeta = springs.zeta.data();
+  const auto* omega0 = springs.omega0.data();
+  const auto* omega1 = springs.omega1.data();
+  auto* value = springs.value.data();
+  auto* velocity = springs.velocity.data();
+  for (size_t i = 0; i < count; i++) {
+    std::tie(value[i], velocity[i]) = underdampedSpringValueAndVelocity(
+        time[i],
+        fromValue[i],
+        toValue[i],
+        initialVelocity[i],
+        zeta[i],
+        omega0[i],
+        omega1[i]);
+  }
+}
+
+void evaluateDampedSprings(AnimationDriverBatch::SpringLanes& springs) {
+  const auto count = springs.drivers.size();
+  springs.value.resize(count);
+  springs.velocity.resize(count);
+
+  const auto* time = springs.time.data();
+  const auto* fromValue = springs.fromValue.data();
+  const auto* toValue = springs.toValue.data();
+  const auto* initialVelocity = springs.initialVelocity.data();
+  const auto* omega0 = springs.omega0.data();
+  auto* value = springs.value.data();
+  auto* velocity = springs.velocity.data();
+  for (size_t i = 0; i < count; i++) {
+    std::tie(value[i], velocity[i]) = dampedSpringValueAndVelocity(
+        time[i], fromValue[i], toValue[i], initialVelocity[i], omega0[i]);
+  }
+}
+
+void evaluateDecays(AnimationDriverBatch::DecayLanes& decays) {
+  const auto count = decays.drivers.size();
+  decays.value.resize(count);
+
+  const auto* time = decays.time.data();
+  const auto* fromValue = decays.fromValue.data();
+  const auto* velocityScale = decays.velocityScale.data();
+  const auto* decayRate = decays.decayRate.data();
+  auto* value = decays.value.data();
+  for (size_t i = 0; i < count; i++) {
+    value[i] =
+        decayValue(time[i], fromValue[i], velocityScale[i], decayRate[i]);
+  }
+}
+
+} // namespace
+
+void AnimationDriverBatch::SpringLanes::clear() noexcept {
+  drivers.clear();
+  nodes.clear();
+  time.clear();
+  fromValue.clear();
+  toValue.clear();
+  initialVelocity.clear();
+  zeta.clear();
+  omega0.clear();
+  omega1.clear();
+  value.clear();
+  velocity.clear();
+}
+
+void AnimationDriverBatch::DecayLanes::clear() noexcept {
+  drivers.clear();
+  nodes.clear();
+  restarting.clear();
+  time.clear();
+  fromValue.clear();
+  velocityScale.clear();
+  decayRate.clear();
+  value.clear();
+}
+
+void AnimationDriverBatch::runAnimationStep(
+    const std::unordered_map<int, std::unique_ptr<AnimationDriver>>& drivers,
+    double renderingTime) {
+  underdampedSprings_.clear();
+  dampedSprings_.clear();
+  decays_.clear();
+
+  for (const auto& [_id, driver] : drivers) {
+    auto step = driver->beginAnimationStep(renderingTime);
+    if (!step) {
+      continue;
+    }
+
+    switch (driver->type()) {
+      case AnimationDriverType::Spring: {
+        auto& spring = static_cast<SpringAnimationDriver&>(*driver);
+        if (auto node = spring.advance(step->timeDeltaMs, step->restarting)) {
+          addSpring(spring, *node);
+        } else {
+          spring.endAnimationStep(true);
+        }
+      } break;
+      case AnimationDriverType::Decay: {
+        auto& decay = static_cast<DecayAnimationDriver&>(*driver);
+        if (auto node = decay.advance(step->restarting)) {
+          addDecay(decay, *node, step->timeDeltaMs, step->restarting);
+        } else {
+          decay.endAnimationStep(true);
+        }
+      } break;
+      case AnimationDriverType::Frames:
+        driver->endAnimationStep(
+            driver->update(step->timeDeltaMs, step->restarting));
+        break;
+    }
+  }
+
+  evaluateUnderdampedSprings(underdampedSprings_);
+  evaluateDampedSprings(dampedSprings_);
+  evaluateDecays(decays_);
+
+  applySprings(underdampedSprings_);
+  applySprings(dampedSprings_);
+  applyDecays(decays_);
+}
+
+void AnimationDriverBatch::addSpring(
+    SpringAnimationDriver& driver,
+    ValueAnimatedNode& node) {
+  auto& springs =
+      driver.isUnderdamped() ? underdampedSprings_ : dampedSprings_;
+  springs.drivers.push_back(&driver);
+  springs.nodes.push_back(&node);
+  springs.time.push_back(driver.getSpringTime());
+  springs.fromValue.push_back(driver.fromValue_.value());
+  springs.toValue.push_back(driver.endValue_);
+  springs.initialVelocity.push_back(driver.initialVelocity_);
+  springs.zeta.push_back(driver.zeta_);
+  springs.omega0.push_back(driver.omega0_);
+  springs.omega1.push_back(driver.omega1_);
+}
+
+void AnimationDriverBatch::addDecay(
+    DecayAnimationDriver& driver,
+    ValueAnimatedNode& node,
+    double timeDeltaMs,
+    bool restarting) {
+  decays_.drivers.push_back(&driver);
+  decays_.nodes.push_back(&node);
+  decays_.restarting.push_back(restarting);
+  decays_.time.push_back(timeDeltaMs / 1000.0);
+  decays_.fromValue.push_back(driver.fromValue_.value());
+  decays_.velocityScale.push_back(driver.getVelocityScale());
+  decays_.decayRate.push_back(driver.getDecayRate());
+}
+
+void AnimationDriverBatch::applySprings(SpringLanes& springs) {
+  for (size_t i = 0; i < springs.drivers.size(); i++) {
+    auto& driver = *springs.drivers[i];
+    driver.endAnimationStep(driver.apply(
+        *springs.nodes[i], springs.value[i], springs.velocity[i]));
+  }
+}
+
+void AnimationDriverBatch::applyDecays(DecayLanes& decays) {
+  for (size_t i = 0; i < decays.drivers.size(); i++) {
+    auto& driver = *decays.drivers[i];
+    driver.endAnimationStep(driver.apply(
+        *decays.nodes[i], decays.value[i], decays.restarting[i]));
+  }
+}
+
+} // namespace facebook::react
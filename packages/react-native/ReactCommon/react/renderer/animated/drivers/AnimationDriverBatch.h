@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+class AnimationDriver;
+class DecayAnimationDriver;
+class SpringAnimationDriver;
+class ValueAnimatedNode;
+
+/*
+ * Runs one animation step for all the active drivers of a frame, grouped by
+ * driver type.
+ *
+ * The inputs of all springs (and all decays) are gathered into contiguous
+ * arrays, evaluated by a single loop without virtual calls or node lookups,
+ * and only then applied to their animated values. Springs with different
+ * damping regimes are kept in separate arrays so every loop is branch-free.
+ * Frame animations, which look up keyframes, are stepped one by one.
+ *
+ * The arrays are reused between frames, so stepping doesn't allocate once
+ * they have grown to the number of running animations.
+ */
+class AnimationDriverBatch {
+ public:
+  /*
+   * Equivalent to calling `runAnimationStep(renderingTime)` on each driver.
+   */
+  void runAnimationStep(
+      const std::unordered_map<int, std::unique_ptr<AnimationDriver>> &drivers,
+      double renderingTime);
+
+  struct SpringLanes {
+    std::vector<SpringAnimationDriver *> drivers;
+    std::vector<ValueAnimatedNode *> nodes;
+    std::vector<double> time;
+    std::vector<double> fromValue;
+    std::vector<double> toValue;
+    std::vector<double> initialVelocity;
+    std::vector<double> zeta;
+    std::vector<double> omega0;
+    std::vector<double> omega1;
+    std::vector<float> value;
+    std::vector<double> velocity;
+
+    void clear() noexcept;
+  };
+
+  struct DecayLanes {
+    std::vector<DecayAnimationDriver *> drivers;
+    std::vector<ValueAnimatedNode *> nodes;
+    std::vector<bool> restarting;
+    std::vector<double> time;
+    std::vector<double> fromValue;
+    std::vector<double> velocityScale;
+    std::vector<double> decayRate;
+    std::vector<float> value;
+
+    void clear() noexcept;
+  };
+
+ private:
+  void addSpring(SpringAnimationDriver &driver, ValueAnimatedNode &node);
+  void addDecay(DecayAnimationDriver &driver, ValueAnimatedNode &node, double timeDeltaMs, bool restarting);
+
+  static void applySprings(SpringLanes &springs);
+  static void applyDecays(DecayLanes &decays);
+
+  SpringLanes underdampedSprings_;
+  SpringLanes dampedSprings_;
+  DecayLanes decays_;
+};
+
+} // namespace facebook::react
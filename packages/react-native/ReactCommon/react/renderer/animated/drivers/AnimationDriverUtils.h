@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include <cmath>
 #include <string_view>
+#include <tuple>
 
 namespace facebook::react {
 
@@ -61,4 +63,56 @@ inline double interpolate(
   return outputMin + (outputMax - outputMin) * (result - inputMin) / (inputMax - inputMin);
 }
 
+/*
+ * Value and velocity of an underdamped (`zeta < 1`) spring `time` seconds
+ * after it started moving from `fromValue` towards `toValue`. `zeta`,
+ * `omega0` and `omega1` only depend on the spring config, see
+ * SpringAnimationDriver.
+ */
+inline std::tuple<float, double> underdampedSpringValueAndVelocity(
+    double time,
+    double fromValue,
+    double toValue,
+    double initialVelocity,
+    double zeta,
+    double omega0,
+    double omega1)
+{
+  const auto v0 = -initialVelocity;
+  const auto x0 = toValue - fromValue;
+  const auto envelope = std::exp(-zeta * omega0 * time);
+  const auto value = static_cast<float>(
+      toValue -
+      envelope * ((v0 + zeta * omega0 * x0) / omega1 * std::sin(omega1 * time) + x0 * std::cos(omega1 * time)));
+  const auto velocity = zeta * omega0 * envelope *
+          (std::sin(omega1 * time) * (v0 + zeta * omega0 * x0) / omega1 + x0 * std::cos(omega1 * time)) -
+      envelope * (std::cos(omega1 * time) * (v0 + zeta * omega0 * x0) - omega1 * x0 * std::sin(omega1 * time));
+  return std::make_tuple(value, velocity);
+}
+
+/*
+ * Value and velocity of a spring with `zeta >= 1`, see
+ * `underdampedSpringValueAndVelocity`.
+ */
+inline std::tuple<float, double>
+dampedSpringValueAndVelocity(double time, double fromValue, double toValue, double initialVelocity, double omega0)
+{
+  const auto v0 = -initialVelocity;
+  const auto x0 = toValue - fromValue;
+  const auto envelope = std::exp(-omega0 * time);
+  const auto value = static_cast<float>(toValue - envelope * (x0 + (v0 + omega0 * x0) * time));
+  const auto velocity = envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
+  return std::make_tuple(value, velocity);
+}
+
+/*
+ * Value of a decay animation `time` seconds after it started at `fromValue`.
+ * `velocityScale` is `velocity / (1 - deceleration)` and `decayRate` is
+ * `1 - deceleration`.
+ */
+inline float decayValue(double time, double fromValue, double velocityScale, double decayRate)
+{
+  return static_cast<float>(fromValue + velocityScale * (1 - std::exp(-decayRate * (1000 * time))));
+}
+
 } // namespace facebook::react
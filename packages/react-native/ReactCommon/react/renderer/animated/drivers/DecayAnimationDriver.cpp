@@ -11,6 +11,7 @@
 
 #include "DecayAnimationDriver.h"
 #include <react/debug/react_native_assert.h>
+#include <react/renderer/animated/drivers/AnimationDriverUtils.h>
 #include <react/renderer/animated/nodes/ValueAnimatedNode.h>
 
 namespace facebook::react {
@@ -25,7 +26,8 @@ DecayAnimationDriver::DecayAnimationDriver(
           animatedValueTag,
           std::move(endCallback),
           std::move(config),
-          manager),
+          manager,
+          AnimationDriverType::Decay),
       velocity_(config_["velocity"].asDouble()),
       deceleration_(config_["deceleration"].asDouble()) {
   react_native_assert(deceleration_ > 0);
@@ -33,49 +35,59 @@ DecayAnimationDriver::DecayAnimationDriver(
 
 std::tuple<float, double> DecayAnimationDriver::getValueAndVelocityForTime(
     double time) const {
-  const auto value = fromValue_.value() +
-      velocity_ / (1 - deceleration_) *
-          (1 - std::exp(-(1 - deceleration_) * (1000 * time)));
+  const auto value =
+      decayValue(time, fromValue_.value(), getVelocityScale(), getDecayRate());
   return std::make_tuple(
-      static_cast<float>(value),
+      value,
       42.0f); // we don't need the velocity, so set it to a dummy value
 }
 
 bool DecayAnimationDriver::update(double timeDeltaMs, bool restarting) {
-  if (const auto node =
-          manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_)) {
-    if (restarting) {
-      const auto value = node->getRawValue();
-      if (!fromValue_.has_value()) {
-        // First iteration, assign fromValue based on AnimatedValue
-        fromValue_ = value;
-      } else {
-        // Not the first iteration, reset AnimatedValue based on
-        // originalValue
-        if (node->setRawValue(fromValue_.value())) {
-          markNodeUpdated(node->tag());
-        }
-      }
-
-      lastValue_ = value;
-    }
-
+  if (const auto node = advance(restarting)) {
     const auto [value, velocity] =
         getValueAndVelocityForTime(timeDeltaMs / 1000.0);
-    auto isComplete =
-        lastValue_.has_value() && std::abs(value - lastValue_.value()) < 0.1;
-    if (!restarting && isComplete) {
-      return true;
+    return apply(*node, value, restarting);
+  }
+
+  return true;
+}
+
+ValueAnimatedNode* DecayAnimationDriver::advance(bool restarting) {
+  const auto node =
+      manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_);
+  if (node != nullptr && restarting) {
+    const auto value = node->getRawValue();
+    if (!fromValue_.has_value()) {
+      // First iteration, assign fromValue based on AnimatedValue
+      fromValue_ = value;
     } else {
-      lastValue_ = value;
-      if (node->setRawValue(value)) {
+      // Not the first iteration, reset AnimatedValue based on
+      // originalValue
+      if (node->setRawValue(fromValue_.value())) {
         markNodeUpdated(node->tag());
       }
-      return false;
     }
+
+    lastValue_ = value;
   }
+  return node;
+}
 
-  return true;
+bool DecayAnimationDriver::apply(
+    ValueAnimatedNode& node,
+    float value,
+    bool restarting) {
+  auto isComplete =
+      lastValue_.has_value() && std::abs(value - lastValue_.value()) < 0.1;
+  if (!restarting && isComplete) {
+    return true;
+  } else {
+    lastValue_ = value;
+    if (node.setRawValue(value)) {
+      markNodeUpdated(node.tag());
+    }
+    return false;
+  }
 }
 
 } // namespace facebook::react
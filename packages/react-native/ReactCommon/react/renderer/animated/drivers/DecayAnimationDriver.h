@@ -15,6 +15,8 @@
 
 namespace facebook::react {
 
+class ValueAnimatedNode;
+
 class DecayAnimationDriver : public AnimationDriver {
  public:
   DecayAnimationDriver(
@@ -28,6 +30,25 @@ class DecayAnimationDriver : public AnimationDriver {
   bool update(double timeDeltaMs, bool restarting) override;
 
  private:
+  /*
+   * `update` is split into `advance`, which handles restarts, and `apply`,
+   * which stores the value evaluated for the step. AnimationDriverBatch
+   * evaluates the decays in between. `advance` returns nullptr if the
+   * animated value no longer exists.
+   */
+  ValueAnimatedNode *advance(bool restarting);
+  bool apply(ValueAnimatedNode &node, float value, bool restarting);
+
+  double getVelocityScale() const noexcept
+  {
+    return velocity_ / (1 - deceleration_);
+  }
+
+  double getDecayRate() const noexcept
+  {
+    return 1 - deceleration_;
+  }
+
   std::tuple<float, double> getValueAndVelocityForTime(double time) const;
 
  private:
@@ -35,6 +56,8 @@ class DecayAnimationDriver : public AnimationDriver {
   double deceleration_{0};
   std::optional<double> fromValue_{std::nullopt};
   std::optional<double> lastValue_{0};
+
+  friend class AnimationDriverBatch;
 };
 
 } // namespace facebook::react
@@ -28,7 +28,8 @@ SpringAnimationDriver::SpringAnimationDriver(
           animatedValueTag,
           std::move(endCallback),
           std::move(config),
-          manager),
+          manager,
+          AnimationDriverType::Spring),
       springStiffness_(config_["stiffness"].asDouble()),
       springDamping_(config_["damping"].asDouble()),
       springMass_(config_["mass"].asDouble()),
@@ -37,96 +38,98 @@ SpringAnimationDriver::SpringAnimationDriver(
       restSpeedThreshold_(config_["restSpeedThreshold"].asDouble()),
       displacementFromRestThreshold_(
           config_["restDisplacementThreshold"].asDouble()),
-      overshootClampingEnabled_(config_["overshootClamping"].asBool()) {}
-
-std::tuple<float, double> SpringAnimationDriver::getValueAndVelocityForTime(
-    double time) const {
-  const auto startValue = fromValue_.value();
-  const auto toValue = endValue_;
+      overshootClampingEnabled_(config_["overshootClamping"].asBool()) {
   const auto c = springDamping_;
   const auto m = springMass_;
   const auto k = springStiffness_;
-  const auto v0 = -initialVelocity_;
-
-  const auto zeta = c / (2 * std::sqrt(k * m));
-  const auto omega0 = std::sqrt(k / m);
-  const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
-  const auto x0 = toValue - startValue;
-
-  if (zeta < 1) {
-    const auto envelope = std::exp(-zeta * omega0 * time);
-    const auto value = static_cast<float>(
-        toValue -
-        envelope *
-            ((v0 + zeta * omega0 * x0) / omega1 * std::sin(omega1 * time) +
-             x0 * std::cos(omega1 * time)));
-    const auto velocity = zeta * omega0 * envelope *
-            (std::sin(omega1 * time) * (v0 + zeta * omega0 * x0) / omega1 +
-             x0 * std::cos(omega1 * time)) -
-        envelope *
-            (std::cos(omega1 * time) * (v0 + zeta * omega0 * x0) -
-             omega1 * x0 * std::sin(omega1 * time));
-    return std::make_tuple(value, velocity);
+  zeta_ = c / (2 * std::sqrt(k * m));
+  omega0_ = std::sqrt(k / m);
+  omega1_ = omega0_ * std::sqrt(1.0 - (zeta_ * zeta_));
+}
+
+std::tuple<float, double> SpringAnimationDriver::getValueAndVelocityForTime(
+    double time) const {
+  if (isUnderdamped()) {
+    return underdampedSpringValueAndVelocity(
+        time,
+        fromValue_.value(),
+        endValue_,
+        initialVelocity_,
+        zeta_,
+        omega0_,
+        omega1_);
   } else {
-    const auto envelope = std::exp(-omega0 * time);
-    const auto value = static_cast<float>(
-        endValue_ - envelope * (x0 + (v0 + omega0 * x0) * time));
-    const auto velocity =
-        envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
-    return std::make_tuple(value, velocity);
+    return dampedSpringValueAndVelocity(
+        time, fromValue_.value(), endValue_, initialVelocity_, omega0_);
   }
 }
 
 bool SpringAnimationDriver::update(double timeDeltaMs, bool restarting) {
-  if (const auto node =
-          manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_)) {
-    if (restarting) {
-      if (!fromValue_.has_value()) {
-        fromValue_ = node->getRawValue();
-      } else {
-        if (node->setRawValue(fromValue_.value())) {
-          markNodeUpdated(node->tag());
-        }
-      }
+  if (const auto node = advance(timeDeltaMs, restarting)) {
+    auto [value, velocity] = getValueAndVelocityForTime(getSpringTime());
+    return apply(*node, value, velocity);
+  }
 
-      // Spring animations run a frame behind JS driven animations if we do
-      // not start the first frame at 16ms.
-      lastTime_ = timeDeltaMs - SingleFrameIntervalMs;
-      timeAccumulator_ = 0.0;
-    }
+  return true;
+}
 
-    // clamp the amount of timeDeltaMs to avoid stuttering in the UI.
-    // We should be able to catch up in a subsequent advance if necessary.
-    auto adjustedDeltaTime = timeDeltaMs - lastTime_;
-    if (adjustedDeltaTime > MaxDeltaTimeMs) {
-      adjustedDeltaTime = MaxDeltaTimeMs;
-    }
-    timeAccumulator_ += adjustedDeltaTime;
-    lastTime_ = timeDeltaMs;
-
-    auto [value, velocity] =
-        getValueAndVelocityForTime(timeAccumulator_ / 1000.0);
-
-    auto isComplete = false;
-    if (isAtRest(velocity, value, endValue_) ||
-        (overshootClampingEnabled_ && isOvershooting(value))) {
-      if (springStiffness_ > 0) {
-        value = static_cast<float>(endValue_);
-      } else {
-        endValue_ = value;
-      }
+ValueAnimatedNode* SpringAnimationDriver::advance(
+    double timeDeltaMs,
+    bool restarting) {
+  const auto node =
+      manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_);
+  if (node == nullptr) {
+    return nullptr;
+  }
 
-      isComplete = true;
+  if (restarting) {
+    if (!fromValue_.has_value()) {
+      fromValue_ = node->getRawValue();
+    } else {
+      if (node->setRawValue(fromValue_.value())) {
+        markNodeUpdated(node->tag());
+      }
     }
 
-    if (node->setRawValue(value)) {
-      markNodeUpdated(node->tag());
+    // Spring animations run a frame behind JS driven animations if we do
+    // not start the first frame at 16ms.
+    lastTime_ = timeDeltaMs - SingleFrameIntervalMs;
+    timeAccumulator_ = 0.0;
+  }
+
+  // clamp the amount of timeDeltaMs to avoid stuttering in the UI.
+  // We should be able to catch up in a subsequent advance if necessary.
+  auto adjustedDeltaTime = timeDeltaMs - lastTime_;
+  if (adjustedDeltaTime > MaxDeltaTimeMs) {
+    adjustedDeltaTime = MaxDeltaTimeMs;
+  }
+  timeAccumulator_ += adjustedDeltaTime;
+  lastTime_ = timeDeltaMs;
+
+  return node;
+}
+
+bool SpringAnimationDriver::apply(
+    ValueAnimatedNode& node,
+    float value,
+    double velocity) {
+  auto isComplete = false;
+  if (isAtRest(velocity, value, endValue_) ||
+      (overshootClampingEnabled_ && isOvershooting(value))) {
+    if (springStiffness_ > 0) {
+      value = static_cast<float>(endValue_);
+    } else {
+      endValue_ = value;
     }
 
-    return isComplete;
+    isComplete = true;
   }
 
-  return true;
+  if (node.setRawValue(value)) {
+    markNodeUpdated(node.tag());
+  }
+
+  return isComplete;
 }
 
 bool SpringAnimationDriver::isAtRest(
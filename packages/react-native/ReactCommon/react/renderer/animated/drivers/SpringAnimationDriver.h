@@ -15,6 +15,8 @@
 
 namespace facebook::react {
 
+class ValueAnimatedNode;
+
 class SpringAnimationDriver : public AnimationDriver {
  public:
   SpringAnimationDriver(
@@ -28,6 +30,25 @@ class SpringAnimationDriver : public AnimationDriver {
   bool update(double timeDeltaMs, bool restarting) override;
 
  private:
+  /*
+   * `update` is split into `advance`, which handles restarts and moves the
+   * spring clock forward, and `apply`, which stores the value evaluated at
+   * `getSpringTime()`. AnimationDriverBatch evaluates the springs in between.
+   * `advance` returns nullptr if the animated value no longer exists.
+   */
+  ValueAnimatedNode *advance(double timeDeltaMs, bool restarting);
+  bool apply(ValueAnimatedNode &node, float value, double velocity);
+
+  double getSpringTime() const noexcept
+  {
+    return timeAccumulator_ / 1000.0;
+  }
+
+  bool isUnderdamped() const noexcept
+  {
+    return zeta_ < 1;
+  }
+
   std::tuple<float, double> getValueAndVelocityForTime(double time) const;
   bool isAtRest(double currentVelocity, double currentValue, double endValue) const;
   bool isOvershooting(double currentValue) const;
@@ -42,8 +63,15 @@ class SpringAnimationDriver : public AnimationDriver {
   double displacementFromRestThreshold_{0};
   bool overshootClampingEnabled_{false};
 
+  // Damping ratio and (damped) angular frequencies, derived from the config.
+  double zeta_{0};
+  double omega0_{0};
+  double omega1_{0};
+
   double lastTime_{0};
   double timeAccumulator_{0};
+
+  friend class AnimationDriverBatch;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AnimatedGraphOrder.h"
+
+#include <react/renderer/animated/nodes/AnimatedNode.h>
+#include <limits>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr auto kNoIndex = std::numeric_limits<uint32_t>::max();
+
+uint32_t findRoot(std::vector<uint32_t>& parents, uint32_t index) {
+  while (parents[index] != index) {
+    parents[index] = parents[parents[index]];
+    index = parents[index];
+  }
+  return index;
+}
+
+} // namespace
+
+size_t AnimatedGraphOrder::build(const AnimatedNodes& nodes) {
+  nodes_.clear();
+  childrenOffsets_.clear();
+  children_.clear();
+  componentIndices_.clear();
+  components_.clear();
+  indices_.clear();
+  flags_.clear();
+  updatedComponents_.clear();
+
+  // Index the nodes in map order and resolve the child tags.
+  const auto nodesCount = static_cast<uint32_t>(nodes.size());
+  auto unorderedNodes = std::vector<AnimatedNode*>{};
+  unorderedNodes.reserve(nodesCount);
+  indices_.reserve(nodesCount);
+  for (const auto& [tag, node] : nodes) {
+    indices_.emplace(tag, static_cast<uint32_t>(unorderedNodes.size()));
+    unorderedNodes.push_back(node.get());
+  }
+
+  auto edges = std::vector<std::vector<uint32_t>>(nodesCount);
+  auto incomingEdgesCount = std::vector<uint32_t>(nodesCount, 0);
+  auto componentParents = std::vector<uint32_t>(nodesCount);
+  for (uint32_t i = 0; i < nodesCount; i++) {
+    componentParents[i] = i;
+  }
+  for (uint32_t i = 0; i < nodesCount; i++) {
+    for (auto childTag : unorderedNodes[i]->getChildren()) {
+      if (auto it = indices_.find(childTag); it != indices_.end()) {
+        edges[i].push_back(it->second);
+        incomingEdgesCount[it->second]++;
+        componentParents[findRoot(componentParents, i)] =
+            findRoot(componentParents, it->second);
+      }
+    }
+  }
+
+  // Kahn's algorithm: a node is emitted once all of its parents are.
+  auto sortedNodes = std::vector<uint32_t>{};
+  sortedNodes.reserve(nodesCount);
+  for (uint32_t i = 0; i < nodesCount; i++) {
+    if (incomingEdgesCount[i] == 0) {
+      sortedNodes.push_back(i);
+    }
+  }
+  for (size_t next = 0; next < sortedNodes.size(); next++) {
+    for (auto child : edges[sortedNodes[next]]) {
+      if (--incomingEdgesCount[child] == 0) {
+        sortedNodes.push_back(child);
+      }
+    }
+  }
+
+  // Group the sorted nodes by component, keeping their relative order.
+  auto componentOfRoot = std::vector<uint32_t>(nodesCount, kNoIndex);
+  auto nodeComponents = std::vector<uint32_t>(sortedNodes.size());
+  for (size_t i = 0; i < sortedNodes.size(); i++) {
+    auto root = findRoot(componentParents, sortedNodes[i]);
+    if (componentOfRoot[root] == kNoIndex) {
+      componentOfRoot[root] = static_cast<uint32_t>(components_.size());
+      components_.push_back({.begin = 0, .end = 0});
+    }
+    nodeComponents[i] = componentOfRoot[root];
+    components_[nodeComponents[i]].end++;
+  }
+  uint32_t offset = 0;
+  for (auto& component : components_) {
+    component.begin = offset;
+    offset += component.end;
+    component.end = component.begin;
+  }
+
+  auto orderedIndices = std::vector<uint32_t>(nodesCount, kNoIndex);
+  for (size_t i = 0; i < sortedNodes.size(); i++) {
+    orderedIndices[sortedNodes[i]] = components_[nodeComponents[i]].end++;
+  }
+
+  // Lay the nodes and their children out in evaluation order.
+  const auto orderedCount = static_cast<uint32_t>(sortedNodes.size());
+  auto unorderedIndices = std::vector<uint32_t>(orderedCount);
+  nodes_.resize(orderedCount);
+  componentIndices_.resize(orderedCount);
+  for (size_t i = 0; i < sortedNodes.size(); i++) {
+    auto index = orderedIndices[sortedNodes[i]];
+    unorderedIndices[index] = sortedNodes[i];
+    nodes_[index] = unorderedNodes[sortedNodes[i]];
+    componentIndices_[index] = nodeComponents[i];
+  }
+
+  childrenOffsets_.reserve(orderedCount + 1);
+  for (uint32_t i = 0; i < orderedCount; i++) {
+    childrenOffsets_.push_back(static_cast<uint32_t>(children_.size()));
+    for (auto child : edges[unorderedIndices[i]]) {
+      if (orderedIndices[child] != kNoIndex) {
+        children_.push_back(orderedIndices[child]);
+      }
+    }
+  }
+  childrenOffsets_.push_back(static_cast<uint32_t>(children_.size()));
+
+  for (auto it = indices_.begin(); it != indices_.end();) {
+    if (orderedIndices[it->second] == kNoIndex) {
+      it = indices_.erase(it);
+    } else {
+      it->second = orderedIndices[it->second];
+      ++it;
+    }
+  }
+
+  flags_.assign(orderedCount, 0);
+  valid_ = true;
+
+  return nodesCount - orderedCount;
+}
+
+void AnimatedGraphOrder::markUpdated(
+    Tag tag,
+    bool connectedToFinishedAnimation) {
+  if (auto it = indices_.find(tag); it != indices_.end()) {
+    flags_[it->second] |= Updated |
+        (connectedToFinishedAnimation ? ConnectedToFinishedAnimation : 0);
+    updatedComponents_.push_back(componentIndices_[it->second]);
+  }
+}
+
+} // namespace facebook::react
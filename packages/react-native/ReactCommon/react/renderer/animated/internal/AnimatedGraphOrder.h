@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+class AnimatedNode;
+
+/*
+ * Counters describing the work done by the animated graph updates.
+ */
+struct AnimatedGraphStats {
+  // Nodes evaluated by the last `updateNodes` call.
+  size_t lastEvaluatedNodesCount{0};
+  // Nodes evaluated since the manager was created.
+  size_t totalEvaluatedNodesCount{0};
+  // Number of times the evaluation order was rebuilt.
+  size_t orderRebuildsCount{0};
+};
+
+/*
+ * Evaluation order of the animated nodes graph, cached between frames.
+ *
+ * The nodes are stored in a contiguous array grouped by connected component,
+ * and every component is sorted so that a node comes after all of its
+ * parents. Evaluating the descendants of a set of updated nodes is then a
+ * single forward scan over the components they belong to, with no hash
+ * lookups and no queue.
+ *
+ * The order has to be invalidated whenever nodes are added, dropped,
+ * connected or disconnected. Nodes that are part of a cycle, and all the
+ * nodes depending on them, are left out of the order and never evaluated.
+ */
+class AnimatedGraphOrder {
+ public:
+  using AnimatedNodes = std::unordered_map<Tag, std::unique_ptr<AnimatedNode>>;
+
+  void invalidate() noexcept
+  {
+    valid_ = false;
+  }
+
+  bool isValid() const noexcept
+  {
+    return valid_;
+  }
+
+  /*
+   * Rebuilds the order for `nodes`. Returns the number of nodes left out of
+   * the order because they are part of, or depend on, a cycle.
+   */
+  size_t build(const AnimatedNodes &nodes);
+
+  /*
+   * Schedules the node and all of its descendants for the next `evaluate`
+   * call. Unknown tags are ignored.
+   */
+  void markUpdated(Tag tag, bool connectedToFinishedAnimation = false);
+
+  /*
+   * Calls `update(AnimatedNode &, bool connectedToFinishedAnimation)` for
+   * every scheduled node, parents first. `update` returns whether the node is
+   * connected to a finished animation, which is propagated to its
+   * descendants. Returns the number of evaluated nodes.
+   */
+  template <typename UpdateT>
+  size_t evaluate(UpdateT &&update);
+
+  size_t size() const noexcept
+  {
+    return nodes_.size();
+  }
+
+ private:
+  enum NodeFlags : uint8_t {
+    Updated = 1 << 0,
+    ConnectedToFinishedAnimation = 1 << 1,
+  };
+
+  struct Component {
+    uint32_t begin;
+    uint32_t end;
+  };
+
+  bool valid_{false};
+
+  // Nodes in evaluation order, their children as indices into `nodes_` (the
+  // children of node `i` are `children_[childrenOffsets_[i]..[i + 1])`) and
+  // the component each of them belongs to.
+  std::vector<AnimatedNode *> nodes_;
+  std::vector<uint32_t> childrenOffsets_;
+  std::vector<uint32_t> children_;
+  std::vector<uint32_t> componentIndices_;
+  std::vector<Component> components_;
+  std::unordered_map<Tag, uint32_t> indices_;
+
+  // Per-frame state, reset by `evaluate`.
+  std::vector<uint8_t> flags_;
+  std::vector<uint32_t> updatedComponents_;
+};
+
+template <typename UpdateT>
+size_t AnimatedGraphOrder::evaluate(UpdateT &&update)
+{
+  std::sort(updatedComponents_.begin(), updatedComponents_.end());
+  updatedComponents_.erase(
+      std::unique(updatedComponents_.begin(), updatedComponents_.end()), updatedComponents_.end());
+
+  size_t evaluatedNodesCount = 0;
+  for (auto componentIndex : updatedComponents_) {
+    const auto component = components_[componentIndex];
+    for (auto i = component.begin; i < component.end; i++) {
+      const auto flags = flags_[i];
+      if ((flags & Updated) == 0) {
+        continue;
+      }
+      flags_[i] = 0;
+      evaluatedNodesCount++;
+
+      const auto connectedToFinishedAnimation = update(*nodes_[i], (flags & ConnectedToFinishedAnimation) != 0);
+      const auto childFlags =
+          static_cast<uint8_t>(Updated | (connectedToFinishedAnimation ? ConnectedToFinishedAnimation : 0));
+      for (auto child = childrenOffsets_[i]; child < childrenOffsets_[i + 1]; child++) {
+        flags_[children_[child]] |= childFlags;
+      }
+    }
+  }
+  updatedComponents_.clear();
+
+  return evaluatedNodesCount;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AnimatedViewProps.h"
+
+#include <react/renderer/graphics/Color.h>
+#include <react/renderer/graphics/Transform.h>
+#include <react/renderer/graphics/ValueUnit.h>
+
+namespace facebook::react {
+
+namespace {
+
+folly::dynamic valueToDynamic(const AnimatedPropValue& value) {
+  if (const auto* number = std::get_if<double>(&value)) {
+    return *number;
+  }
+  if (const auto* color = std::get_if<int32_t>(&value)) {
+    return *color;
+  }
+  if (const auto* operations =
+          std::get_if<AnimatedTransformOperations>(&value)) {
+    auto transforms = folly::dynamic::array();
+    for (const auto& operation : *operations) {
+      transforms.push_back(
+          folly::dynamic::object(operation.property, operation.value));
+    }
+    return transforms;
+  }
+  return std::get<folly::dynamic>(value);
+}
+
+// Mirrors the integer branch of `fromRawValueShared`, which is how colors
+// packed into RawProps would have been parsed.
+SharedColor colorFromARGB(int32_t value) {
+  auto argb = static_cast<uint32_t>(value);
+  auto ratio = 255.f;
+  return colorFromComponents(
+      {.red = ((argb >> 16) & 0xFF) / ratio,
+       .green = ((argb >> 8) & 0xFF) / ratio,
+       .blue = (argb & 0xFF) / ratio,
+       .alpha = ((argb >> 24) & 0xFF) / ratio});
+}
+
+// Mirrors `parseProcessedTransform` for operations with a numeric parameter.
+// Returns false for operations that can't be represented that way, e.g.
+// `perspective`, which the direct manipulation path can't serialize back.
+bool appendTransformOperation(
+    Transform& transform,
+    const AnimatedTransformOperation& operation) {
+  auto zero = ValueUnit(0, UnitType::Point);
+  auto one = ValueUnit(1, UnitType::Point);
+  auto number =
+      ValueUnit(static_cast<Float>(operation.value), UnitType::Point);
+  const auto& property = operation.property;
+
+  if (property == "translateX") {
+    transform.operations.push_back(
+        {.type = TransformOperationType::Translate,
+         .x = number,
+         .y = zero,
+         .z = zero});
+  } else if (property == "translateY") {
+    transform.operations.push_back(
+        {.type = TransformOperationType::Translate,
+         .x = zero,
+         .y = number,
+         .z = zero});
+  } else if (property == "scale") {
+    transform.operations.push_back(
+        {.type = TransformOperationType::Scale,
+         .x = number,
+         .y = number,
+         .z = number});
+  } else if (property == "scaleX") {
+    transform.operations.push_back(
+        {.type = TransformOperationType::Scale,
+         .x = number,
+         .y = one,
+         .z = one});
+  } else if (property == "scaleY") {
+    transform.operations.push_back(
+        {.type = TransformOperationType::Scale,
+         .x = one,
+         .y = number,
+         .z = one});
+  } else if (property == "scaleZ") {
+    transform.operations.push_back(
+        {.type = TransformOperationType::Scale,
+         .x = one,
+         .y = one,
+         .z = number});
+  } else if (property == "rotateX") {
+    transform.operations.push_back(
+        {.type = TransformOperationType::Rotate,
+         .x = number,
+         .y = zero,
+         .z = zero});
+  } else if (property == "rotateY") {
+    transform.operations.push_back(
+        {.type = TransformOperationType::Rotate,
+         .x = zero,
+         .y = number,
+         .z = zero});
+  } else if (property == "rotateZ" || property == "rotate") {
+    transform.operations.push_back(
+        {.type = TransformOperationType::Rotate,
+         .x = zero,
+         .y = zero,
+         .z = number});
+  } else if (property == "skewX") {
+    transform.operations.push_back(
+        {.type = TransformOperationType::Skew,
+         .x = number,
+         .y = zero,
+         .z = zero});
+  } else if (property == "skewY") {
+    transform.operations.push_back(
+        {.type = TransformOperationType::Skew,
+         .x = zero,
+         .y = number,
+         .z = zero});
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool storeTransform(
+    AnimatedPropsBuilder& builder,
+    const AnimatedTransformOperations& operations) {
+  auto transform = Transform{};
+  for (const auto& operation : operations) {
+    if (!appendTransformOperation(transform, operation)) {
+      return false;
+    }
+  }
+  builder.setTransform(transform);
+  return true;
+}
+
+bool storeTypedProp(
+    AnimatedPropsBuilder& builder,
+    std::string_view name,
+    const AnimatedPropValue& value) {
+  if (const auto* number = std::get_if<double>(&value)) {
+    auto floatValue = static_cast<Float>(*number);
+    if (name == "opacity") {
+      builder.setOpacity(floatValue);
+    } else if (name == "shadowOpacity") {
+      builder.setShadowOpacity(floatValue);
+    } else if (name == "shadowRadius") {
+      builder.setShadowRadius(floatValue);
+    } else if (name == "outlineOffset") {
+      builder.setOutlineOffset(floatValue);
+    } else if (name == "outlineWidth") {
+      builder.setOutlineWidth(floatValue);
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  if (const auto* color = std::get_if<int32_t>(&value)) {
+    if (name == "backgroundColor") {
+      builder.setBackgroundColor(colorFromARGB(*color));
+    } else if (name == "shadowColor") {
+      builder.setShadowColor(colorFromARGB(*color));
+    } else if (name == "outlineColor") {
+      builder.setOutlineColor(colorFromARGB(*color));
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  if (const auto* operations =
+          std::get_if<AnimatedTransformOperations>(&value)) {
+    return name == "transform" && storeTransform(builder, *operations);
+  }
+
+  return false;
+}
+
+} // namespace
+
+AnimatedPropValue& AnimatedViewProps::operator[](std::string_view name) {
+  for (auto& [entryName, value] : entries_) {
+    if (entryName == name) {
+      return value;
+    }
+  }
+  return entries_.emplace_back(std::string(name), 0.0).second;
+}
+
+const AnimatedPropValue* AnimatedViewProps::find(std::string_view name) const {
+  for (const auto& [entryName, value] : entries_) {
+    if (entryName == name) {
+      return &value;
+    }
+  }
+  return nullptr;
+}
+
+void AnimatedViewProps::merge(const AnimatedViewProps& other) {
+  if (entries_.empty()) {
+    entries_ = other.entries_;
+    return;
+  }
+  for (const auto& [name, value] : other.entries_) {
+    (*this)[name] = value;
+  }
+}
+
+folly::dynamic AnimatedViewProps::toDynamic() const {
+  auto result = folly::dynamic::object();
+  for (const auto& [name, value] : entries_) {
+    result.insert(name, valueToDynamic(value));
+  }
+  return result;
+}
+
+void AnimatedViewProps::storeInto(AnimatedPropsBuilder& builder) const {
+  auto rawProps = folly::dynamic::object();
+  for (const auto& [name, value] : entries_) {
+    if (!storeTypedProp(builder, name, value)) {
+      rawProps.insert(name, valueToDynamic(value));
+    }
+  }
+  if (!rawProps.empty()) {
+    builder.storeDynamic(rawProps);
+  }
+}
+
+} // namespace facebook::react
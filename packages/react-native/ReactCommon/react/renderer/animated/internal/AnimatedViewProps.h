@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <folly/dynamic.h>
+#include <react/renderer/animationbackend/AnimatedPropsBuilder.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A single `{property: value}` entry of an animated `transform` style.
+ */
+struct AnimatedTransformOperation {
+  std::string property;
+  double value{0};
+
+  bool operator==(const AnimatedTransformOperation &rhs) const = default;
+};
+
+using AnimatedTransformOperations = std::vector<AnimatedTransformOperation>;
+
+/*
+ * Value of a single animated prop: a number, a processed color, the list of
+ * transform operations, or an arbitrary value produced by an
+ * ObjectAnimatedNode.
+ */
+using AnimatedPropValue = std::variant<double, int32_t, AnimatedTransformOperations, folly::dynamic>;
+
+/*
+ * Props computed by the animated graph for a single view.
+ *
+ * Entries keep their insertion order and assigning to an existing name reuses
+ * its storage, so a node that updates the same props every frame doesn't
+ * allocate once the first frame has been collected.
+ */
+class AnimatedViewProps {
+ public:
+  using Entry = std::pair<std::string, AnimatedPropValue>;
+
+  /*
+   * Returns the value stored for `name`, inserting `0.0` if there is none.
+   */
+  AnimatedPropValue &operator[](std::string_view name);
+
+  const AnimatedPropValue *find(std::string_view name) const;
+
+  /*
+   * Assigns every entry of `other`, overriding values of the same name.
+   */
+  void merge(const AnimatedViewProps &other);
+
+  bool empty() const noexcept
+  {
+    return entries_.empty();
+  }
+
+  size_t size() const noexcept
+  {
+    return entries_.size();
+  }
+
+  void clear() noexcept
+  {
+    entries_.clear();
+  }
+
+  std::vector<Entry>::const_iterator begin() const noexcept
+  {
+    return entries_.begin();
+  }
+
+  std::vector<Entry>::const_iterator end() const noexcept
+  {
+    return entries_.end();
+  }
+
+  /*
+   * Converts the props to the `folly::dynamic` object expected by the
+   * platform commit callbacks.
+   */
+  folly::dynamic toDynamic() const;
+
+  /*
+   * Stores the props into `builder`. Props with a typed representation in
+   * AnimatedProps are set directly, all others are packed into RawProps.
+   */
+  void storeInto(AnimatedPropsBuilder &builder) const;
+
+ private:
+  std::vector<Entry> entries_;
+};
+
+} // namespace facebook::react
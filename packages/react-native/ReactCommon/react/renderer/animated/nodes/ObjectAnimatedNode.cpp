@@ -27,15 +27,15 @@ ObjectAnimatedNode::ObjectAnimatedNode(
     : AnimatedNode(tag, config, manager, AnimatedNodeType::Object) {}
 
 void ObjectAnimatedNode::collectViewUpdates(
-    std::string propKey,
-    folly::dynamic& props) {
+    std::string_view propKey,
+    AnimatedViewProps& props) {
   const auto& value = getConfig()["value"];
   switch (value.type()) {
     case folly::dynamic::OBJECT: {
-      props.insert(propKey, collectViewUpdatesObjectHelper(value));
+      props[propKey] = collectViewUpdatesObjectHelper(value);
     } break;
     case folly::dynamic::ARRAY: {
-      props.insert(propKey, collectViewUpdatesArrayHelper(value));
+      props[propKey] = collectViewUpdatesArrayHelper(value);
     } break;
     default: {
       LOG(ERROR) << "Invalid value type for ObjectAnimatedNode";
@@ -14,13 +14,15 @@
 #include "AnimatedNode.h"
 
 #include <folly/dynamic.h>
+#include <react/renderer/animated/internal/AnimatedViewProps.h>
+#include <string_view>
 
 namespace facebook::react {
 
 class ObjectAnimatedNode final : public AnimatedNode {
  public:
   ObjectAnimatedNode(Tag tag, const folly::dynamic &config, NativeAnimatedNodesManager &manager);
-  void collectViewUpdates(std::string propKey, folly::dynamic &props);
+  void collectViewUpdates(std::string_view propKey, AnimatedViewProps &props);
 
  private:
   folly::dynamic collectViewUpdatesObjectHelper(const folly::dynamic &value) const;
@@ -24,10 +24,9 @@ namespace facebook::react {
 namespace {
 
 bool isLayoutStyleUpdated(
-    const folly::dynamic& props,
+    const std::vector<std::pair<std::string, Tag>>& propsConfig,
     NativeAnimatedNodesManager& manager) {
-  for (const auto& entry : props.items()) {
-    auto nodeTag = static_cast<Tag>(entry.second.asInt());
+  for (const auto& [_, nodeTag] : propsConfig) {
     if (const auto& node = manager.getAnimatedNode<AnimatedNode>(nodeTag)) {
       if (node->type() == AnimatedNodeType::Style) {
         if (const auto& styleNode =
@@ -49,11 +48,16 @@ PropsAnimatedNode::PropsAnimatedNode(
     Tag tag,
     const folly::dynamic& config,
     NativeAnimatedNodesManager& manager)
-    : AnimatedNode(tag, config, manager, AnimatedNodeType::Props),
-      props_(folly::dynamic::object()) {
+    : AnimatedNode(tag, config, manager, AnimatedNodeType::Props) {
   if (auto it = getConfig().find("rootTag"); it != getConfig().items().end()) {
     connectedRootTag_ = static_cast<Tag>(it->second.asInt());
   }
+  const auto& configProps = getConfig()["props"];
+  propsConfig_.reserve(configProps.size());
+  for (const auto& entry : configProps.items()) {
+    propsConfig_.emplace_back(
+        entry.first.asString(), static_cast<Tag>(entry.second.asInt()));
+  }
 }
 
 void PropsAnimatedNode::connectToShadowNodeFamily(
@@ -87,13 +91,13 @@ void PropsAnimatedNode::restoreDefaultValues() {
     if (ReactNativeFeatureFlags::useSharedAnimatedBackend()) {
       manager_->schedulePropsCommit(
           connectedViewTag_,
-          folly::dynamic::object(),
+          AnimatedViewProps{},
           false,
           false,
           shadowNodeFamily_);
     } else {
       manager_->schedulePropsCommit(
-          connectedViewTag_, folly::dynamic::object(), false, false);
+          connectedViewTag_, AnimatedViewProps{}, false, false);
     }
   }
 }
@@ -110,10 +114,7 @@ void PropsAnimatedNode::update(bool forceFabricCommit) {
   // TODO: T190192206 consolidate shared update logic between
   // Props/StyleAnimatedNode
   std::lock_guard<std::mutex> lock(propsMutex_);
-  const auto& configProps = getConfig()["props"];
-  for (const auto& entry : configProps.items()) {
-    auto propName = entry.first.asString();
-    auto nodeTag = static_cast<Tag>(entry.second.asInt());
+  for (const auto& [propName, nodeTag] : propsConfig_) {
     if (auto node = manager_->getAnimatedNode<AnimatedNode>(nodeTag)) {
       switch (node->type()) {
         case AnimatedNodeType::Value:
@@ -129,19 +130,16 @@ void PropsAnimatedNode::update(bool forceFabricCommit) {
           if (const auto& valueNode =
                   manager_->getAnimatedNode<ValueAnimatedNode>(nodeTag)) {
             if (valueNode->getIsColorValue()) {
-              props_.insert(
-                  propName.c_str(),
-                  static_cast<int32_t>(valueNode->getValue()));
+              props_[propName] = static_cast<int32_t>(valueNode->getValue());
             } else {
-              props_.insert(propName.c_str(), valueNode->getValue());
+              props_[propName] = valueNode->getValue();
             }
           }
         } break;
         case AnimatedNodeType::Color: {
           if (const auto& colorNode =
                   manager_->getAnimatedNode<ColorAnimatedNode>(nodeTag)) {
-            props_.insert(
-                propName.c_str(), static_cast<int32_t>(colorNode->getColor()));
+            props_[propName] = static_cast<int32_t>(colorNode->getColor());
           }
         } break;
         case AnimatedNodeType::Style: {
@@ -164,7 +162,7 @@ void PropsAnimatedNode::update(bool forceFabricCommit) {
     }
   }
 
-  layoutStyleUpdated_ = isLayoutStyleUpdated(getConfig()["props"], *manager_);
+  layoutStyleUpdated_ = isLayoutStyleUpdated(propsConfig_, *manager_);
 
   if (ReactNativeFeatureFlags::useSharedAnimatedBackend()) {
     manager_->schedulePropsCommit(
@@ -13,9 +13,13 @@
 
 #include "AnimatedNode.h"
 
+#include <react/renderer/animated/internal/AnimatedViewProps.h>
 #include <react/renderer/animated/internal/primitives.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace facebook::react {
 class PropsAnimatedNode final : public AnimatedNode {
@@ -43,7 +47,7 @@ class PropsAnimatedNode final : public AnimatedNode {
   folly::dynamic props()
   {
     std::lock_guard<std::mutex> lock(propsMutex_);
-    return props_;
+    return props_.toDynamic();
   }
 
   void update() override;
@@ -51,8 +55,12 @@ class PropsAnimatedNode final : public AnimatedNode {
   void update(bool forceFabricCommit);
 
  private:
+  // Prop names and the tags of the nodes driving them, parsed once from the
+  // config.
+  std::vector<std::pair<std::string, Tag>> propsConfig_;
+
   std::mutex propsMutex_;
-  folly::dynamic props_;
+  AnimatedViewProps props_;
   bool layoutStyleUpdated_{false};
 
   Tag connectedViewTag_{animated::undefinedAnimatedNodeIdentifier};
@@ -22,10 +22,9 @@ namespace facebook::react {
 
 namespace {
 
-bool isLayoutPropsUpdated(const folly::dynamic& props) {
-  for (const auto& styleNodeProp : props.items()) {
-    if (getDirectManipulationAllowlist().count(
-            styleNodeProp.first.asString()) == 0u) {
+bool isLayoutPropsUpdated(const AnimatedViewProps& props) {
+  for (const auto& [propName, _] : props) {
+    if (getDirectManipulationAllowlist().count(propName) == 0u) {
       return true;
     }
   }
@@ -39,13 +38,17 @@ StyleAnimatedNode::StyleAnimatedNode(
     Tag tag,
     const folly::dynamic& config,
     NativeAnimatedNodesManager& manager)
-    : AnimatedNode(tag, config, manager, AnimatedNodeType::Style) {}
-
-void StyleAnimatedNode::collectViewUpdates(folly::dynamic& props) {
+    : AnimatedNode(tag, config, manager, AnimatedNodeType::Style) {
   const auto& style = getConfig()["style"];
+  styleConfig_.reserve(style.size());
   for (const auto& styleProp : style.items()) {
-    auto propName = styleProp.first.asString();
-    const auto nodeTag = static_cast<Tag>(styleProp.second.asInt());
+    styleConfig_.emplace_back(
+        styleProp.first.asString(), static_cast<Tag>(styleProp.second.asInt()));
+  }
+}
+
+void StyleAnimatedNode::collectViewUpdates(AnimatedViewProps& props) {
+  for (const auto& [propName, nodeTag] : styleConfig_) {
     if (auto node = manager_->getAnimatedNode<AnimatedNode>(nodeTag)) {
       switch (node->type()) {
         case AnimatedNodeType::Transform: {
@@ -67,20 +70,16 @@ void StyleAnimatedNode::collectViewUpdates(folly::dynamic& props) {
           if (const auto valueNode =
                   manager_->getAnimatedNode<ValueAnimatedNode>(nodeTag)) {
             if (valueNode->getIsColorValue()) {
-              props.insert(
-                  propName.c_str(),
-                  static_cast<int32_t>(valueNode->getValue()));
+              props[propName] = static_cast<int32_t>(valueNode->getValue());
             } else {
-              props.insert(propName.c_str(), valueNode->getValue());
+              props[propName] = valueNode->getValue();
             }
           }
         } break;
         case AnimatedNodeType::Color: {
           if (const auto colorAnimNode =
                   manager_->getAnimatedNode<ColorAnimatedNode>(nodeTag)) {
-            props.insert(
-                propName.c_str(),
-                static_cast<int32_t>(colorAnimNode->getColor()));
+            props[propName] = static_cast<int32_t>(colorAnimNode->getColor());
           }
         } break;
         case AnimatedNodeType::Object: {
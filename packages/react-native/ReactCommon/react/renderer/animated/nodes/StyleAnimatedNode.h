@@ -14,12 +14,16 @@
 #include "AnimatedNode.h"
 
 #include <folly/dynamic.h>
+#include <react/renderer/animated/internal/AnimatedViewProps.h>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace facebook::react {
 class StyleAnimatedNode final : public AnimatedNode {
  public:
   StyleAnimatedNode(Tag tag, const folly::dynamic &config, NativeAnimatedNodesManager &manager);
-  void collectViewUpdates(folly::dynamic &props);
+  void collectViewUpdates(AnimatedViewProps &props);
 
   bool isLayoutStyleUpdated() const noexcept
   {
@@ -27,6 +31,9 @@ class StyleAnimatedNode final : public AnimatedNode {
   }
 
  private:
+  // Style prop names and the tags of the nodes driving them, parsed once from
+  // the config.
+  std::vector<std::pair<std::string, Tag>> styleConfig_;
   bool layoutStyleUpdated_{};
 };
 } // namespace facebook::react
@@ -13,6 +13,7 @@
 
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <react/renderer/animated/internal/primitives.h>
 #include <react/renderer/animated/nodes/ValueAnimatedNode.h>
 #include <utility>
 
@@ -30,29 +31,48 @@ TransformAnimatedNode::TransformAnimatedNode(
     Tag tag,
     const folly::dynamic& config,
     NativeAnimatedNodesManager& manager)
-    : AnimatedNode(tag, config, manager, AnimatedNodeType::Transform) {}
-
-void TransformAnimatedNode::collectViewUpdates(folly::dynamic& props) {
-  folly::dynamic transforms = folly::dynamic::array();
-  auto transformsArray = getConfig()[sTransformsName];
+    : AnimatedNode(tag, config, manager, AnimatedNodeType::Transform) {
+  const auto& transformsArray = getConfig()[sTransformsName];
   react_native_assert(transformsArray.type() == folly::dynamic::ARRAY);
+  transformConfigs_.reserve(transformsArray.size());
   for (const auto& transform : transformsArray) {
-    std::optional<double> value;
+    auto& transformConfig = transformConfigs_.emplace_back(
+        TransformConfig{
+            .property = transform[sPropertyName].asString(),
+            .nodeTag = animated::undefinedAnimatedNodeIdentifier,
+            .value = 0});
     if (transform[sTypeName].asString() == sAnimatedName) {
-      const auto inputTag = static_cast<Tag>(transform[sNodeTagName].asInt());
-      if (const auto node =
-              manager_->getAnimatedNode<ValueAnimatedNode>(inputTag)) {
+      transformConfig.nodeTag =
+          static_cast<Tag>(transform[sNodeTagName].asInt());
+    } else {
+      transformConfig.value = transform[sValueName].asDouble();
+    }
+  }
+}
+
+void TransformAnimatedNode::collectViewUpdates(AnimatedViewProps& props) {
+  auto& transformsValue = props[sTransformPropName];
+  if (!std::holds_alternative<AnimatedTransformOperations>(transformsValue)) {
+    transformsValue = AnimatedTransformOperations{};
+  }
+  auto& transforms = std::get<AnimatedTransformOperations>(transformsValue);
+  transforms.clear();
+  for (const auto& transformConfig : transformConfigs_) {
+    std::optional<double> value;
+    if (transformConfig.nodeTag != animated::undefinedAnimatedNodeIdentifier) {
+      if (const auto node = manager_->getAnimatedNode<ValueAnimatedNode>(
+              transformConfig.nodeTag)) {
         value = node->getValue();
       }
     } else {
-      value = transform[sValueName].asDouble();
+      value = transformConfig.value;
     }
     if (value) {
-      const auto property = transform[sPropertyName].asString();
-      transforms.push_back(folly::dynamic::object(property, value.value()));
+      transforms.push_back(
+          AnimatedTransformOperation{
+              .property = transformConfig.property, .value = value.value()});
     }
   }
-  props[sTransformPropName] = std::move(transforms);
 }
 
 } // namespace facebook::react
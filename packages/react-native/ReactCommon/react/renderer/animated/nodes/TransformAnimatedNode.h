@@ -13,11 +13,15 @@
 
 #include "AnimatedNode.h"
 
+#include <react/renderer/animated/internal/AnimatedViewProps.h>
+#include <vector>
+
 namespace facebook::react {
 
 struct TransformConfig {
  public:
   std::string property;
+  // `animated::undefinedAnimatedNodeIdentifier` for static operations.
   Tag nodeTag;
   double value;
 };
@@ -26,6 +30,9 @@ class TransformAnimatedNode final : public AnimatedNode {
  public:
   TransformAnimatedNode(Tag tag, const folly::dynamic &config, NativeAnimatedNodesManager &manager);
 
-  void collectViewUpdates(folly::dynamic &props);
+  void collectViewUpdates(AnimatedViewProps &props);
+
+ private:
+  std::vector<TransformConfig> transformConfigs_;
 };
 } // namespace facebook::react
@@ -190,6 +190,49 @@ TEST_F(AnimatedNodeTests, ModulusAnimatedNode) {
   EXPECT_EQ(nodesManager_->getValue(moduloTag), std::fmod(8.6, 3.1));
 }
 
+TEST_F(AnimatedNodeTests, updateNodesOnlyEvaluatesDependentNodes) {
+  initNodesManager();
+
+  auto rootTag = getNextRootViewTag();
+
+  // Two independent `value -> modulus` chains.
+  auto firstValueTag = ++rootTag;
+  auto firstModuloTag = ++rootTag;
+  auto secondValueTag = ++rootTag;
+  auto secondModuloTag = ++rootTag;
+  for (auto [valueTag, moduloTag] :
+       {std::pair{firstValueTag, firstModuloTag},
+        std::pair{secondValueTag, secondModuloTag}}) {
+    nodesManager_->createAnimatedNode(
+        valueTag,
+        folly::dynamic::object("type", "value")("value", 0)("offset", 0));
+    nodesManager_->createAnimatedNode(
+        moduloTag,
+        folly::dynamic::object("type", "modulus")("input", valueTag)(
+            "modulus", 3));
+    nodesManager_->connectAnimatedNodes(valueTag, moduloTag);
+  }
+
+  runAnimationFrame(0);
+  EXPECT_EQ(nodesManager_->getGraphStats().lastEvaluatedNodesCount, 4u);
+  EXPECT_EQ(nodesManager_->getGraphStats().orderRebuildsCount, 1u);
+
+  nodesManager_->setAnimatedNodeValue(firstValueTag, 4);
+  runAnimationFrame(0);
+  EXPECT_EQ(nodesManager_->getValue(firstModuloTag), 1);
+  EXPECT_EQ(nodesManager_->getGraphStats().lastEvaluatedNodesCount, 2u);
+  EXPECT_EQ(nodesManager_->getGraphStats().totalEvaluatedNodesCount, 6u);
+  EXPECT_EQ(nodesManager_->getGraphStats().orderRebuildsCount, 1u);
+
+  // Changing the graph rebuilds the order before the next update.
+  nodesManager_->disconnectAnimatedNodes(secondValueTag, secondModuloTag);
+  nodesManager_->setAnimatedNodeValue(secondValueTag, 5);
+  runAnimationFrame(0);
+  EXPECT_EQ(nodesManager_->getValue(secondModuloTag), 0);
+  EXPECT_EQ(nodesManager_->getGraphStats().lastEvaluatedNodesCount, 1u);
+  EXPECT_EQ(nodesManager_->getGraphStats().orderRebuildsCount, 2u);
+}
+
 TEST_F(AnimatedNodeTests, DiffClampAnimatedNode) {
   initNodesManager();
 
@@ -312,8 +355,9 @@ TEST_F(AnimatedNodeTests, ObjectAnimatedNode) {
 
   const auto objectNode =
       nodesManager_->getAnimatedNode<ObjectAnimatedNode>(objectTag);
-  folly::dynamic collectedProps = folly::dynamic::object();
-  objectNode->collectViewUpdates("test", collectedProps);
+  AnimatedViewProps collectedViewProps;
+  objectNode->collectViewUpdates("test", collectedViewProps);
+  const auto collectedProps = collectedViewProps.toDynamic();
 
   const auto expected = folly::dynamic::object(
       "test",
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/animated/internal/AnimatedViewProps.h>
+#include <react/renderer/graphics/Color.h>
+
+namespace facebook::react {
+
+TEST(AnimatedViewPropsTest, assignmentOverridesValueInPlace) {
+  auto props = AnimatedViewProps{};
+  props["opacity"] = 0.5;
+  props["backgroundColor"] = static_cast<int32_t>(0xFF00FF00);
+  props["opacity"] = 0.25;
+
+  EXPECT_EQ(props.size(), 2u);
+  EXPECT_EQ(props.begin()->first, "opacity");
+  EXPECT_EQ(std::get<double>(*props.find("opacity")), 0.25);
+  EXPECT_EQ(props.find("transform"), nullptr);
+}
+
+TEST(AnimatedViewPropsTest, mergeOverridesExistingValues) {
+  auto props = AnimatedViewProps{};
+  props["opacity"] = 0.5;
+  props["shadowRadius"] = 2.0;
+
+  auto update = AnimatedViewProps{};
+  update["opacity"] = 1.0;
+  update["width"] = 100.0;
+  props.merge(update);
+
+  EXPECT_EQ(props.size(), 3u);
+  EXPECT_EQ(std::get<double>(*props.find("opacity")), 1.0);
+  EXPECT_EQ(std::get<double>(*props.find("shadowRadius")), 2.0);
+  EXPECT_EQ(std::get<double>(*props.find("width")), 100.0);
+}
+
+TEST(AnimatedViewPropsTest, toDynamic) {
+  auto props = AnimatedViewProps{};
+  props["opacity"] = 0.5;
+  props["backgroundColor"] = static_cast<int32_t>(0xFF00FF00);
+  props["transform"] = AnimatedTransformOperations{
+      {.property = "translateX", .value = 10},
+      {.property = "scale", .value = 2}};
+  props["shadowOffset"] = folly::dynamic::object("width", 1)("height", 2);
+
+  auto dynamic = props.toDynamic();
+  EXPECT_EQ(dynamic["opacity"], 0.5);
+  EXPECT_EQ(dynamic["backgroundColor"], static_cast<int32_t>(0xFF00FF00));
+  EXPECT_EQ(dynamic["transform"].size(), 2u);
+  EXPECT_EQ(dynamic["transform"][0]["translateX"], 10.0);
+  EXPECT_EQ(dynamic["transform"][1]["scale"], 2.0);
+  EXPECT_EQ(dynamic["shadowOffset"]["height"], 2);
+}
+
+TEST(AnimatedViewPropsTest, storeIntoUsesTypedProps) {
+  auto props = AnimatedViewProps{};
+  props["opacity"] = 0.5;
+  props["backgroundColor"] = static_cast<int32_t>(0xFF00FF00);
+  props["transform"] = AnimatedTransformOperations{
+      {.property = "translateY", .value = 10},
+      {.property = "rotate", .value = 1.5}};
+
+  auto builder = AnimatedPropsBuilder{};
+  props.storeInto(builder);
+  auto animatedProps = builder.get();
+
+  EXPECT_EQ(animatedProps.rawProps, nullptr);
+  ASSERT_EQ(animatedProps.props.size(), 3u);
+
+  EXPECT_EQ(animatedProps.props[0]->propName, OPACITY);
+  EXPECT_EQ(get<Float>(*animatedProps.props[0]), 0.5f);
+
+  EXPECT_EQ(animatedProps.props[1]->propName, BACKGROUND_COLOR);
+  auto color = get<SharedColor>(*animatedProps.props[1]);
+  EXPECT_EQ(alphaFromColor(color), 255);
+  EXPECT_EQ(redFromColor(color), 0);
+  EXPECT_EQ(greenFromColor(color), 255);
+  EXPECT_EQ(blueFromColor(color), 0);
+
+  EXPECT_EQ(animatedProps.props[2]->propName, TRANSFORM);
+  const auto& transform = get<Transform>(*animatedProps.props[2]);
+  ASSERT_EQ(transform.operations.size(), 2u);
+  EXPECT_EQ(transform.operations[0].type, TransformOperationType::Translate);
+  EXPECT_EQ(transform.operations[0].y.value, 10.0f);
+  EXPECT_EQ(transform.operations[1].type, TransformOperationType::Rotate);
+  EXPECT_EQ(transform.operations[1].z.value, 1.5f);
+}
+
+TEST(AnimatedViewPropsTest, storeIntoFallsBackToRawProps) {
+  auto props = AnimatedViewProps{};
+  props["opacity"] = 0.5;
+  props["width"] = 100.0;
+  props["transform"] = AnimatedTransformOperations{
+      {.property = "perspective", .value = 1000},
+      {.property = "rotateX", .value = 0.5}};
+
+  auto builder = AnimatedPropsBuilder{};
+  props.storeInto(builder);
+  auto animatedProps = builder.get();
+
+  ASSERT_EQ(animatedProps.props.size(), 1u);
+  EXPECT_EQ(animatedProps.props[0]->propName, OPACITY);
+
+  ASSERT_NE(animatedProps.rawProps, nullptr);
+  auto rawProps = animatedProps.rawProps->toDynamic();
+  EXPECT_EQ(rawProps.size(), 2u);
+  EXPECT_EQ(rawProps["width"], 100.0);
+  EXPECT_EQ(rawProps["transform"][0]["perspective"], 1000.0);
+  EXPECT_EQ(rawProps["transform"][1]["rotateX"], 0.5);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AnimationTestsBase.h"
+
+#include <react/renderer/animated/drivers/AnimationDriverBatch.h>
+#include <react/renderer/animated/drivers/AnimationDriverUtils.h>
+#include <react/renderer/animated/drivers/DecayAnimationDriver.h>
+#include <react/renderer/animated/drivers/FrameAnimationDriver.h>
+#include <react/renderer/animated/drivers/SpringAnimationDriver.h>
+#include <react/renderer/core/ReactRootViewTagGenerator.h>
+
+#include <unordered_set>
+
+namespace facebook::react {
+
+/*
+ * Every animation is started twice, on two value nodes with the same initial
+ * value. One copy is stepped by AnimationDriverBatch and the other by
+ * AnimationDriver::runAnimationStep; both must produce the same values and
+ * finish on the same frame.
+ */
+class AnimationDriverBatchTest : public AnimationTestsBase {
+ protected:
+  void SetUp() override {
+    initNodesManager();
+  }
+
+  static folly::dynamic springConfig(double damping, int iterations = 1) {
+    return folly::dynamic::object("type", "spring")("stiffness", 100)(
+        "damping", damping)("mass", 1)("initialVelocity", 0)("toValue", 100)(
+        "restSpeedThreshold", 0.001)("restDisplacementThreshold", 0.001)(
+        "overshootClamping", false)("iterations", iterations);
+  }
+
+  static folly::dynamic decayConfig(int iterations = 1) {
+    return folly::dynamic::object("type", "decay")("velocity", 1.0)(
+        "deceleration", 0.998)("iterations", iterations);
+  }
+
+  static folly::dynamic framesConfig() {
+    return folly::dynamic::object("type", "frames")(
+        "frames", folly::dynamic::array(0.0, 0.25, 0.5, 0.75, 1.0))(
+        "toValue", 100);
+  }
+
+  // Returns the id of the animation, which is the same in both driver sets.
+  int addAnimation(const folly::dynamic& config, double initialValue = 0) {
+    const auto id = static_cast<int>(animations_.size()) + 1;
+    const auto batchTag = createValueNode(initialValue);
+    const auto referenceTag = createValueNode(initialValue);
+    batchDrivers_.emplace(id, createDriver(id, batchTag, config));
+    referenceDrivers_.emplace(id, createDriver(id, referenceTag, config));
+    animations_.emplace(id, std::make_pair(batchTag, referenceTag));
+    return id;
+  }
+
+  void dropValueNodes(int animationId) {
+    const auto [batchTag, referenceTag] = animations_.at(animationId);
+    nodesManager_->dropAnimatedNode(batchTag);
+    nodesManager_->dropAnimatedNode(referenceTag);
+    droppedAnimations_.insert(animationId);
+  }
+
+  void runFrame(double timestamp) {
+    batch_.runAnimationStep(batchDrivers_, timestamp);
+    for (const auto& [_id, driver] : referenceDrivers_) {
+      driver->runAnimationStep(timestamp);
+    }
+  }
+
+  void expectEquivalent() {
+    for (const auto& [id, tags] : animations_) {
+      EXPECT_EQ(
+          batchDrivers_.at(id)->getIsComplete(),
+          referenceDrivers_.at(id)->getIsComplete())
+          << "animation " << id;
+      if (droppedAnimations_.contains(id)) {
+        continue;
+      }
+
+      const auto batchValue = nodesManager_->getValue(tags.first);
+      const auto referenceValue = nodesManager_->getValue(tags.second);
+      ASSERT_TRUE(batchValue.has_value());
+      ASSERT_TRUE(referenceValue.has_value());
+      EXPECT_DOUBLE_EQ(*batchValue, *referenceValue) << "animation " << id;
+    }
+  }
+
+  // Runs `frameCount` frames, checking after each one.
+  void runFramesAndExpectEquivalent(double startTime, int frameCount) {
+    for (int frame = 0; frame < frameCount; frame++) {
+      runFrame(startTime + frame * SingleFrameIntervalMs);
+      expectEquivalent();
+    }
+  }
+
+  bool isComplete(int animationId) const {
+    return batchDrivers_.at(animationId)->getIsComplete();
+  }
+
+  std::unordered_map<int, std::unique_ptr<AnimationDriver>> batchDrivers_;
+  std::unordered_map<int, std::unique_ptr<AnimationDriver>> referenceDrivers_;
+
+ private:
+  Tag createValueNode(double initialValue) {
+    const auto tag = ++rootTag_;
+    nodesManager_->createAnimatedNode(
+        tag,
+        folly::dynamic::object("type", "value")("value", initialValue)(
+            "offset", 0));
+    return tag;
+  }
+
+  std::unique_ptr<AnimationDriver>
+  createDriver(int id, Tag valueTag, const folly::dynamic& config) {
+    const auto type =
+        AnimationDriver::getDriverTypeByName(config["type"].asString());
+    std::unique_ptr<AnimationDriver> driver;
+    switch (type.value()) {
+      case AnimationDriverType::Frames:
+        driver = std::make_unique<FrameAnimationDriver>(
+            id, valueTag, std::nullopt, config, nodesManager_.get());
+        break;
+      case AnimationDriverType::Spring:
+        driver = std::make_unique<SpringAnimationDriver>(
+            id, valueTag, std::nullopt, config, nodesManager_.get());
+        break;
+      case AnimationDriverType::Decay:
+        driver = std::make_unique<DecayAnimationDriver>(
+            id, valueTag, std::nullopt, config, nodesManager_.get());
+        break;
+    }
+    driver->startAnimation();
+    return driver;
+  }
+
+  AnimationDriverBatch batch_;
+  std::unordered_map<int, std::pair<Tag, Tag>> animations_;
+  std::unordered_set<int> droppedAnimations_;
+  Tag rootTag_{getNextRootViewTag()};
+};
+
+TEST_F(AnimationDriverBatchTest, underdampedSpring) {
+  const auto id = addAnimation(springConfig(10));
+
+  runFramesAndExpectEquivalent(10000, 300);
+  EXPECT_TRUE(isComplete(id));
+}
+
+TEST_F(AnimationDriverBatchTest, criticallyDampedSpring) {
+  const auto id = addAnimation(springConfig(20));
+
+  runFramesAndExpectEquivalent(10000, 300);
+  EXPECT_TRUE(isComplete(id));
+}
+
+TEST_F(AnimationDriverBatchTest, overdampedSpring) {
+  const auto id = addAnimation(springConfig(40));
+
+  runFramesAndExpectEquivalent(10000, 300);
+  EXPECT_TRUE(isComplete(id));
+}
+
+TEST_F(AnimationDriverBatchTest, decay) {
+  const auto id = addAnimation(decayConfig(), 10);
+
+  runFramesAndExpectEquivalent(10000, 600);
+  EXPECT_TRUE(isComplete(id));
+}
+
+TEST_F(AnimationDriverBatchTest, mixedDriverTypesInOneBatch) {
+  addAnimation(springConfig(10));
+  addAnimation(springConfig(20), 50);
+  addAnimation(springConfig(40), 200);
+  addAnimation(decayConfig());
+  addAnimation(framesConfig());
+  addAnimation(springConfig(15));
+
+  runFramesAndExpectEquivalent(10000, 600);
+  for (const auto& [id, _driver] : batchDrivers_) {
+    EXPECT_TRUE(isComplete(id)) << "animation " << id;
+  }
+}
+
+TEST_F(AnimationDriverBatchTest, iterationsRestartFromTheInitialValue) {
+  const auto springId = addAnimation(springConfig(10, 3));
+  const auto decayId = addAnimation(decayConfig(2), 10);
+  const auto infiniteId = addAnimation(springConfig(40, -1));
+
+  runFramesAndExpectEquivalent(10000, 1500);
+  EXPECT_TRUE(isComplete(springId));
+  EXPECT_TRUE(isComplete(decayId));
+  EXPECT_FALSE(isComplete(infiniteId));
+}
+
+TEST_F(AnimationDriverBatchTest, valueNodeDroppedMidAnimation) {
+  const auto droppedSpringId = addAnimation(springConfig(10));
+  const auto droppedDecayId = addAnimation(decayConfig());
+  const auto springId = addAnimation(springConfig(10));
+  const auto decayId = addAnimation(decayConfig());
+
+  const double startTime = 10000;
+  runFramesAndExpectEquivalent(startTime, 10);
+  EXPECT_FALSE(isComplete(droppedSpringId));
+  EXPECT_FALSE(isComplete(droppedDecayId));
+
+  dropValueNodes(droppedSpringId);
+  dropValueNodes(droppedDecayId);
+
+  runFramesAndExpectEquivalent(startTime + 10 * SingleFrameIntervalMs, 1);
+  EXPECT_TRUE(isComplete(droppedSpringId));
+  EXPECT_TRUE(isComplete(droppedDecayId));
+  EXPECT_FALSE(isComplete(springId));
+  EXPECT_FALSE(isComplete(decayId));
+
+  runFramesAndExpectEquivalent(startTime + 11 * SingleFrameIntervalMs, 600);
+  EXPECT_TRUE(isComplete(springId));
+  EXPECT_TRUE(isComplete(decayId));
+}
+
+} // namespace facebook::react
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <react/renderer/animated/drivers/AnimationDriverUtils.h>
+#include <chrono>
+#include <memory>
+
+namespace facebook::react {
+
+namespace {
+
+std::chrono::steady_clock::time_point sNow{};
+
+std::chrono::steady_clock::time_point now() {
+  return sNow;
+}
+
+void advanceFrame() {
+  sNow += std::chrono::microseconds(
+      static_cast<int64_t>(SingleFrameIntervalMs * 1000));
+}
+
+/*
+ * Builds `viewCount` views, each with its opacity and `translateY` driven by
+ * its own looping spring animation, like a list of cards animating in.
+ */
+std::shared_ptr<NativeAnimatedNodesManager> createNodesManager(
+    int64_t viewCount) {
+  auto nodesManager = std::make_shared<NativeAnimatedNodesManager>(
+      [](Tag /*reactTag*/, const folly::dynamic& props) {
+        benchmark::DoNotOptimize(props);
+      },
+      [](std::unordered_map<Tag, folly::dynamic>& nodesProps) {
+        benchmark::DoNotOptimize(nodesProps);
+      },
+      nullptr);
+
+  Tag tag = 1;
+  for (int64_t i = 0; i < viewCount; i++) {
+    auto valueTag = tag++;
+    nodesManager->createAnimatedNode(
+        valueTag,
+        folly::dynamic::object("type", "value")("value", 0)("offset", 0));
+
+    auto transformTag = tag++;
+    nodesManager->createAnimatedNode(
+        transformTag,
+        folly::dynamic::object("type", "transform")(
+            "transforms",
+            folly::dynamic::array(
+                folly::dynamic::object("type", "animated")(
+                    "property", "translateY")("nodeTag", valueTag),
+                folly::dynamic::object("type", "static")("property", "scale")(
+                    "value", 1.5))));
+    nodesManager->connectAnimatedNodes(valueTag, transformTag);
+
+    auto styleTag = tag++;
+    nodesManager->createAnimatedNode(
+        styleTag,
+        folly::dynamic::object("type", "style")(
+            "style",
+            folly::dynamic::object("opacity", valueTag)(
+                "transform", transformTag)));
+    nodesManager->connectAnimatedNodes(valueTag, styleTag);
+    nodesManager->connectAnimatedNodes(transformTag, styleTag);
+
+    auto propsTag = tag++;
+    nodesManager->createAnimatedNode(
+        propsTag,
+        folly::dynamic::object("type", "props")(
+            "props", folly::dynamic::object("style", styleTag)));
+    nodesManager->connectAnimatedNodes(styleTag, propsTag);
+    nodesManager->connectAnimatedNodeToView(propsTag, tag++);
+
+    nodesManager->startAnimatingNode(
+        static_cast<int>(i),
+        valueTag,
+        folly::dynamic::object("type", "spring")("stiffness", 100)(
+            "damping", 10)("mass", 1)("initialVelocity", 0)("toValue", 1)(
+            "restSpeedThreshold", 0.001)("restDisplacementThreshold", 0.001)(
+            "overshootClamping", false)("iterations", -1),
+        std::nullopt);
+  }
+
+  return nodesManager;
+}
+
+/*
+ * Time spent in a single `onRender` call while all the springs are running:
+ * stepping the drivers, updating the graph and committing the props of every
+ * view.
+ */
+void springAnimationsFrame(benchmark::State& state) {
+  g_setNativeAnimatedNowTimestampFunction(&now);
+  auto nodesManager = createNodesManager(state.range(0));
+
+  // The first frame only records the start time of the animations.
+  nodesManager->onRender();
+
+  for (auto _ : state) {
+    advanceFrame();
+    nodesManager->onRender();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+
+  g_setNativeAnimatedNowTimestampFunction(&std::chrono::steady_clock::now);
+}
+BENCHMARK(springAnimationsFrame)->Arg(10)->Arg(50)->Arg(200);
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -1150,7 +1150,7 @@ constexpr static MapBuffer::Key PA_KEY_MINIMUM_FONT_SIZE = 6;
 constexpr static MapBuffer::Key PA_KEY_MAXIMUM_FONT_SIZE = 7;
 constexpr static MapBuffer::Key PA_KEY_TEXT_ALIGN_VERTICAL = 8;
 
-inline MapBuffer toMapBuffer(const ParagraphAttributes &paragraphAttributes)
+inline MapBufferBuilder toMapBufferBuilder(const ParagraphAttributes &paragraphAttributes)
 {
   auto builder = MapBufferBuilder();
   builder.putInt(PA_KEY_MAX_NUMBER_OF_LINES, paragraphAttributes.maximumNumberOfLines);
@@ -1165,10 +1165,15 @@ inline MapBuffer toMapBuffer(const ParagraphAttributes &paragraphAttributes)
   builder.putDouble(PA_KEY_MINIMUM_FONT_SIZE, paragraphAttributes.minimumFontSize);
   builder.putDouble(PA_KEY_MAXIMUM_FONT_SIZE, paragraphAttributes.maximumFontSize);
 
-  return builder.build();
+  return builder;
 }
 
-inline MapBuffer toMapBuffer(const FontVariant &fontVariant)
+inline MapBuffer toMapBuffer(const ParagraphAttributes &paragraphAttributes)
+{
+  return toMapBufferBuilder(paragraphAttributes).build();
+}
+
+inline MapBufferBuilder toMapBufferBuilder(const FontVariant &fontVariant)
 {
   auto builder = MapBufferBuilder();
   int index = 0;
@@ -1248,10 +1253,15 @@ inline MapBuffer toMapBuffer(const FontVariant &fontVariant)
     builder.putString(index++, "stylistic-twenty");
   }
 
-  return builder.build();
+  return builder;
 }
 
-inline MapBuffer toMapBuffer(const TextAttributes &textAttributes)
+inline MapBuffer toMapBuffer(const FontVariant &fontVariant)
+{
+  return toMapBufferBuilder(fontVariant).build();
+}
+
+inline MapBufferBuilder toMapBufferBuilder(const TextAttributes &textAttributes)
 {
   auto builder = MapBufferBuilder();
   if (textAttributes.foregroundColor) {
@@ -1279,8 +1289,7 @@ inline MapBuffer toMapBuffer(const TextAttributes &textAttributes)
     builder.putString(TA_KEY_FONT_STYLE, toString(*textAttributes.fontStyle));
   }
   if (textAttributes.fontVariant.has_value()) {
-    auto fontVariantMap = toMapBuffer(*textAttributes.fontVariant);
-    builder.putMapBuffer(TA_KEY_FONT_VARIANT, fontVariantMap);
+    builder.putMapBuffer(TA_KEY_FONT_VARIANT, toMapBufferBuilder(*textAttributes.fontVariant));
   }
   if (textAttributes.allowFontScaling.has_value()) {
     builder.putBool(TA_KEY_ALLOW_FONT_SCALING, *textAttributes.allowFontScaling);
@@ -1348,14 +1357,19 @@ inline MapBuffer toMapBuffer(const TextAttributes &textAttributes)
       auto effectBuilder = MapBufferBuilder();
       effectBuilder.putString(TE_KEY_NAME, textAttributes.textEffects[i].name);
       effectBuilder.putString(TE_KEY_PROPS, folly::toJson(textAttributes.textEffects[i].props));
-      effectsBuilder.putMapBuffer(i, effectBuilder.build());
+      effectsBuilder.putMapBuffer(i, std::move(effectBuilder));
     }
-    builder.putMapBuffer(TA_KEY_TEXT_EFFECTS, effectsBuilder.build());
+    builder.putMapBuffer(TA_KEY_TEXT_EFFECTS, std::move(effectsBuilder));
   }
-  return builder.build();
+  return builder;
 }
 
-inline MapBuffer toMapBuffer(const AttributedString::Fragment &fragment)
+inline MapBuffer toMapBuffer(const TextAttributes &textAttributes)
+{
+  return toMapBufferBuilder(textAttributes).build();
+}
+
+inline MapBufferBuilder toMapBufferBuilder(const AttributedString::Fragment &fragment)
 {
   auto builder = MapBufferBuilder();
 
@@ -1368,19 +1382,23 @@ inline MapBuffer toMapBuffer(const AttributedString::Fragment &fragment)
     builder.putDouble(FR_KEY_WIDTH, fragment.parentShadowView.layoutMetrics.frame.size.width);
     builder.putDouble(FR_KEY_HEIGHT, fragment.parentShadowView.layoutMetrics.frame.size.height);
   }
-  auto textAttributesMap = toMapBuffer(fragment.textAttributes);
-  builder.putMapBuffer(FR_KEY_TEXT_ATTRIBUTES, textAttributesMap);
+  builder.putMapBuffer(FR_KEY_TEXT_ATTRIBUTES, toMapBufferBuilder(fragment.textAttributes));
 
-  return builder.build();
+  return builder;
 }
 
-inline MapBuffer toMapBuffer(const AttributedString &attributedString)
+inline MapBuffer toMapBuffer(const AttributedString::Fragment &fragment)
+{
+  return toMapBufferBuilder(fragment).build();
+}
+
+inline MapBufferBuilder toMapBufferBuilder(const AttributedString &attributedString)
 {
   auto fragmentsBuilder = MapBufferBuilder();
 
   int index = 0;
-  for (auto fragment : attributedString.getFragments()) {
-    fragmentsBuilder.putMapBuffer(index++, toMapBuffer(fragment));
+  for (const auto &fragment : attributedString.getFragments()) {
+    fragmentsBuilder.putMapBuffer(index++, toMapBufferBuilder(fragment));
   }
 
   auto builder = MapBufferBuilder();
@@ -1388,10 +1406,14 @@ inline MapBuffer toMapBuffer(const AttributedString &attributedString)
   // TODO: This truncates half the hash
   builder.putInt(AS_KEY_HASH, static_cast<int>(hash));
   builder.putString(AS_KEY_STRING, attributedString.getString());
-  builder.putMapBuffer(AS_KEY_BASE_ATTRIBUTES, toMapBuffer(attributedString.getBaseTextAttributes()));
-  auto fragmentsMap = fragmentsBuilder.build();
-  builder.putMapBuffer(AS_KEY_FRAGMENTS, fragmentsMap);
-  return builder.build();
+  builder.putMapBuffer(AS_KEY_BASE_ATTRIBUTES, toMapBufferBuilder(attributedString.getBaseTextAttributes()));
+  builder.putMapBuffer(AS_KEY_FRAGMENTS, std::move(fragmentsBuilder));
+  return builder;
+}
+
+inline MapBuffer toMapBuffer(const AttributedString &attributedString)
+{
+  return toMapBufferBuilder(attributedString).build();
 }
 
 #endif
@@ -23,6 +23,7 @@ void AndroidHorizontalScrollContentViewShadowNode::layout(
   if (layoutMetrics_.layoutDirection == LayoutDirection::RightToLeft &&
       layoutMetrics_.frame.origin.x < 0) {
     layoutMetrics_.frame.origin.x = 0;
+    invalidateSubtreeRevision();
   }
 }
 
@@ -442,6 +442,8 @@ void ParagraphShadowNode::layout(LayoutContext layoutContext) {
   if (paragraphShadowNode != this) {
     this->children_ =
         static_cast<const ParagraphShadowNode*>(paragraphShadowNode)->children_;
+    invalidateChildIndex();
+    invalidateSubtreeRevision();
   }
 }
 
@@ -21,9 +21,15 @@
 #include <react/renderer/debug/DebugStringConvertibleItem.h>
 #include <react/utils/FloatComparison.h>
 #include <yoga/Yoga.h>
+#include <yoga/algorithm/CalculateLayout.h>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 namespace facebook::react {
 
@@ -64,6 +70,167 @@ static int FabricDefaultYogaLog(
 
 thread_local LayoutContext threadLocalLayoutContext;
 
+namespace {
+
+/*
+ * A small, lazily created pool of threads used by parallel layout.
+ * Work items are claimed one by one from a shared counter by all workers and
+ * by the calling thread, so a thread that finishes a cheap subtree early
+ * picks up the next one instead of idling.
+ * Only one layout pass uses the pool at a time; concurrent callers (e.g.
+ * other surfaces) fall back to running their items on their own thread.
+ *
+ * On Android the pool has no workers: measure functions (e.g. of text) call
+ * into Java, and the pool threads are not attached to the JVM.
+ */
+class LayoutWorkerPool final {
+ public:
+  static LayoutWorkerPool& getInstance() {
+    // Leaked on purpose: the workers never exit.
+    static auto* instance = new LayoutWorkerPool();
+    return *instance;
+  }
+
+  void parallelFor(size_t count, const std::function<void(size_t)>& task) {
+    std::unique_lock jobLock(jobMutex_, std::try_to_lock);
+    if (!jobLock.owns_lock() || workerCount_ == 0 || count < 2) {
+      for (size_t index = 0; index < count; index++) {
+        task(index);
+      }
+      return;
+    }
+
+    auto job = std::make_shared<Job>(task, count);
+    {
+      std::lock_guard lock(mutex_);
+      job_ = job;
+      generation_++;
+    }
+    condition_.notify_all();
+
+    drain(*job);
+
+    std::unique_lock lock(mutex_);
+    done_.wait(lock, [&]() { return activeWorkers_ == 0; });
+    job_ = nullptr;
+  }
+
+ private:
+  static constexpr unsigned kMaxWorkerCount = 3;
+
+  /*
+   * A single `parallelFor` call. Workers only access a job through their own
+   * reference to it, so a worker that wakes up late can't observe the state
+   * of the next job: by then every item of its job is claimed, and it
+   * returns without calling `task`.
+   */
+  struct Job {
+    Job(const std::function<void(size_t)>& task, size_t count)
+        : task(task), count(count) {}
+
+    const std::function<void(size_t)>& task;
+    const size_t count;
+    std::atomic<size_t> nextIndex{0};
+  };
+
+  LayoutWorkerPool() {
+#ifndef __ANDROID__
+    auto concurrency = std::thread::hardware_concurrency();
+    workerCount_ =
+        concurrency > 1 ? std::min(concurrency - 1, kMaxWorkerCount) : 0;
+    for (unsigned i = 0; i < workerCount_; i++) {
+      std::thread([this]() { run(); }).detach();
+    }
+#endif
+  }
+
+  void run() {
+    auto seenGeneration = uint64_t{0};
+    while (true) {
+      auto job = std::shared_ptr<Job>{};
+      {
+        std::unique_lock lock(mutex_);
+        condition_.wait(
+            lock, [&]() { return generation_ != seenGeneration; });
+        seenGeneration = generation_;
+        job = job_;
+        if (job == nullptr) {
+          // The job already finished.
+          continue;
+        }
+        activeWorkers_++;
+      }
+
+      drain(*job);
+
+      {
+        std::lock_guard lock(mutex_);
+        activeWorkers_--;
+      }
+      done_.notify_all();
+    }
+  }
+
+  static void drain(Job& job) {
+    while (true) {
+      auto index = job.nextIndex.fetch_add(1, std::memory_order_relaxed);
+      if (index >= job.count) {
+        return;
+      }
+      job.task(index);
+    }
+  }
+
+  std::mutex jobMutex_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::condition_variable done_;
+  unsigned workerCount_{0};
+  uint64_t generation_{0};
+  unsigned activeWorkers_{0};
+  std::shared_ptr<Job> job_;
+};
+
+/*
+ * Returns `true` if the layout of the subtree rooted at the node depends on
+ * nothing but the node's own style, so it can be computed before (and
+ * independently from) the layout of its ancestors and siblings.
+ * That requires fixed point dimensions which neither flexing nor min/max
+ * constraints can change, and no values resolved against the owner's size.
+ */
+bool isLayoutBoundary(yoga::Node& node) {
+  if (node.getChildCount() == 0 || node.hasMeasureFunc()) {
+    return false;
+  }
+
+  const auto& style = node.style();
+  if (style.display() != yoga::Display::Flex ||
+      style.aspectRatio().isDefined() ||
+      !(style.flexBasis().isAuto() || style.flexBasis().isUndefined()) ||
+      node.resolveFlexGrow() != 0 || node.resolveFlexShrink() != 0) {
+    return false;
+  }
+
+  for (auto dimension : {yoga::Dimension::Width, yoga::Dimension::Height}) {
+    if (!style.dimension(dimension).isPoints() ||
+        style.minDimension(dimension).isDefined() ||
+        style.maxDimension(dimension).isDefined()) {
+      return false;
+    }
+  }
+
+  for (auto edge : yoga::ordinals<yoga::Edge>()) {
+    if (style.margin(edge).isPercent() || style.padding(edge).isPercent() ||
+        style.border(edge).isPercent()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace
+
 YogaLayoutableShadowNode::YogaLayoutableShadowNode(
     const ShadowNodeFragment& fragment,
     const ShadowNodeFamily::Shared& family,
@@ -682,6 +849,11 @@ void YogaLayoutableShadowNode::layoutTree(
 
   threadLocalLayoutContext = layoutContext;
 
+  if (layoutContext.enableParallelLayout) {
+    TraceSection s3("YogaLayoutableShadowNode::layoutBoundariesInParallel");
+    layoutBoundariesInParallel(layoutContext, yoga::scopedEnum(direction));
+  }
+
   {
     TraceSection s3("YogaLayoutableShadowNode::YGNodeCalculateLayout");
     YGNodeCalculateLayout(&yogaNode_, ownerWidth, ownerHeight, direction);
@@ -707,6 +879,72 @@ void YogaLayoutableShadowNode::layoutTree(
   layout(layoutContext);
 }
 
+void YogaLayoutableShadowNode::collectLayoutBoundaries(
+    yoga::Direction ownerDirection,
+    std::vector<std::pair<YogaLayoutableShadowNode*, yoga::Direction>>&
+        boundaries) {
+  auto direction = yogaNode_.resolveDirection(ownerDirection);
+
+  for (const auto& child : yogaLayoutableChildren_) {
+    // Children which are not owned yet are cloned by Yoga during the layout
+    // pass, and clean children will be served from Yoga's cache anyway.
+    if (!doesOwn(*child) || !child->yogaNode_.isDirty()) {
+      continue;
+    }
+
+    auto& mutableChild = const_cast<YogaLayoutableShadowNode&>(*child);
+    if (isLayoutBoundary(mutableChild.yogaNode_)) {
+      boundaries.emplace_back(&mutableChild, direction);
+    } else if (
+        mutableChild.yogaNode_.style().display() == yoga::Display::Flex) {
+      mutableChild.collectLayoutBoundaries(direction, boundaries);
+    }
+  }
+}
+
+void YogaLayoutableShadowNode::layoutBoundariesInParallel(
+    const LayoutContext& layoutContext,
+    yoga::Direction direction) {
+  auto boundaries =
+      std::vector<std::pair<YogaLayoutableShadowNode*, yoga::Direction>>{};
+  collectLayoutBoundaries(direction, boundaries);
+
+  if (boundaries.size() < 2) {
+    return;
+  }
+
+  LayoutWorkerPool::getInstance().parallelFor(
+      boundaries.size(), [&](size_t index) {
+        auto [shadowNode, ownerDirection] = boundaries[index];
+        auto& yogaNode = shadowNode->yogaNode_;
+
+        // Measure functions read the context from a thread-local variable.
+        threadLocalLayoutContext = layoutContext;
+
+        // The position of the node is determined by its owner during the main
+        // pass; make sure that laying it out as a root does not leak into it.
+        auto& layout = yogaNode.getLayout();
+        auto left = layout.position(yoga::PhysicalEdge::Left);
+        auto top = layout.position(yoga::PhysicalEdge::Top);
+        auto right = layout.position(yoga::PhysicalEdge::Right);
+        auto bottom = layout.position(yoga::PhysicalEdge::Bottom);
+
+        // Rounding to the pixel grid depends on absolute positions, so it is
+        // left to the main pass.
+        yoga::calculateLayout(
+            &yogaNode,
+            YGUndefined,
+            YGUndefined,
+            ownerDirection,
+            /* roundToPixelGrid */ false);
+
+        yogaNode.setLayoutPosition(left, yoga::PhysicalEdge::Left);
+        yogaNode.setLayoutPosition(top, yoga::PhysicalEdge::Top);
+        yogaNode.setLayoutPosition(right, yoga::PhysicalEdge::Right);
+        yogaNode.setLayoutPosition(bottom, yoga::PhysicalEdge::Bottom);
+      });
+}
+
 static EdgeInsets calculateOverflowInset(
     Rect contentFrame,
     Rect contentBounds) {
@@ -791,10 +1029,15 @@ void YogaLayoutableShadowNode::layout(LayoutContext layoutContext) {
     // logic later when render the view. The actual overflowInset value is not
     // changed as if the transform is not happening here.
     auto contentBounds = getContentBounds();
-    layoutMetrics_.overflowInset =
+    auto overflowInset =
         calculateOverflowInset(layoutMetrics_.frame, contentBounds);
-  } else {
+    if (layoutMetrics_.overflowInset != overflowInset) {
+      layoutMetrics_.overflowInset = overflowInset;
+      invalidateSubtreeRevision();
+    }
+  } else if (layoutMetrics_.overflowInset != EdgeInsets{}) {
     layoutMetrics_.overflowInset = {};
+    invalidateSubtreeRevision();
   }
 }
 
@@ -961,6 +1204,7 @@ void YogaLayoutableShadowNode::swapStyleLeftAndRight() {
 
   swapLeftAndRightInYogaStyleProps();
   swapLeftAndRightInViewProps();
+  invalidateSubtreeRevision();
 }
 
 void YogaLayoutableShadowNode::swapLeftAndRightInYogaStyleProps() {
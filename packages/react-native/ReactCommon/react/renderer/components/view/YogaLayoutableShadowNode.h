@@ -136,6 +136,22 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
    */
   void configureYogaTree(float pointScaleFactor, YGErrata defaultErrata, bool swapLeftAndRight);
 
+  /*
+   * Collects dirty descendants whose layout cannot affect the rest of the tree
+   * (see `isLayoutBoundary`) together with the direction they are laid out in.
+   * Descendants of collected nodes are not visited.
+   */
+  void collectLayoutBoundaries(
+      yoga::Direction ownerDirection,
+      std::vector<std::pair<YogaLayoutableShadowNode *, yoga::Direction>> &boundaries);
+
+  /*
+   * Lays out independent subtrees concurrently ahead of the layout pass of
+   * this (root) node. The pass then reuses their cached Yoga results, so the
+   * produced layout is identical to a serial pass.
+   */
+  void layoutBoundariesInParallel(const LayoutContext &layoutContext, yoga::Direction direction);
+
   /**
    * Return an errata based on a `layoutConformance` prop if given, otherwise
    * the passed default
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * A horizontal pager: every page has a fixed size (and therefore is a layout
+ * boundary) and contains flexible rows with fractional paddings.
+ */
+std::shared_ptr<RootShadowNode> buildPager(
+    const ComponentBuilder& builder,
+    bool enableParallelLayout) {
+  Tag tag = 1;
+  auto pages = std::vector<ElementFragment>{};
+  for (int page = 0; page < 8; page++) {
+    auto rows = std::vector<ElementFragment>{};
+    for (int row = 0; row < 16; row++) {
+      rows.push_back(
+          Element<ViewShadowNode>().tag(++tag).props([=] {
+            auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+            auto& yogaStyle = sharedProps->yogaStyle;
+            yogaStyle.setFlexGrow(yoga::FloatOptional{1.0f + row % 3});
+            yogaStyle.setPadding(
+                yoga::Edge::All, yoga::StyleLength::points(0.7f * row));
+            return sharedProps;
+          }));
+    }
+
+    pages.push_back(Element<ViewShadowNode>()
+                        .tag(++tag)
+                        .props([] {
+                          auto sharedProps =
+                              std::make_shared<ViewShadowNodeProps>();
+                          auto& yogaStyle = sharedProps->yogaStyle;
+                          yogaStyle.setDimension(
+                              yoga::Dimension::Width,
+                              yoga::StyleSizeLength::points(123.45f));
+                          yogaStyle.setDimension(
+                              yoga::Dimension::Height,
+                              yoga::StyleSizeLength::points(321.3f));
+                          yogaStyle.setMargin(
+                              yoga::Edge::All, yoga::StyleLength::points(1.1f));
+                          return sharedProps;
+                        })
+                        .children(rows));
+  }
+
+  auto rootShadowNode = std::shared_ptr<RootShadowNode>{};
+  builder.build(Element<RootShadowNode>()
+                    .reference(rootShadowNode)
+                    .tag(1)
+                    .props([=] {
+                      auto sharedProps = std::make_shared<RootProps>();
+                      auto& props = *sharedProps;
+                      props.layoutConstraints = LayoutConstraints{
+                          .minimumSize = {.width = 0, .height = 0},
+                          .maximumSize = {.width = 400, .height = 800}};
+                      props.layoutContext.pointScaleFactor = 3;
+                      props.layoutContext.enableParallelLayout =
+                          enableParallelLayout;
+                      props.yogaStyle.setFlexDirection(
+                          yoga::FlexDirection::Row);
+                      return sharedProps;
+                    })
+                    .children(pages));
+  return rootShadowNode;
+}
+
+void expectSameLayout(const ShadowNode& lhs, const ShadowNode& rhs) {
+  EXPECT_EQ(
+      dynamic_cast<const LayoutableShadowNode&>(lhs).getLayoutMetrics(),
+      dynamic_cast<const LayoutableShadowNode&>(rhs).getLayoutMetrics());
+  ASSERT_EQ(lhs.getChildren().size(), rhs.getChildren().size());
+  for (size_t i = 0; i < lhs.getChildren().size(); i++) {
+    expectSameLayout(*lhs.getChildren()[i], *rhs.getChildren()[i]);
+  }
+}
+
+} // namespace
+
+TEST(ParallelLayoutTest, producesSameLayoutAsSerialLayout) {
+  auto builder = simpleComponentBuilder();
+
+  auto serialRootShadowNode = buildPager(builder, false);
+  auto parallelRootShadowNode = buildPager(builder, true);
+
+  serialRootShadowNode->layoutIfNeeded();
+  parallelRootShadowNode->layoutIfNeeded();
+
+  expectSameLayout(*serialRootShadowNode, *parallelRootShadowNode);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Builds a horizontal pager with `pageCount` fixed-size pages, each of them
+ * containing a column of `rowCount` flexible rows with `cellCount` cells.
+ */
+std::shared_ptr<RootShadowNode> buildPager(
+    const ComponentBuilder& builder,
+    int pageCount,
+    int rowCount,
+    int cellCount,
+    bool enableParallelLayout) {
+  Tag tag = 1;
+  auto pages = std::vector<ElementFragment>{};
+  pages.reserve(pageCount);
+  for (int page = 0; page < pageCount; page++) {
+    auto rows = std::vector<ElementFragment>{};
+    rows.reserve(rowCount);
+    for (int row = 0; row < rowCount; row++) {
+      auto cells = std::vector<ElementFragment>{};
+      cells.reserve(cellCount);
+      for (int cell = 0; cell < cellCount; cell++) {
+        cells.push_back(Element<ViewShadowNode>().tag(++tag).props([] {
+          auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+          auto& yogaStyle = sharedProps->yogaStyle;
+          yogaStyle.setFlexGrow(yoga::FloatOptional{1});
+          yogaStyle.setMargin(yoga::Edge::All, yoga::StyleLength::points(2));
+          yogaStyle.setDimension(
+              yoga::Dimension::Height, yoga::StyleSizeLength::percent(50));
+          return sharedProps;
+        }));
+      }
+
+      rows.push_back(Element<ViewShadowNode>()
+                         .tag(++tag)
+                         .props([] {
+                           auto sharedProps =
+                               std::make_shared<ViewShadowNodeProps>();
+                           auto& yogaStyle = sharedProps->yogaStyle;
+                           yogaStyle.setFlexDirection(yoga::FlexDirection::Row);
+                           yogaStyle.setFlexGrow(yoga::FloatOptional{1});
+                           yogaStyle.setPadding(
+                               yoga::Edge::All, yoga::StyleLength::points(4));
+                           return sharedProps;
+                         })
+                         .children(cells));
+    }
+
+    pages.push_back(Element<ViewShadowNode>()
+                        .tag(++tag)
+                        .props([] {
+                          auto sharedProps =
+                              std::make_shared<ViewShadowNodeProps>();
+                          auto& yogaStyle = sharedProps->yogaStyle;
+                          yogaStyle.setDimension(
+                              yoga::Dimension::Width,
+                              yoga::StyleSizeLength::points(390));
+                          yogaStyle.setDimension(
+                              yoga::Dimension::Height,
+                              yoga::StyleSizeLength::points(844));
+                          return sharedProps;
+                        })
+                        .children(rows));
+  }
+
+  auto rootShadowNode = std::shared_ptr<RootShadowNode>{};
+  builder.build(Element<RootShadowNode>()
+                    .reference(rootShadowNode)
+                    .tag(1)
+                    .props([=] {
+                      auto sharedProps = std::make_shared<RootProps>();
+                      auto& props = *sharedProps;
+                      props.layoutConstraints = LayoutConstraints{
+                          .minimumSize = {.width = 0, .height = 0},
+                          .maximumSize = {.width = 390, .height = 844}};
+                      props.layoutContext.pointScaleFactor = 3;
+                      props.layoutContext.enableParallelLayout =
+                          enableParallelLayout;
+                      props.yogaStyle.setFlexDirection(
+                          yoga::FlexDirection::Row);
+                      return sharedProps;
+                    })
+                    .children(pages));
+  return rootShadowNode;
+}
+
+void layoutPager(benchmark::State& state, bool enableParallelLayout) {
+  auto builder = simpleComponentBuilder();
+  auto pageCount = static_cast<int>(state.range(0));
+  auto rowCount = static_cast<int>(state.range(1));
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto rootShadowNode =
+        buildPager(builder, pageCount, rowCount, 8, enableParallelLayout);
+    state.ResumeTiming();
+
+    rootShadowNode->layoutIfNeeded();
+  }
+
+  state.SetItemsProcessed(state.iterations() * pageCount * rowCount * 9);
+}
+
+void serialLayout(benchmark::State& state) {
+  layoutPager(state, false);
+}
+BENCHMARK(serialLayout)
+    ->Args({4, 64})
+    ->Args({16, 64})
+    ->Args({16, 256})
+    ->Unit(benchmark::kMillisecond);
+
+void parallelLayout(benchmark::State& state) {
+  layoutPager(state, true);
+}
+BENCHMARK(parallelLayout)
+    ->Args({4, 64})
+    ->Args({16, 64})
+    ->Args({16, 256})
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -16,7 +16,17 @@ ComponentDescriptor::ComponentDescriptor(
     : eventDispatcher_(parameters.eventDispatcher),
       contextContainer_(parameters.contextContainer),
       flavor_(parameters.flavor),
-      rawPropsParser_(std::move(rawPropsParser)) {}
+      rawPropsParser_(std::move(rawPropsParser)) {
+#ifndef RN_SERIALIZABLE_STATE
+  if (contextContainer_) {
+    propsInterningCache_ =
+        contextContainer_
+            ->find<std::shared_ptr<PropsInterningCache>>(
+                kPropsInterningCacheKey)
+            .value_or(nullptr);
+  }
+#endif
+}
 
 const std::shared_ptr<const ContextContainer>&
 ComponentDescriptor::getContextContainer() const {
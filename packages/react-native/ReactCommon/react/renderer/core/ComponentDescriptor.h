@@ -10,6 +10,7 @@
 #include <react/renderer/core/EventDispatcher.h>
 #include <react/renderer/core/InstanceHandle.h>
 #include <react/renderer/core/Props.h>
+#include <react/renderer/core/PropsInterningCache.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/RawPropsParser.h>
 #include <react/renderer/core/ShadowNode.h>
@@ -130,6 +131,12 @@ class ComponentDescriptor {
   Flavor flavor_;
   RawPropsParser rawPropsParser_;
 
+  /*
+   * Shared by all component descriptors, `nullptr` unless the
+   * `ContextContainer` provides one (see `kPropsInterningCacheKey`).
+   */
+  std::shared_ptr<PropsInterningCache> propsInterningCache_;
+
   /*
    * Called immediately after `ShadowNode` is created, cloned or state is
    * progressed using clonesless state progression (not fully shipped yet).
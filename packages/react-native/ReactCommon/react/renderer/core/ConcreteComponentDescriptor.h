@@ -20,6 +20,7 @@
 #include <react/renderer/core/ShadowNodeFragment.h>
 #include <react/renderer/core/State.h>
 #include <react/renderer/graphics/Float.h>
+#include <react/utils/PoolAllocator.h>
 
 namespace facebook::react {
 
@@ -70,7 +71,7 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
       const ShadowNodeFragment &fragment,
       const ShadowNodeFamily::Shared &family) const override
   {
-    auto shadowNode = std::make_shared<ShadowNodeT>(fragment, family, getTraits());
+    auto shadowNode = makeShadowNode(fragment, family, getTraits());
 
     adopt(*shadowNode);
 
@@ -80,7 +81,7 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
   std::shared_ptr<ShadowNode> cloneShadowNode(const ShadowNode &sourceShadowNode, const ShadowNodeFragment &fragment)
       const override
   {
-    auto shadowNode = std::make_shared<ShadowNodeT>(sourceShadowNode, fragment);
+    auto shadowNode = makeShadowNode(sourceShadowNode, fragment);
     shadowNode->completeClone(sourceShadowNode, fragment);
     sourceShadowNode.transferRuntimeShadowNodeReference(shadowNode, fragment);
 
@@ -112,6 +113,16 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
       ShadowNodeT::filterRawProps(rawProps);
     }
 
+    auto internedPropsKey = std::optional<PropsInterningCache::Key>{};
+    if (propsInterningCache_) {
+      internedPropsKey = propsInterningCache_->makeKey(getComponentHandle(), context.surfaceId, props, rawProps);
+      if (internedPropsKey) {
+        if (auto internedProps = propsInterningCache_->find(*internedPropsKey)) {
+          return internedProps;
+        }
+      }
+    }
+
     rawProps.parse(rawPropsParser_);
 
     auto shadowNodeProps = ShadowNodeT::Props(context, rawProps, props);
@@ -149,6 +160,10 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
         shadowNodeProps->setProp(context, RAW_PROPS_KEY_HASH(name), name.c_str(), RawValue(pair.second));
       }
     }
+
+    if (internedPropsKey) {
+      propsInterningCache_->insert(std::move(*internedPropsKey), shadowNodeProps);
+    }
     return shadowNodeProps;
   };
 
@@ -192,6 +207,20 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
     // Default implementation does nothing.
     react_native_assert(shadowNode.getComponentHandle() == getComponentHandle());
   }
+
+ private:
+  /*
+   * Allocates a node of the concrete type, from the size-class pool of the
+   * type if `ShadowNode::getUsePooledAllocation()` is enabled.
+   */
+  template <typename... ArgsT>
+  static std::shared_ptr<ShadowNodeT> makeShadowNode(ArgsT &&...args)
+  {
+    if (ShadowNode::getUsePooledAllocation()) {
+      return std::allocate_shared<ShadowNodeT>(PoolAllocator<ShadowNodeT>{}, std::forward<ArgsT>(args)...);
+    }
+    return std::make_shared<ShadowNodeT>(std::forward<ArgsT>(args)...);
+  }
 };
 
 template <typename TManager>
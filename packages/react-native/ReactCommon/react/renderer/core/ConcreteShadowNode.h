@@ -153,6 +153,7 @@ class ConcreteShadowNode : public BaseShadowNodeT {
   {
     Sealable::ensureUnsealed();
     state_ = std::make_shared<const ConcreteState>(std::make_shared<const ConcreteStateData>(std::move(data)), *state_);
+    ShadowNode::invalidateSubtreeRevision();
   }
 };
 
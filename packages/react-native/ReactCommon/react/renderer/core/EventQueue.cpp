@@ -11,8 +11,76 @@
 #include "EventEmitter.h"
 #include "ShadowNodeFamily.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 namespace facebook::react {
 
+namespace {
+
+/*
+ * Replaces (in place) the last event for the same target with a unique event
+ * of the same type. It is necessary to maintain order of different event types
+ * for the same target: if the same target has event types A1, B1 in the queue
+ * and event A2 occurs, A1 has to stay in the queue.
+ */
+std::vector<RawEvent> coalesceEvents(std::vector<RawEvent> events) {
+  auto hasUniqueEvents = std::any_of(
+      events.begin(), events.end(), [](const RawEvent& rawEvent) {
+        return rawEvent.isUnique;
+      });
+  if (!hasUniqueEvents) {
+    return events;
+  }
+
+  auto result = std::vector<RawEvent>{};
+  result.reserve(events.size());
+
+  // Index of the last event in `result` for every target.
+  auto lastEventIndices = std::unordered_map<const EventTarget*, size_t>{};
+  lastEventIndices.reserve(events.size());
+
+  for (auto& rawEvent : events) {
+    auto eventTarget = rawEvent.eventTarget.get();
+    if (rawEvent.isUnique) {
+      auto it = lastEventIndices.find(eventTarget);
+      if (it != lastEventIndices.end()) {
+        auto& repeatedEvent = result[it->second];
+        if (repeatedEvent.isUnique && repeatedEvent.type == rawEvent.type) {
+          repeatedEvent = std::move(rawEvent);
+          continue;
+        }
+      }
+    }
+
+    lastEventIndices[eventTarget] = result.size();
+    result.push_back(std::move(rawEvent));
+  }
+
+  return result;
+}
+
+/*
+ * Drops state updates which are immediately followed by an update of the same
+ * family.
+ */
+std::vector<StateUpdate> coalesceStateUpdates(
+    std::vector<StateUpdate> stateUpdates) {
+  auto result = std::vector<StateUpdate>{};
+  result.reserve(stateUpdates.size());
+
+  for (auto& stateUpdate : stateUpdates) {
+    if (!result.empty() && result.back().family == stateUpdate.family) {
+      result.pop_back();
+    }
+    result.push_back(std::move(stateUpdate));
+  }
+
+  return result;
+}
+
+} // namespace
+
 EventQueue::EventQueue(
     EventQueueProcessor eventProcessor,
     std::unique_ptr<EventBeat> eventBeat)
@@ -23,35 +91,7 @@ EventQueue::EventQueue(
 }
 
 void EventQueue::enqueueEvent(RawEvent&& rawEvent) const {
-  {
-    std::scoped_lock lock(queueMutex_);
-
-    if (rawEvent.isUnique) {
-      auto repeatedEvent = eventQueue_.rend();
-
-      for (auto it = eventQueue_.rbegin(); it != eventQueue_.rend(); ++it) {
-        if (it->eventTarget == rawEvent.eventTarget) {
-          // It is necessary to maintain order of different event types
-          // for the same target. If the same target has event types A1, B1
-          // in the event queue and event A2 occurs. A1 has to stay in the
-          // queue.
-          if (it->isUnique && it->type == rawEvent.type) {
-            repeatedEvent = it;
-          }
-
-          break;
-        }
-      }
-
-      if (repeatedEvent == eventQueue_.rend()) {
-        eventQueue_.push_back(std::move(rawEvent));
-      } else {
-        *repeatedEvent = std::move(rawEvent);
-      }
-    } else {
-      eventQueue_.push_back(std::move(rawEvent));
-    }
-  }
+  eventQueue_.push(std::move(rawEvent));
 
   onEnqueue();
 }
@@ -64,16 +104,7 @@ void EventQueue::enqueueUniqueEvent(RawEvent&& rawEvent) const {
 void EventQueue::enqueueStateUpdate(
     StateUpdate&& stateUpdate,
     UpdateMode updateMode) const {
-  {
-    std::scoped_lock lock(queueMutex_);
-    if (!stateUpdateQueue_.empty()) {
-      const auto position = stateUpdateQueue_.back();
-      if (stateUpdate.family == position.family) {
-        stateUpdateQueue_.pop_back();
-      }
-    }
-    stateUpdateQueue_.push_back(std::move(stateUpdate));
-  }
+  stateUpdateQueue_.push(std::move(stateUpdate));
 
   if (updateMode == UpdateMode::unstable_Immediate) {
     flushStateUpdates();
@@ -96,34 +127,18 @@ void EventQueue::onBeat(jsi::Runtime& runtime) const {
 }
 
 void EventQueue::flushEvents(jsi::Runtime& runtime) const {
-  std::vector<RawEvent> queue;
-
-  {
-    std::scoped_lock lock(queueMutex_);
-
-    if (eventQueue_.empty()) {
-      return;
-    }
-
-    queue = std::move(eventQueue_);
-    eventQueue_.clear();
+  auto queue = coalesceEvents(eventQueue_.drain());
+  if (queue.empty()) {
+    return;
   }
 
   eventProcessor_.flushEvents(runtime, std::move(queue));
 }
 
 void EventQueue::flushStateUpdates() const {
-  std::vector<StateUpdate> stateUpdateQueue;
-
-  {
-    std::scoped_lock lock(queueMutex_);
-
-    if (stateUpdateQueue_.empty()) {
-      return;
-    }
-
-    stateUpdateQueue = std::move(stateUpdateQueue_);
-    stateUpdateQueue_.clear();
+  auto stateUpdateQueue = coalesceStateUpdates(stateUpdateQueue_.drain());
+  if (stateUpdateQueue.empty()) {
+    return;
   }
 
   eventProcessor_.flushStateUpdates(std::move(stateUpdateQueue));
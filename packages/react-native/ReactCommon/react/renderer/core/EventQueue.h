@@ -8,7 +8,6 @@
 #pragma once
 
 #include <memory>
-#include <mutex>
 #include <vector>
 
 #include <jsi/jsi.h>
@@ -16,6 +15,7 @@
 #include <react/renderer/core/EventQueueProcessor.h>
 #include <react/renderer/core/RawEvent.h>
 #include <react/renderer/core/StateUpdate.h>
+#include <react/utils/MPSCQueue.h>
 
 namespace facebook::react {
 
@@ -47,7 +47,8 @@ class EventQueue {
 
   /*
    * Enqueues and (probably later) dispatches a given event.
-   * Deletes last RawEvent from the queue if it has the same type and target.
+   * The event replaces (in place) the last RawEvent for the same target if
+   * that event is unique and has the same type.
    * Can be called on any thread.
    */
   void enqueueUniqueEvent(RawEvent &&rawEvent) const;
@@ -78,10 +79,10 @@ class EventQueue {
   EventQueueProcessor eventProcessor_;
 
   const std::unique_ptr<EventBeat> eventBeat_;
-  // Thread-safe, protected by `queueMutex_`.
-  mutable std::vector<RawEvent> eventQueue_;
-  mutable std::vector<StateUpdate> stateUpdateQueue_;
-  mutable std::mutex queueMutex_;
+  // Thread-safe, mostly lock-free (see MPSCQueue). Unique events and consecutive state updates of the
+  // same family are coalesced when the queues are flushed.
+  MPSCQueue<RawEvent> eventQueue_;
+  MPSCQueue<StateUpdate> stateUpdateQueue_;
 };
 
 } // namespace facebook::react
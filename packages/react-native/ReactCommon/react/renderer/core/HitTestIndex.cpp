@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "HitTestIndex.h"
+
+#include <react/renderer/core/LayoutableShadowNode.h>
+#include <react/renderer/graphics/RectangleEdges.h>
+#include <react/renderer/graphics/Transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kMaxGridSide = 64;
+
+bool containsPoint(Rect rect, Point point) {
+  return rect.containsPoint(point);
+}
+
+/*
+ * Bounds of the area where `rect.containsPoint` may be true, as
+ * `{minX, minY, maxX, maxY}`.
+ */
+std::array<Float, 4> getHitBounds(const Rect& rect) {
+  auto maxX = rect.origin.x + rect.size.width;
+  auto maxY = rect.origin.y + rect.size.height;
+  return {
+      std::min(rect.origin.x, maxX),
+      std::min(rect.origin.y, maxY),
+      std::max(rect.origin.x, maxX),
+      std::max(rect.origin.y, maxY)};
+}
+
+size_t getCellIndex(Float offset, Float cellSize, size_t count) {
+  auto index = std::floor(offset / cellSize);
+  return static_cast<size_t>(
+      std::clamp(index, Float{0}, static_cast<Float>(count - 1)));
+}
+
+} // namespace
+
+HitTestIndex::HitTestIndex(std::shared_ptr<const ShadowNode> rootShadowNode)
+    : rootShadowNode_(std::move(rootShadowNode)) {}
+
+const std::shared_ptr<const ShadowNode>& HitTestIndex::getRootShadowNode()
+    const {
+  return rootShadowNode_;
+}
+
+std::shared_ptr<const ShadowNode> HitTestIndex::findNodeAtPoint(
+    const std::shared_ptr<const ShadowNode>& shadowNode,
+    Point point) const {
+  auto target = makeTarget(shadowNode);
+  if (!target) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  return findNodeAtPoint(*target, point);
+}
+
+std::optional<HitTestIndex::Target> HitTestIndex::makeTarget(
+    const std::shared_ptr<const ShadowNode>& shadowNode) {
+  auto layoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode*>(shadowNode.get());
+  if (layoutableShadowNode == nullptr) {
+    return std::nullopt;
+  }
+
+  auto canBeTouchTarget = layoutableShadowNode->canBeTouchTarget();
+  auto canChildrenBeTouchTarget =
+      layoutableShadowNode->canChildrenBeTouchTarget();
+  if (!canBeTouchTarget && !canChildrenBeTouchTarget) {
+    return std::nullopt;
+  }
+
+  auto layoutMetrics = layoutableShadowNode->getLayoutMetrics();
+  auto transform = layoutableShadowNode->getTransform();
+  return Target{
+      .shadowNode = shadowNode,
+      .frame = layoutMetrics.frame * transform,
+      .overflowFrame =
+          insetBy(layoutMetrics.frame, layoutMetrics.overflowInset) *
+          transform,
+      .contentOriginOffset =
+          layoutableShadowNode->getContentOriginOffset(false),
+      .canBeTouchTarget = canBeTouchTarget,
+      .canChildrenBeTouchTarget = canChildrenBeTouchTarget,
+      .isHorizontalInversion = Transform::isHorizontalInversion(transform),
+      .isVerticalInversion = Transform::isVerticalInversion(transform)};
+}
+
+HitTestIndex::Children HitTestIndex::makeChildren(
+    const ShadowNode& shadowNode) {
+  auto sortedChildren = shadowNode.getChildren();
+  std::stable_sort(
+      sortedChildren.begin(),
+      sortedChildren.end(),
+      [](const auto& lhs, const auto& rhs) -> bool {
+        return lhs->getOrderIndex() < rhs->getOrderIndex();
+      });
+
+  auto children = Children{};
+  children.targets.reserve(sortedChildren.size());
+  for (auto it = sortedChildren.rbegin(); it != sortedChildren.rend(); it++) {
+    if (auto target = makeTarget(*it)) {
+      children.targets.push_back(std::move(*target));
+    }
+  }
+
+  auto count = children.targets.size();
+  if (count < kMinChildrenForGrid) {
+    return children;
+  }
+
+  // A target can only be hit inside of its frame or its overflow frame.
+  auto targetBounds = std::vector<std::array<Float, 4>>{};
+  targetBounds.reserve(count);
+  auto bounds = std::array<Float, 4>{
+      std::numeric_limits<Float>::infinity(),
+      std::numeric_limits<Float>::infinity(),
+      -std::numeric_limits<Float>::infinity(),
+      -std::numeric_limits<Float>::infinity()};
+  for (const auto& target : children.targets) {
+    auto frameBounds = getHitBounds(target.frame);
+    auto overflowFrameBounds = getHitBounds(target.overflowFrame);
+    auto& hitBounds = targetBounds.emplace_back(std::array<Float, 4>{
+        std::min(frameBounds[0], overflowFrameBounds[0]),
+        std::min(frameBounds[1], overflowFrameBounds[1]),
+        std::max(frameBounds[2], overflowFrameBounds[2]),
+        std::max(frameBounds[3], overflowFrameBounds[3])});
+    if (!std::all_of(hitBounds.begin(), hitBounds.end(), [](Float value) {
+          return std::isfinite(value);
+        })) {
+      return children;
+    }
+    bounds[0] = std::min(bounds[0], hitBounds[0]);
+    bounds[1] = std::min(bounds[1], hitBounds[1]);
+    bounds[2] = std::max(bounds[2], hitBounds[2]);
+    bounds[3] = std::max(bounds[3], hitBounds[3]);
+  }
+
+  auto side = std::min(
+      static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(count)))),
+      kMaxGridSide);
+  auto width = bounds[2] - bounds[0];
+  auto height = bounds[3] - bounds[1];
+  children.bounds = bounds;
+  children.columns = width > 0 ? side : 1;
+  children.rows = height > 0 ? side : 1;
+  children.cellWidth = width > 0 ? width / static_cast<Float>(side) : 1;
+  children.cellHeight = height > 0 ? height / static_cast<Float>(side) : 1;
+  children.cells.resize(children.columns * children.rows);
+
+  for (uint32_t index = 0; index < count; index++) {
+    const auto& hitBounds = targetBounds[index];
+    auto minColumn = getCellIndex(
+        hitBounds[0] - bounds[0], children.cellWidth, children.columns);
+    auto maxColumn = getCellIndex(
+        hitBounds[2] - bounds[0], children.cellWidth, children.columns);
+    auto minRow = getCellIndex(
+        hitBounds[1] - bounds[1], children.cellHeight, children.rows);
+    auto maxRow = getCellIndex(
+        hitBounds[3] - bounds[1], children.cellHeight, children.rows);
+    for (auto row = minRow; row <= maxRow; row++) {
+      for (auto column = minColumn; column <= maxColumn; column++) {
+        children.cells[row * children.columns + column].push_back(index);
+      }
+    }
+  }
+
+  return children;
+}
+
+const HitTestIndex::Children& HitTestIndex::getChildren(
+    const ShadowNode& shadowNode) const {
+  auto it = children_.find(&shadowNode);
+  if (it == children_.end()) {
+    it = children_.emplace(&shadowNode, makeChildren(shadowNode)).first;
+  }
+  return it->second;
+}
+
+std::shared_ptr<const ShadowNode> HitTestIndex::findNodeAtPoint(
+    const Target& target,
+    Point point) const {
+  // Mirrors `LayoutableShadowNode::findNodeAtPoint`.
+  auto isPointInside = containsPoint(target.frame, point);
+
+  if (isPointInside && !target.canChildrenBeTouchTarget) {
+    return target.shadowNode;
+  } else if (!isPointInside) {
+    // If child overflows parent, the touch may be intercepted by the child
+    // only, so we should continue recursing.
+    if (!containsPoint(target.overflowFrame, point)) {
+      return nullptr;
+    }
+  }
+
+  if (target.isVerticalInversion || target.isHorizontalInversion) {
+    auto centerX = target.frame.origin.x + target.frame.size.width / 2.0;
+    auto centerY = target.frame.origin.y + target.frame.size.height / 2.0;
+
+    auto relativeX = point.x - centerX;
+    auto relativeY = point.y - centerY;
+
+    if (target.isVerticalInversion) {
+      relativeY = -relativeY;
+    }
+    if (target.isHorizontalInversion) {
+      relativeX = -relativeX;
+    }
+
+    point.x = float(centerX + relativeX);
+    point.y = float(centerY + relativeY);
+  }
+
+  if (!target.shadowNode->getChildren().empty()) {
+    auto newPoint =
+        point - target.frame.origin - target.contentOriginOffset;
+    const auto& children = getChildren(*target.shadowNode);
+
+    if (children.cells.empty()) {
+      for (const auto& childTarget : children.targets) {
+        if (auto hitNode = findNodeAtPoint(childTarget, newPoint)) {
+          return hitNode;
+        }
+      }
+    } else if (
+        newPoint.x >= children.bounds[0] && newPoint.y >= children.bounds[1] &&
+        newPoint.x <= children.bounds[2] && newPoint.y <= children.bounds[3]) {
+      // No target can be hit outside of the bounds of the grid.
+      auto column = getCellIndex(
+          newPoint.x - children.bounds[0],
+          children.cellWidth,
+          children.columns);
+      auto row = getCellIndex(
+          newPoint.y - children.bounds[1], children.cellHeight, children.rows);
+      for (auto index : children.cells[row * children.columns + column]) {
+        if (auto hitNode = findNodeAtPoint(children.targets[index], newPoint)) {
+          return hitNode;
+        }
+      }
+    }
+  }
+
+  return target.canBeTouchTarget ? target.shadowNode : nullptr;
+}
+
+} // namespace facebook::react
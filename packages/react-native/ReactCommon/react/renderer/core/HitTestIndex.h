@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/graphics/Point.h>
+#include <react/renderer/graphics/Rect.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Answers `LayoutableShadowNode::findNodeAtPoint` queries on a sealed tree,
+ * with the same results, reusing work between queries.
+ *
+ * The hit-testing data of the children of a node (their transformed frames,
+ * whether they can be touch targets and their order) is computed the first
+ * time a query reaches that node. Nodes with many children also get a uniform
+ * grid over the frames of their children, so a query only tests the children
+ * under the point instead of all of them.
+ *
+ * An index is meant to be built for a revision of a shadow tree and dropped
+ * when the revision changes. The class is thread-safe.
+ */
+class HitTestIndex final {
+ public:
+  /*
+   * Nodes with fewer children are tested one by one.
+   */
+  static constexpr size_t kMinChildrenForGrid = 16;
+
+  explicit HitTestIndex(std::shared_ptr<const ShadowNode> rootShadowNode);
+
+  const std::shared_ptr<const ShadowNode> &getRootShadowNode() const;
+
+  /*
+   * Same as `LayoutableShadowNode::findNodeAtPoint(shadowNode, point)`.
+   * `shadowNode` must be the root node of the index or one of its descendants.
+   */
+  std::shared_ptr<const ShadowNode> findNodeAtPoint(const std::shared_ptr<const ShadowNode> &shadowNode, Point point)
+      const;
+
+ private:
+  /*
+   * A node that can be hit, or have children that can be hit.
+   */
+  struct Target {
+    std::shared_ptr<const ShadowNode> shadowNode;
+    Rect frame;
+    Rect overflowFrame;
+    Point contentOriginOffset;
+    bool canBeTouchTarget;
+    bool canChildrenBeTouchTarget;
+    bool isHorizontalInversion;
+    bool isVerticalInversion;
+  };
+
+  struct Children {
+    // In the order they are tested: the last one in z-order first.
+    std::vector<Target> targets;
+
+    // Grid over the frames of all targets (if any), each cell listing the
+    // indices of the targets overlapping it in ascending order. `bounds` are
+    // `{minX, minY, maxX, maxY}`.
+    std::array<Float, 4> bounds{};
+    size_t columns{0};
+    size_t rows{0};
+    Float cellWidth{0};
+    Float cellHeight{0};
+    std::vector<std::vector<uint32_t>> cells;
+  };
+
+  static std::optional<Target> makeTarget(const std::shared_ptr<const ShadowNode> &shadowNode);
+  static Children makeChildren(const ShadowNode &shadowNode);
+
+  const Children &getChildren(const ShadowNode &shadowNode) const;
+  std::shared_ptr<const ShadowNode> findNodeAtPoint(const Target &target, Point point) const;
+
+  std::shared_ptr<const ShadowNode> rootShadowNode_;
+
+  mutable std::mutex mutex_;
+  mutable std::unordered_map<const ShadowNode *, Children> children_;
+};
+
+} // namespace facebook::react
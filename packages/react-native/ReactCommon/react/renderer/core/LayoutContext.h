@@ -50,6 +50,14 @@ struct LayoutContext {
    */
   bool swapLeftAndRightInRTL{false};
 
+  /*
+   * Opts into laying out independent subtrees (nodes with fixed point sizes
+   * which cannot be affected by their ancestors or siblings) concurrently on
+   * a pool of background threads. Layout results are identical either way.
+   * Measure functions of such subtrees are called from the pool threads.
+   */
+  bool enableParallelLayout{false};
+
   /*
    * Multiplier used to change size of the font in surface.
    */
@@ -209,6 +209,7 @@ void LayoutableShadowNode::setLayoutMetrics(LayoutMetrics layoutMetrics) {
   }
 
   layoutMetrics_ = layoutMetrics;
+  invalidateSubtreeRevision();
 }
 
 Transform LayoutableShadowNode::getTransform() const {
@@ -136,6 +136,8 @@ class LayoutableShadowNode : public ShadowNode {
   /*
    * Returns the ShadowNode that is rendered at the Point received as a
    * parameter.
+   * `HitTestIndex` gives the same results faster when querying the same tree
+   * many times, and must be kept in sync with this method.
    */
   static std::shared_ptr<const ShadowNode> findNodeAtPoint(const std::shared_ptr<const ShadowNode> &node, Point point);
 
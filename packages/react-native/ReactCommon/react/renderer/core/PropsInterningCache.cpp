@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PropsInterningCache.h"
+
+#include <react/utils/hash_combine.h>
+#include <cstdint>
+#include <cstring>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int kMaxDepth = 16;
+
+template <typename T>
+void appendBytes(std::string& payload, T value) {
+  char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+  payload.append(bytes, sizeof(T));
+}
+
+void appendString(
+    jsi::Runtime& runtime,
+    const jsi::String& string,
+    std::string& payload) {
+  auto utf8 = string.utf8(runtime);
+  appendBytes(payload, static_cast<uint32_t>(utf8.size()));
+  payload.append(utf8);
+}
+
+bool appendObject(
+    jsi::Runtime& runtime,
+    const jsi::Object& object,
+    std::string& payload,
+    int depth);
+
+/*
+ * Appends a tagged, length-prefixed encoding of `value`. Returns `false` if
+ * the value can't be compared by content (functions, host objects, array
+ * buffers, symbols, bigints) or the payload gets too large.
+ */
+bool appendValue(
+    jsi::Runtime& runtime,
+    const jsi::Value& value,
+    std::string& payload,
+    int depth) {
+  if (depth > kMaxDepth ||
+      payload.size() > PropsInterningCache::kMaxPayloadSize) {
+    return false;
+  }
+
+  if (value.isUndefined()) {
+    payload.push_back('u');
+  } else if (value.isNull()) {
+    payload.push_back('n');
+  } else if (value.isBool()) {
+    payload.push_back(value.getBool() ? 't' : 'f');
+  } else if (value.isNumber()) {
+    payload.push_back('d');
+    appendBytes(payload, value.getNumber());
+  } else if (value.isString()) {
+    payload.push_back('s');
+    appendString(runtime, value.getString(runtime), payload);
+  } else if (value.isObject()) {
+    auto object = value.getObject(runtime);
+    if (object.isFunction(runtime) || object.isHostObject(runtime) ||
+        object.isArrayBuffer(runtime)) {
+      return false;
+    }
+
+    if (object.isArray(runtime)) {
+      auto array = object.getArray(runtime);
+      auto size = array.size(runtime);
+      payload.push_back('a');
+      appendBytes(payload, static_cast<uint32_t>(size));
+      for (size_t i = 0; i < size; i++) {
+        auto element = array.getValueAtIndex(runtime, i);
+        if (!appendValue(runtime, element, payload, depth + 1)) {
+          return false;
+        }
+      }
+    } else if (!appendObject(runtime, object, payload, depth)) {
+      return false;
+    }
+  } else {
+    return false;
+  }
+
+  return true;
+}
+
+bool appendObject(
+    jsi::Runtime& runtime,
+    const jsi::Object& object,
+    std::string& payload,
+    int depth) {
+  auto names = object.getPropertyNames(runtime);
+  auto count = names.size(runtime);
+  if (count > PropsInterningCache::kMaxPropertyCount) {
+    return false;
+  }
+
+  payload.push_back('o');
+  appendBytes(payload, static_cast<uint32_t>(count));
+  for (size_t i = 0; i < count; i++) {
+    auto name = names.getValueAtIndex(runtime, i).getString(runtime);
+    appendString(runtime, name, payload);
+    if (!appendValue(
+            runtime, object.getProperty(runtime, name), payload, depth + 1)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+PropsInterningCache::PropsInterningCache(size_t capacity)
+    : capacity_(capacity) {}
+
+std::optional<PropsInterningCache::Key> PropsInterningCache::makeKey(
+    ComponentHandle componentHandle,
+    SurfaceId surfaceId,
+    const Props::Shared& sourceProps,
+    const RawProps& rawProps) {
+  auto key = std::optional<Key>{};
+  if (rawProps.mode_ == RawProps::Mode::JSI && rawProps.value_.isObject() &&
+      !shouldSkip(surfaceId)) {
+    key = Key{
+        .componentHandle = componentHandle,
+        .surfaceId = surfaceId,
+        .sourceProps = sourceProps.get(),
+        .weakSourceProps = sourceProps};
+    auto& runtime = *rawProps.runtime_;
+    if (appendObject(
+            runtime,
+            rawProps.value_.getObject(runtime),
+            key->payload,
+            /*depth*/ 0) &&
+        key->payload.size() <= kMaxPayloadSize) {
+      key->hash = hash_combine(
+          componentHandle,
+          surfaceId,
+          key->sourceProps,
+          std::hash<std::string_view>{}(key->payload));
+    } else {
+      key.reset();
+    }
+  }
+
+  if (!key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.skipped++;
+  }
+  return key;
+}
+
+Props::Shared PropsInterningCache::find(const Key& key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto it = index_.find(viewOf(key));
+  if (it == index_.end()) {
+    stats_.misses++;
+    updateHitRate(false);
+    return nullptr;
+  }
+
+  auto entry = it->second;
+  if (isStale(entry->key)) [[unlikely]] {
+    index_.erase(it);
+    entries_.erase(entry);
+    stats_.misses++;
+    stats_.size = entries_.size();
+    updateHitRate(false);
+    return nullptr;
+  }
+
+  entries_.splice(entries_.begin(), entries_, entry);
+  stats_.hits++;
+  updateHitRate(true);
+  return entry->props;
+}
+
+void PropsInterningCache::insert(Key&& key, Props::Shared props) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // The surface may have been disabled since the key was made.
+  if (capacity_ == 0 || disabledSurfaces_.contains(key.surfaceId)) {
+    return;
+  }
+
+  if (auto it = index_.find(viewOf(key)); it != index_.end()) {
+    auto entry = it->second;
+    if (!isStale(entry->key)) {
+      // Another thread parsed the same props in the meantime.
+      entries_.splice(entries_.begin(), entries_, entry);
+      return;
+    }
+    index_.erase(it);
+    entries_.erase(entry);
+  }
+
+  while (entries_.size() >= capacity_) {
+    index_.erase(viewOf(entries_.back().key));
+    entries_.pop_back();
+    stats_.evictions++;
+  }
+
+  entries_.push_front(Entry{.key = std::move(key), .props = std::move(props)});
+  index_.emplace(viewOf(entries_.front().key), entries_.begin());
+  stats_.size = entries_.size();
+}
+
+void PropsInterningCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.evictions += entries_.size();
+  index_.clear();
+  entries_.clear();
+  stats_.size = 0;
+}
+
+void PropsInterningCache::setSurfaceEnabled(
+    SurfaceId surfaceId,
+    bool enabled) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (enabled) {
+    disabledSurfaces_.erase(surfaceId);
+  } else if (disabledSurfaces_.insert(surfaceId).second) {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (it->key.surfaceId == surfaceId) {
+        index_.erase(viewOf(it->key));
+        it = entries_.erase(it);
+        stats_.evictions++;
+      } else {
+        ++it;
+      }
+    }
+    stats_.size = entries_.size();
+  }
+  hasDisabledSurfaces_.store(
+      !disabledSurfaces_.empty(), std::memory_order_relaxed);
+}
+
+PropsInterningCache::Stats PropsInterningCache::getStats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+bool PropsInterningCache::isStale(const Key& key) noexcept {
+  // The source props were deallocated, so a new object may have been
+  // allocated at the same address.
+  return key.sourceProps != nullptr && key.weakSourceProps.expired();
+}
+
+bool PropsInterningCache::shouldSkip(SurfaceId surfaceId) {
+  // Racing calls may overshoot the backoff by a few calls, which is harmless.
+  if (backoffCallsLeft_.load(std::memory_order_relaxed) > 0 &&
+      backoffCallsLeft_.fetch_sub(1, std::memory_order_relaxed) > 0) {
+    return true;
+  }
+
+  if (hasDisabledSurfaces_.load(std::memory_order_relaxed)) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return disabledSurfaces_.contains(surfaceId);
+  }
+  return false;
+}
+
+void PropsInterningCache::updateHitRate(bool hit) {
+  // Called with `mutex_` held.
+  sampleHits_ += hit ? 1 : 0;
+  if (++sampleLookups_ == kHitRateSampleSize) {
+    if (sampleHits_ < kMinHitsPerSample) {
+      backoffCallsLeft_.store(kBackoffCalls, std::memory_order_relaxed);
+    }
+    sampleLookups_ = 0;
+    sampleHits_ = 0;
+  }
+}
+
+PropsInterningCache::KeyView PropsInterningCache::viewOf(
+    const Key& key) noexcept {
+  return KeyView{
+      .componentHandle = key.componentHandle,
+      .surfaceId = key.surfaceId,
+      .sourceProps = key.sourceProps,
+      .payload = key.payload,
+      .hash = key.hash};
+}
+
+} // namespace facebook::react
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/Props.h>
+#include <react/renderer/core/RawProps.h>
+#include <react/renderer/core/ReactPrimitives.h>
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace facebook::react {
+
+/*
+ * `ContextContainer` key of the `std::shared_ptr<PropsInterningCache>` used
+ * by component descriptors. Interning is disabled if there is none.
+ */
+constexpr auto kPropsInterningCacheKey = "PropsInterningCache";
+
+/*
+ * Shares the `Props` objects produced by `ComponentDescriptor::cloneProps`
+ * among calls with identical inputs: the same component, the same source
+ * props object, and JSI raw props with the same content. Lists often render
+ * many rows with byte-identical props, which are then parsed once and stored
+ * once.
+ *
+ * Only raw props made of plain objects, arrays and primitive values (up to a
+ * size limit) are interned; anything else is parsed as usual. Building a key
+ * reads the raw props a second time, so objects with too many properties are
+ * rejected before any property is read, and key building is suspended for a
+ * while whenever too few recent lookups hit. Entries keep
+ * their props alive and are evicted in least-recently-used order once the
+ * capacity is reached, or all at once with `clear()` (e.g. on memory
+ * pressure).
+ *
+ * Interned props are shared between shadow nodes, so interning must only be
+ * enabled when props aren't mutated after being created: it is not supported
+ * with `RN_SERIALIZABLE_STATE` (where it is compiled out), and `SurfaceHandler`
+ * disables it for surfaces laid out with
+ * `LayoutContext::swapLeftAndRightInRTL`.
+ *
+ * The class is thread-safe.
+ */
+class PropsInterningCache final {
+ public:
+  struct Stats {
+    size_t hits{0};
+    size_t misses{0};
+    // `cloneProps` calls whose raw props can't be interned or which skip
+    // interning (a disabled surface or too few recent hits).
+    size_t skipped{0};
+    size_t evictions{0};
+    size_t size{0};
+  };
+
+  /*
+   * The key of a `cloneProps` call, including the serialized raw props.
+   */
+  struct Key {
+    ComponentHandle componentHandle{};
+    SurfaceId surfaceId{};
+    const Props *sourceProps{};
+    std::weak_ptr<const Props> weakSourceProps{};
+    std::string payload{};
+    size_t hash{};
+  };
+
+  static constexpr size_t kDefaultCapacity = 1024;
+  static constexpr size_t kMaxPayloadSize = 4096;
+  // Objects with more properties (at any depth) are not interned.
+  static constexpr size_t kMaxPropertyCount = 64;
+  // If fewer than `kMinHitsPerSample` of `kHitRateSampleSize` consecutive
+  // lookups hit, the next `kBackoffCalls` calls skip interning.
+  static constexpr size_t kHitRateSampleSize = 256;
+  static constexpr size_t kMinHitsPerSample = 16;
+  static constexpr int kBackoffCalls = 1024;
+
+  explicit PropsInterningCache(size_t capacity = kDefaultCapacity);
+
+  /*
+   * Returns the key for given `cloneProps` arguments, or `std::nullopt` if the
+   * raw props can't be interned.
+   */
+  std::optional<Key> makeKey(
+      ComponentHandle componentHandle,
+      SurfaceId surfaceId,
+      const Props::Shared &sourceProps,
+      const RawProps &rawProps);
+
+  /*
+   * Returns the props stored for `key`, or `nullptr`.
+   */
+  Props::Shared find(const Key &key);
+
+  void insert(Key &&key, Props::Shared props);
+
+  /*
+   * Drops all the stored props.
+   */
+  void clear();
+
+  /*
+   * Enables or disables interning for the props of `surfaceId`. Disabling it
+   * drops the props stored for the surface. Interning is enabled by default.
+   */
+  void setSurfaceEnabled(SurfaceId surfaceId, bool enabled);
+
+  Stats getStats() const;
+
+ private:
+  struct KeyView {
+    ComponentHandle componentHandle;
+    SurfaceId surfaceId;
+    const Props *sourceProps;
+    std::string_view payload;
+    size_t hash;
+
+    bool operator==(const KeyView &rhs) const = default;
+  };
+
+  struct KeyViewHash {
+    size_t operator()(const KeyView &key) const noexcept
+    {
+      return key.hash;
+    }
+  };
+
+  struct Entry {
+    Key key;
+    Props::Shared props;
+  };
+
+  static KeyView viewOf(const Key &key) noexcept;
+  static bool isStale(const Key &key) noexcept;
+
+  bool shouldSkip(SurfaceId surfaceId);
+  void updateHitRate(bool hit);
+
+  size_t capacity_;
+
+  mutable std::mutex mutex_;
+  // Most recently used entries first.
+  std::list<Entry> entries_;
+  std::unordered_map<KeyView, std::list<Entry>::iterator, KeyViewHash> index_;
+  Stats stats_;
+  std::unordered_set<SurfaceId> disabledSurfaces_;
+  size_t sampleLookups_{0};
+  size_t sampleHits_{0};
+
+  // Read without the lock by `makeKey`.
+  std::atomic<bool> hasDisabledSurfaces_{false};
+  std::atomic<int> backoffCallsLeft_{0};
+};
+
+} // namespace facebook::react
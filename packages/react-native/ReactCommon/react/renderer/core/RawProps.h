@@ -20,6 +20,7 @@
 
 namespace facebook::react {
 
+class PropsInterningCache;
 class RawPropsParser;
 
 /*
@@ -94,6 +95,7 @@ class RawProps final {
 
  private:
   friend class RawPropsParser;
+  friend class PropsInterningCache;
 
   mutable const RawPropsParser *parser_{nullptr};
 
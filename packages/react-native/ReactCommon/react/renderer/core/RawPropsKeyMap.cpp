@@ -11,12 +11,79 @@
 
 #include <glog/logging.h>
 #include <algorithm>
+#include <bit>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
 
 namespace facebook::react {
 
+namespace {
+
+// Average number of names sharing a displacement, and the maximum number of
+// displacements (and hash seeds) tried before giving up.
+constexpr size_t kNamesPerDisplacement = 4;
+constexpr uint32_t kMaxDisplacement = 1 << 12;
+constexpr uint64_t kMaxSeedAttempts = 8;
+
+constexpr uint64_t kGoldenRatio = 0x9e3779b97f4a7c15ull;
+constexpr uint64_t kSlotMultiplier = 0xd6e8feb86659fd93ull;
+
+inline uint64_t load64(const char* data) noexcept {
+  uint64_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+inline uint64_t load32(const char* data) noexcept {
+  uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+/*
+ * Hashes the name eight bytes at a time with a single multiplication per
+ * word. The last word overlaps the previous one instead of being padded, so
+ * all loads have a fixed size (the length is part of the hash, which keeps
+ * that unambiguous). The result is only consumed through its high bits,
+ * which depend on all the input bits.
+ */
+inline uint64_t hashName(
+    const char* name,
+    RawPropsPropNameLength length,
+    uint64_t seed) noexcept {
+  auto hash = seed ^ (length * kGoldenRatio);
+  if (length >= sizeof(uint64_t)) {
+    const auto* last = name + length - sizeof(uint64_t);
+    for (; name < last; name += sizeof(uint64_t)) {
+      hash = (hash ^ load64(name)) * kGoldenRatio;
+    }
+    return (hash ^ load64(last)) * kGoldenRatio;
+  }
+
+  uint64_t word = 0;
+  if (length >= sizeof(uint32_t)) {
+    word = (load32(name) << 32) | load32(name + length - sizeof(uint32_t));
+  } else if (length > 0) {
+    word = (uint64_t{static_cast<unsigned char>(name[0])} << 16) |
+        (uint64_t{static_cast<unsigned char>(name[length / 2])} << 8) |
+        static_cast<unsigned char>(name[length - 1]);
+  }
+  return (hash ^ word) * kGoldenRatio;
+}
+
+inline size_t displacementIndex(uint64_t hash, uint8_t shift) noexcept {
+  return static_cast<size_t>(hash >> shift);
+}
+
+inline size_t
+slotIndex(uint64_t hash, uint16_t displacement, uint8_t shift) noexcept {
+  return static_cast<size_t>(
+      ((hash ^ displacement) * kSlotMultiplier) >> shift);
+}
+
+} // namespace
+
 bool RawPropsKeyMap::hasSameName(const Item& lhs, const Item& rhs) noexcept {
   return lhs.length == rhs.length &&
       (std::memcmp(lhs.name, rhs.name, lhs.length) == 0);
@@ -89,6 +156,109 @@ void RawPropsKeyMap::reindex() noexcept {
   for (size_t j = length; j < buckets_.size(); j++) {
     buckets_[j] = static_cast<RawPropsPropNameLength>(items_.size());
   }
+
+  buildPerfectHash();
+}
+
+void RawPropsKeyMap::buildPerfectHash() noexcept {
+  displacements_.clear();
+  slots_.clear();
+  if (items_.empty()) {
+    return;
+  }
+
+  // Both sizes are powers of two (at least two), indexed by the high bits
+  // of the hashes.
+  const auto displacementCount =
+      std::bit_ceil(items_.size() / kNamesPerDisplacement + 2);
+  const auto slotCount = std::bit_ceil(items_.size() * 2);
+  const auto displacementShift =
+      static_cast<uint8_t>(64 - std::countr_zero(displacementCount));
+  const auto slotShift = static_cast<uint8_t>(64 - std::countr_zero(slotCount));
+
+  auto hashes = std::vector<uint64_t>(items_.size());
+  auto groups = std::vector<std::vector<RawPropsValueIndex>>{};
+  auto groupOrder = std::vector<size_t>(displacementCount);
+  auto displacements = std::vector<uint16_t>{};
+  auto slots = std::vector<RawPropsValueIndex>{};
+
+  for (uint64_t attempt = 0; attempt < kMaxSeedAttempts; attempt++) {
+    const auto seed = attempt * kGoldenRatio;
+
+    groups.assign(displacementCount, {});
+    for (size_t i = 0; i < items_.size(); i++) {
+      const auto& item = items_[i];
+      hashes[i] = hashName(item.name, item.length, seed);
+      groups[displacementIndex(hashes[i], displacementShift)].push_back(
+          static_cast<RawPropsValueIndex>(i));
+    }
+
+    // Placing the largest groups first, while most slots are still free.
+    for (size_t i = 0; i < displacementCount; i++) {
+      groupOrder[i] = i;
+    }
+    std::stable_sort(
+        groupOrder.begin(), groupOrder.end(), [&](size_t lhs, size_t rhs) {
+          return groups[lhs].size() > groups[rhs].size();
+        });
+
+    displacements.assign(displacementCount, 0);
+    slots.assign(slotCount, kRawPropsValueIndexEmpty);
+
+    auto succeeded = true;
+    for (auto groupIndex : groupOrder) {
+      const auto& group = groups[groupIndex];
+      if (group.empty()) {
+        break;
+      }
+
+      auto placed = false;
+      for (uint32_t displacement = 0;
+           !placed && displacement < kMaxDisplacement;
+           displacement++) {
+        size_t placedCount = 0;
+        for (; placedCount < group.size(); placedCount++) {
+          auto& slot = slots[slotIndex(
+              hashes[group[placedCount]],
+              static_cast<uint16_t>(displacement),
+              slotShift)];
+          if (slot != kRawPropsValueIndexEmpty) {
+            break;
+          }
+          slot = group[placedCount];
+        }
+
+        placed = placedCount == group.size();
+        if (placed) {
+          displacements[groupIndex] = static_cast<uint16_t>(displacement);
+        } else {
+          for (size_t i = 0; i < placedCount; i++) {
+            slots[slotIndex(
+                hashes[group[i]],
+                static_cast<uint16_t>(displacement),
+                slotShift)] = kRawPropsValueIndexEmpty;
+          }
+        }
+      }
+
+      if (!placed) {
+        succeeded = false;
+        break;
+      }
+    }
+
+    if (succeeded) {
+      seed_ = seed;
+      displacementShift_ = displacementShift;
+      slotShift_ = slotShift;
+      displacements_ = std::move(displacements);
+      slots_ = std::move(slots);
+      return;
+    }
+  }
+
+  LOG(WARNING) << "Could not build a perfect hash for a component property "
+               << "map of " << items_.size() << " entries.";
 }
 
 RawPropsValueIndex RawPropsKeyMap::at(
@@ -99,6 +269,29 @@ RawPropsValueIndex RawPropsKeyMap::at(
   if (length == 0 || length >= kPropNameLengthHardCap) [[unlikely]] {
     return kRawPropsValueIndexEmpty;
   }
+
+  if (slots_.empty()) [[unlikely]] {
+    return atSortedItems(name, length);
+  }
+
+  const auto hash = hashName(name, length, seed_);
+  const auto displacement =
+      displacements_[displacementIndex(hash, displacementShift_)];
+  const auto index = slots_[slotIndex(hash, displacement, slotShift_)];
+  if (index == kRawPropsValueIndexEmpty) {
+    return kRawPropsValueIndexEmpty;
+  }
+
+  const auto& item = items_[index];
+  if (item.length != length || std::memcmp(item.name, name, length) != 0) {
+    return kRawPropsValueIndexEmpty;
+  }
+  return item.value;
+}
+
+RawPropsValueIndex RawPropsKeyMap::atSortedItems(
+    const char* name,
+    RawPropsPropNameLength length) const noexcept {
   // 1. Find the bucket.
   auto lower = int{buckets_[length - 1]};
   auto upper = int{buckets_[length]} - 1;
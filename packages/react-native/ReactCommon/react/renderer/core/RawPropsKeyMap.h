@@ -9,14 +9,17 @@
 
 #include <react/renderer/core/RawPropsKey.h>
 #include <react/renderer/core/RawPropsPrimitives.h>
+#include <cstdint>
 #include <vector>
 
 namespace facebook::react {
 
 /*
  * A map especially optimized to hold `{name: index}` relations.
- * The implementation is conceptually similar to a classic hash map with a hash
- * function that returns the length of the string.
+ * The key set is fixed when the map is reindexed, so the map builds a perfect
+ * hash function for it: a lookup hashes the name, reads a single slot and
+ * compares a single stored name. If the perfect hash can't be built, lookups
+ * fall back to a binary search among the names of the same length.
  * The map is optimized for reads only (the map must be reindexed before a bunch
  * of reads).
  */
@@ -49,8 +52,25 @@ class RawPropsKeyMap final {
   static bool shouldFirstOneBeBeforeSecondOne(const Item &lhs, const Item &rhs) noexcept;
   static bool hasSameName(const Item &lhs, const Item &rhs) noexcept;
 
+  /*
+   * Builds the "hash and displace" perfect hash function over `items_`:
+   * names are split into groups by their hash, and every group gets the
+   * displacement that puts all of its names into distinct free slots.
+   * Leaves `slots_` empty if no such function was found.
+   */
+  void buildPerfectHash() noexcept;
+
+  RawPropsValueIndex atSortedItems(const char *name, RawPropsPropNameLength length) const noexcept;
+
   std::vector<Item> items_{};
   std::vector<RawPropsPropNameLength> buckets_{};
+
+  uint64_t seed_{0};
+  uint8_t displacementShift_{0};
+  uint8_t slotShift_{0};
+  std::vector<uint16_t> displacements_{};
+  // Indices into `items_`, `kRawPropsValueIndexEmpty` for empty slots.
+  std::vector<RawPropsValueIndex> slots_{};
 };
 
 } // namespace facebook::react
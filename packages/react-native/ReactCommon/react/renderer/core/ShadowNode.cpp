@@ -14,6 +14,7 @@
 #include <react/renderer/core/ShadowNodeFragment.h>
 #include <react/renderer/debug/DebugStringConvertible.h>
 #include <react/renderer/debug/debugStringConvertibleUtils.h>
+#include <react/utils/PoolAllocator.h>
 
 #include <utility>
 
@@ -36,6 +37,36 @@ thread_local bool useRuntimeShadowNodeReferenceUpdateOnThread{false}; // NOLINT
   return useRuntimeShadowNodeReferenceUpdateOnThread;
 }
 
+std::atomic<bool> usePooledAllocation{false}; // NOLINT
+
+namespace {
+
+ShadowNode::SubtreeRevision nextSubtreeRevision() {
+  static std::atomic<ShadowNode::SubtreeRevision> lastSubtreeRevision{0};
+  return lastSubtreeRevision.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+} // namespace
+
+/* static */ void ShadowNode::setUsePooledAllocation(bool isEnabled) {
+  usePooledAllocation.store(isEnabled, std::memory_order_relaxed);
+}
+
+/* static */ bool ShadowNode::getUsePooledAllocation() {
+  return usePooledAllocation.load(std::memory_order_relaxed);
+}
+
+/* static */ std::shared_ptr<std::vector<std::shared_ptr<const ShadowNode>>>
+ShadowNode::makeSharedChildren(
+    std::vector<std::shared_ptr<const ShadowNode>> children) {
+  using ListOfShared = std::vector<std::shared_ptr<const ShadowNode>>;
+  if (getUsePooledAllocation()) {
+    return std::allocate_shared<ListOfShared>(
+        PoolAllocator<ListOfShared>{}, std::move(children));
+  }
+  return std::make_shared<ListOfShared>(std::move(children));
+}
+
 std::shared_ptr<const std::vector<std::shared_ptr<const ShadowNode>>>
 ShadowNode::emptySharedShadowNodeSharedList() {
   static const auto emptySharedShadowNodeSharedList =
@@ -95,6 +126,7 @@ ShadowNode::ShadowNode(
   react_native_assert(children_);
 
   traits_.set(ShadowNodeTraits::Trait::ChildrenAreShared);
+  subtreeRevision_ = nextSubtreeRevision();
 
   for (const auto& child : *children_) {
     child->family_->setParent(family_);
@@ -125,6 +157,14 @@ ShadowNode::ShadowNode(
   react_native_assert(children_);
   traits_.set(ShadowNodeTraits::Trait::ChildrenAreShared);
 
+  // A clone which has the props, state and children of its source describes
+  // the same subtree (layout metrics are copied along with the node).
+  subtreeRevision_ = props_ == sourceShadowNode.props_ &&
+          state_ == sourceShadowNode.state_ &&
+          children_ == sourceShadowNode.children_
+      ? sourceShadowNode.subtreeRevision_
+      : nextSubtreeRevision();
+
   if (fragment.children) {
     for (const auto& child : *children_) {
       child->family_->setParent(family_);
@@ -133,6 +173,10 @@ ShadowNode::ShadowNode(
   }
 }
 
+ShadowNode::~ShadowNode() {
+  delete childIndex_.load(std::memory_order_acquire);
+}
+
 std::shared_ptr<ShadowNode> ShadowNode::clone(
     const ShadowNodeFragment& fragment) const {
   const auto& family = *family_;
@@ -220,6 +264,10 @@ int ShadowNode::getOrderIndex() const {
   return orderIndex_;
 }
 
+ShadowNode::SubtreeRevision ShadowNode::getSubtreeRevision() const {
+  return subtreeRevision_;
+}
+
 void ShadowNode::sealRecursive() const {
   if (getSealed()) {
     return;
@@ -240,6 +288,8 @@ void ShadowNode::appendChild(const std::shared_ptr<const ShadowNode>& child) {
   ensureUnsealed();
 
   cloneChildrenIfShared();
+  invalidateChildIndex();
+  invalidateSubtreeRevision();
   auto& children =
       const_cast<std::vector<std::shared_ptr<const ShadowNode>>&>(*children_);
   children.push_back(child);
@@ -255,6 +305,8 @@ void ShadowNode::replaceChild(
   ensureUnsealed();
 
   cloneChildrenIfShared();
+  invalidateChildIndex();
+  invalidateSubtreeRevision();
   newChild->family_->setParent(family_);
 
   auto& children =
@@ -288,8 +340,17 @@ void ShadowNode::cloneChildrenIfShared() {
   }
 
   traits_.unset(ShadowNodeTraits::Trait::ChildrenAreShared);
-  children_ = std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>(
-      *children_);
+  children_ = makeSharedChildren(*children_);
+}
+
+void ShadowNode::invalidateChildIndex() {
+  delete childIndex_.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+void ShadowNode::invalidateSubtreeRevision() {
+  ensureUnsealed();
+
+  subtreeRevision_ = nextSubtreeRevision();
 }
 
 void ShadowNode::propagateUncullableTraitsFromChildren() {
@@ -370,6 +431,54 @@ ShadowNodeFamily::Shared ShadowNode::getFamilyShared() const {
   return family_;
 }
 
+int ShadowNode::getChildIndex(const ShadowNodeFamily& childFamily) const {
+  const auto& children = *children_;
+
+  // For small lists a linear scan is cheaper than hashing. The index stays
+  // valid because every mutation of `children_` invalidates it (`getSealed()`
+  // can't be relied on, it always returns `true` in release builds).
+  if (children.size() < kChildIndexThreshold) {
+    auto childIndex = 0;
+    for (const auto& childNode : children) {
+      if (childNode->family_.get() == &childFamily) {
+        return childIndex;
+      }
+      childIndex++;
+    }
+    return -1;
+  }
+
+  auto childIndex = childIndex_.load(std::memory_order_acquire);
+  if (childIndex == nullptr) {
+    auto newChildIndex = new ChildIndexMap{};
+    newChildIndex->reserve(children.size());
+    auto index = 0;
+    for (const auto& childNode : children) {
+      newChildIndex->emplace(childNode->family_.get(), index++);
+    }
+
+    // Several threads can race to build the index; the first one wins and
+    // the others discard their (identical) copies.
+    const ChildIndexMap* expected = nullptr;
+    if (childIndex_.compare_exchange_strong(
+            expected, newChildIndex, std::memory_order_acq_rel)) {
+      childIndex = newChildIndex;
+    } else {
+      delete newChildIndex;
+      childIndex = expected;
+    }
+  }
+
+  auto iterator = childIndex->find(&childFamily);
+  if (iterator == childIndex->end()) {
+    return -1;
+  }
+
+  react_native_assert(
+      children.at(iterator->second)->family_.get() == &childFamily);
+  return iterator->second;
+}
+
 std::shared_ptr<ShadowNode> ShadowNode::cloneTree(
     const ShadowNodeFamily& shadowNodeFamily,
     const std::function<std::shared_ptr<ShadowNode>(
@@ -401,9 +510,7 @@ std::shared_ptr<ShadowNode> ShadowNode::cloneTree(
     children[childIndex] = childNode;
 
     childNode = parentNode.clone(
-        {.children =
-             std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>(
-                 children)});
+        {.children = ShadowNode::makeSharedChildren(std::move(children))});
   }
 
   return std::const_pointer_cast<ShadowNode>(childNode);
@@ -425,9 +532,7 @@ std::shared_ptr<ShadowNode> cloneMultipleRecursive(
     if (childrenCount.contains(childTag)) {
       count--;
       if (!newChildren) {
-        newChildren =
-            std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>(
-                children);
+        newChildren = ShadowNode::makeSharedChildren(children);
       }
       (*newChildren)[i] =
           cloneMultipleRecursive(*children[i], childrenCount, callback);
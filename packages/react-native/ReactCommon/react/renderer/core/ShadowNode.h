@@ -7,10 +7,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include <react/renderer/core/EventEmitter.h>
@@ -42,6 +44,8 @@ class ShadowNode : public Sealable, public DebugStringConvertible, public jsi::N
   using AncestorList =
       std::vector<std::pair<std::reference_wrapper<const ShadowNode> /* parentNode */, int /* childIndex */>>;
 
+  using SubtreeRevision = uint64_t;
+
   static std::shared_ptr<const std::vector<std::shared_ptr<const ShadowNode>>> emptySharedShadowNodeSharedList();
 
   /*
@@ -63,6 +67,24 @@ class ShadowNode : public Sealable, public DebugStringConvertible, public jsi::N
 
   static bool getUseRuntimeShadowNodeReferenceUpdateOnThread();
 
+  /*
+   * Enables allocating shadow nodes created by `ConcreteComponentDescriptor`
+   * (together with their control blocks) and lists of children from
+   * process-wide size-class pools (see `PoolAllocator`). Most nodes of a commit
+   * are released one commit later, so their memory is recycled instead of
+   * being returned to the heap. Disabled by default.
+   */
+  static void setUsePooledAllocation(bool isEnabled);
+
+  static bool getUsePooledAllocation();
+
+  /*
+   * Creates a shared list of children, allocated from the pools if pooled
+   * allocation is enabled. The storage of the list's elements is not pooled.
+   */
+  static std::shared_ptr<std::vector<std::shared_ptr<const ShadowNode>>> makeSharedChildren(
+      std::vector<std::shared_ptr<const ShadowNode>> children = {});
+
 #pragma mark - Constructors
 
   /*
@@ -83,7 +105,7 @@ class ShadowNode : public Sealable, public DebugStringConvertible, public jsi::N
   ShadowNode(const ShadowNode &shadowNode) noexcept = delete;
   ShadowNode &operator=(const ShadowNode &other) noexcept = delete;
 
-  ~ShadowNode() override = default;
+  ~ShadowNode() override;
 
   /*
    * Clones the shadow node using the ShadowNode's ComponentDescriptor.
@@ -168,12 +190,32 @@ class ShadowNode : public Sealable, public DebugStringConvertible, public jsi::N
    */
   int getOrderIndex() const;
 
+  /*
+   * Returns a stamp of the content of the subtree rooted at this node (props,
+   * state, layout metrics and children, recursively).
+   * A clone which does not change anything keeps the stamp of its source;
+   * creating or mutating a node assigns a new, process-wide unique stamp.
+   * Therefore, two nodes with equal stamps describe identical subtrees even if
+   * they are different instances (e.g. nodes cloned during layout), which
+   * allows the differ to skip them without comparing their descendants.
+   */
+  SubtreeRevision getSubtreeRevision() const;
+
   void sealRecursive() const;
 
   const ShadowNodeFamily &getFamily() const;
 
   ShadowNodeFamily::Shared getFamilyShared() const;
 
+  /*
+   * Returns the index of the child that belongs to the given family or `-1`
+   * if there is no such child.
+   * For nodes with many children the lookup is served by an index which is
+   * built lazily on first use and lives as long as the node itself.
+   * Can be called from any thread.
+   */
+  int getChildIndex(const ShadowNodeFamily &childFamily) const;
+
 #pragma mark - Mutating Methods
 
   virtual void appendChild(const std::shared_ptr<const ShadowNode> &child);
@@ -235,6 +277,19 @@ class ShadowNode : public Sealable, public DebugStringConvertible, public jsi::N
   State::Shared state_;
   int orderIndex_;
 
+  /*
+   * Assigns a new subtree revision to the node.
+   * Must be called every time props, state, layout metrics or children of an
+   * already constructed node are mutated in place.
+   */
+  void invalidateSubtreeRevision();
+
+  /*
+   * Drops the lazily built child index (if any).
+   * Must be called every time `children_` is mutated.
+   */
+  void invalidateChildIndex();
+
  private:
   friend ShadowNodeFamily;
 
@@ -270,6 +325,19 @@ class ShadowNode : public Sealable, public DebugStringConvertible, public jsi::N
    */
   mutable std::atomic<bool> hasBeenMounted_{false};
 
+  SubtreeRevision subtreeRevision_{0};
+
+  using ChildIndexMap = std::unordered_map<const ShadowNodeFamily *, int>;
+
+  /*
+   * Maps families of children to their indices in `children_`.
+   * Built lazily by `getChildIndex` for nodes with at least
+   * `kChildIndexThreshold` children, owned by this node.
+   */
+  mutable std::atomic<const ChildIndexMap *> childIndex_{nullptr};
+
+  static constexpr size_t kChildIndexThreshold = 16;
+
   static Props::Shared propsForClonedShadowNode(const ShadowNode &sourceShadowNode, const Props::Shared &props);
 
  protected:
@@ -115,25 +115,17 @@ AncestorList ShadowNodeFamily::getAncestors(
   }
 
   auto ancestors = AncestorList{};
+  ancestors.reserve(families.size());
   auto parentNode = &ancestorShadowNode;
   for (auto it = families.rbegin(); it != families.rend(); it++) {
-    auto childFamily = *it;
-    auto found = false;
-    auto childIndex = 0;
-    for (const auto& childNode : *parentNode->children_) {
-      if (childNode->family_.get() == childFamily) {
-        ancestors.emplace_back(*parentNode, childIndex);
-        parentNode = childNode.get();
-        found = true;
-        break;
-      }
-      childIndex++;
-    }
-
-    if (!found) {
+    auto childIndex = parentNode->getChildIndex(**it);
+    if (childIndex == -1) {
       ancestors.clear();
       return ancestors;
     }
+
+    ancestors.emplace_back(*parentNode, childIndex);
+    parentNode = parentNode->children_->at(childIndex).get();
   }
 
   return ancestors;
@@ -78,7 +78,8 @@ class ShadowNodeFamily final : public jsi::NativeState {
    * node and an index of the child of the parent node.
    * Returns an empty array if there is no ancestor-descendant relationship.
    * Can be called from any thread.
-   * The theoretical complexity of the algorithm is `O(ln(n))`. Use it wisely.
+   * The complexity of the algorithm is `O(depth)`: child indices of nodes with
+   * many children are resolved via `ShadowNode::getChildIndex`.
    */
   AncestorList getAncestors(const ShadowNode &ancestorShadowNode) const;
 
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventLogger.h>
+#include <react/renderer/core/EventQueue.h>
+#include <react/renderer/core/EventQueueProcessor.h>
+#include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/InstanceHandle.h>
+#include <react/renderer/core/ValueFactoryEventPayload.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "TestComponent.h"
+
+namespace facebook::react {
+
+namespace {
+
+class MockEventLogger : public EventLogger {
+  EventTag onEventStart(
+      std::string_view /*name*/,
+      SharedEventTarget /*target*/,
+      std::optional<HighResTimeStamp> /*eventStartTimeStamp*/) override {
+    return EMPTY_EVENT_TAG;
+  }
+  void onEventProcessingStart(EventTag /*tag*/) override {}
+  void onEventProcessingEnd(EventTag /*tag*/) override {}
+};
+
+/*
+ * Beat which is delivered only when the test asks for it.
+ */
+class ManualEventBeat : public EventBeat {
+ public:
+  ManualEventBeat(
+      std::shared_ptr<OwnerBox> ownerBox,
+      RuntimeScheduler& runtimeScheduler)
+      : EventBeat(std::move(ownerBox), runtimeScheduler) {}
+
+  void beat(jsi::Runtime& runtime) const {
+    beatCallback_(runtime);
+  }
+};
+
+} // namespace
+
+class EventQueueTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+    runtimeScheduler_ = std::make_unique<RuntimeScheduler>(
+        [](std::function<void(jsi::Runtime&)>&& /*callback*/) {});
+
+    auto eventPipe = [this](
+                         jsi::Runtime& /*runtime*/,
+                         const EventTarget* eventTarget,
+                         const std::string& type,
+                         ReactEventPriority /*priority*/,
+                         const EventPayload& /*payload*/,
+                         HighResTimeStamp /*eventTimestamp*/) {
+      dispatchedEvents_.emplace_back(eventTarget, type);
+    };
+    auto dummyEventPipeConclusion = [](jsi::Runtime& /*runtime*/) {};
+    auto statePipe = [this](const StateUpdate& stateUpdate) {
+      dispatchedStateUpdates_.push_back(stateUpdate.family);
+    };
+
+    auto eventBeat = std::make_unique<ManualEventBeat>(
+        std::make_shared<EventBeat::OwnerBox>(), *runtimeScheduler_);
+    eventBeat_ = eventBeat.get();
+    eventQueue_ = std::make_unique<EventQueue>(
+        EventQueueProcessor(
+            eventPipe,
+            dummyEventPipeConclusion,
+            statePipe,
+            std::make_shared<MockEventLogger>()),
+        std::move(eventBeat));
+  }
+
+  SharedEventTarget createEventTarget(Tag tag) {
+    auto instanceHandle = std::make_shared<InstanceHandle>(
+        *runtime_, jsi::Value(*runtime_, jsi::Object(*runtime_)), tag);
+    return std::make_shared<EventTarget>(std::move(instanceHandle), 1);
+  }
+
+  RawEvent createEvent(std::string type, SharedEventTarget eventTarget) {
+    return RawEvent(
+        std::move(type),
+        std::make_shared<ValueFactoryEventPayload>(dummyValueFactory_),
+        std::move(eventTarget),
+        {});
+  }
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  std::unique_ptr<RuntimeScheduler> runtimeScheduler_;
+  const ManualEventBeat* eventBeat_{nullptr};
+  std::unique_ptr<EventQueue> eventQueue_;
+  std::vector<std::pair<const EventTarget*, std::string>> dispatchedEvents_;
+  std::vector<SharedShadowNodeFamily> dispatchedStateUpdates_;
+  ValueFactory dummyValueFactory_;
+};
+
+TEST_F(EventQueueTest, dispatchesEventsInOrder) {
+  auto eventTarget = createEventTarget(1);
+
+  eventQueue_->enqueueEvent(createEvent("topTouchStart", eventTarget));
+  eventQueue_->enqueueEvent(createEvent("topTouchMove", eventTarget));
+  eventQueue_->enqueueEvent(createEvent("topTouchMove", eventTarget));
+  eventBeat_->beat(*runtime_);
+
+  ASSERT_EQ(dispatchedEvents_.size(), 3u);
+  EXPECT_EQ(dispatchedEvents_[0].second, "topTouchStart");
+  EXPECT_EQ(dispatchedEvents_[1].second, "topTouchMove");
+  EXPECT_EQ(dispatchedEvents_[2].second, "topTouchMove");
+
+  // The queue is empty after a beat.
+  eventBeat_->beat(*runtime_);
+  EXPECT_EQ(dispatchedEvents_.size(), 3u);
+}
+
+TEST_F(EventQueueTest, coalescesUniqueEvents) {
+  auto firstEventTarget = createEventTarget(1);
+  auto secondEventTarget = createEventTarget(2);
+
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", firstEventTarget));
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", secondEventTarget));
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", firstEventTarget));
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", firstEventTarget));
+  eventBeat_->beat(*runtime_);
+
+  ASSERT_EQ(dispatchedEvents_.size(), 2u);
+  EXPECT_EQ(dispatchedEvents_[0].first, firstEventTarget.get());
+  EXPECT_EQ(dispatchedEvents_[1].first, secondEventTarget.get());
+}
+
+TEST_F(EventQueueTest, keepsOrderOfDifferentEventTypesForSameTarget) {
+  auto eventTarget = createEventTarget(1);
+
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", eventTarget));
+  eventQueue_->enqueueEvent(createEvent("topLayout", eventTarget));
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", eventTarget));
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", eventTarget));
+  eventBeat_->beat(*runtime_);
+
+  ASSERT_EQ(dispatchedEvents_.size(), 3u);
+  EXPECT_EQ(dispatchedEvents_[0].second, "topScroll");
+  EXPECT_EQ(dispatchedEvents_[1].second, "topLayout");
+  EXPECT_EQ(dispatchedEvents_[2].second, "topScroll");
+}
+
+TEST_F(EventQueueTest, coalescesConsecutiveStateUpdatesOfSameFamily) {
+  auto componentDescriptor = TestComponentDescriptor(
+      {.eventDispatcher = std::shared_ptr<const EventDispatcher>()});
+  auto firstFamily = componentDescriptor.createFamily(
+      {.tag = 1, .surfaceId = 1, .instanceHandle = nullptr});
+  auto secondFamily = componentDescriptor.createFamily(
+      {.tag = 2, .surfaceId = 1, .instanceHandle = nullptr});
+
+  eventQueue_->enqueueStateUpdate(StateUpdate{.family = firstFamily});
+  eventQueue_->enqueueStateUpdate(StateUpdate{.family = firstFamily});
+  eventQueue_->enqueueStateUpdate(StateUpdate{.family = secondFamily});
+  eventQueue_->enqueueStateUpdate(StateUpdate{.family = firstFamily});
+  eventBeat_->beat(*runtime_);
+
+  ASSERT_EQ(dispatchedStateUpdates_.size(), 3u);
+  EXPECT_EQ(dispatchedStateUpdates_[0], firstFamily);
+  EXPECT_EQ(dispatchedStateUpdates_[1], secondFamily);
+  EXPECT_EQ(dispatchedStateUpdates_[2], firstFamily);
+}
+
+TEST_F(EventQueueTest, acceptsEventsFromManyThreads) {
+  constexpr int kThreadCount = 4;
+  constexpr int kEventsPerThread = 100;
+
+  auto eventTargets = std::vector<SharedEventTarget>{};
+  for (int i = 0; i < kThreadCount; i++) {
+    eventTargets.push_back(createEventTarget(i + 1));
+  }
+
+  auto threads = std::vector<std::thread>{};
+  for (int i = 0; i < kThreadCount; i++) {
+    threads.emplace_back([&, i] {
+      for (int j = 0; j < kEventsPerThread; j++) {
+        eventQueue_->enqueueEvent(createEvent("topChange", eventTargets[i]));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  eventBeat_->beat(*runtime_);
+
+  EXPECT_EQ(
+      dispatchedEvents_.size(),
+      static_cast<size_t>(kThreadCount * kEventsPerThread));
+}
+
+} // namespace facebook::react
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/core/HitTestIndex.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+
+#include "TestComponent.h"
+
+using namespace facebook;
+using namespace facebook::react;
+
+namespace {
+
+Element<ViewShadowNode> view(Tag tag, Rect frame) {
+  return Element<ViewShadowNode>().tag(tag).finalize(
+      [frame](ViewShadowNode& shadowNode) {
+        auto layoutMetrics = EmptyLayoutMetrics;
+        layoutMetrics.frame = frame;
+        shadowNode.setLayoutMetrics(layoutMetrics);
+      });
+}
+
+void expectSameNodesAtPoints(
+    const std::shared_ptr<const ShadowNode>& shadowNode,
+    Float size) {
+  auto hitTestIndex = HitTestIndex{shadowNode};
+  for (Float x = -10; x <= size + 10; x += 3.5) {
+    for (Float y = -10; y <= size + 10; y += 3.5) {
+      auto point = Point{.x = x, .y = y};
+      EXPECT_EQ(
+          hitTestIndex.findNodeAtPoint(shadowNode, point),
+          LayoutableShadowNode::findNodeAtPoint(shadowNode, point))
+          << "at (" << x << ", " << y << ")";
+    }
+  }
+}
+
+} // namespace
+
+TEST(HitTestIndexTest, findsSameNodesAsTreeTraversal) {
+  auto builder = simpleComponentBuilder();
+
+  // clang-format off
+  auto element =
+    view(1, {.size = {.width = 1000, .height = 1000}})
+      .children({
+        view(2, {.origin = {.x = 100, .y = 100}, .size = {.width = 100, .height = 100}})
+          .children({
+            view(3, {.origin = {.x = 10, .y = 10}, .size = {.width = 10, .height = 10}})
+          }),
+        view(4, {.origin = {.x = 150, .y = 150}, .size = {.width = 100, .height = 100}})
+          .props([] {
+            auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+            sharedProps->pointerEvents = PointerEventsMode::BoxNone;
+            return sharedProps;
+          }),
+      });
+  // clang-format on
+
+  auto rootShadowNode = builder.build(element);
+  auto hitTestIndex = HitTestIndex{rootShadowNode};
+
+  EXPECT_EQ(
+      hitTestIndex.findNodeAtPoint(rootShadowNode, {115, 115})->getTag(), 3);
+  EXPECT_EQ(
+      hitTestIndex.findNodeAtPoint(rootShadowNode, {105, 105})->getTag(), 2);
+  EXPECT_EQ(
+      hitTestIndex.findNodeAtPoint(rootShadowNode, {190, 190})->getTag(), 2);
+  EXPECT_EQ(
+      hitTestIndex.findNodeAtPoint(rootShadowNode, {900, 900})->getTag(), 1);
+  EXPECT_EQ(
+      hitTestIndex.findNodeAtPoint(rootShadowNode, {1001, 1001}), nullptr);
+
+  auto childShadowNode = rootShadowNode->getChildren().front();
+  EXPECT_EQ(
+      hitTestIndex.findNodeAtPoint(childShadowNode, {115, 115})->getTag(), 3);
+
+  expectSameNodesAtPoints(rootShadowNode, 1000);
+}
+
+TEST(HitTestIndexTest, findsSameNodesInDenseLayouts) {
+  auto builder = simpleComponentBuilder();
+
+  // Overlapping views, some of them transformed, reordered, not touchable or
+  // overflowing their parents, enough for the index to use a grid.
+  constexpr int kSide = 12;
+  constexpr Float kCellSize = 20;
+  Tag tag = 1;
+  auto children = std::vector<ElementFragment>{};
+  for (int row = 0; row < kSide; row++) {
+    for (int column = 0; column < kSide; column++) {
+      auto index = row * kSide + column;
+      auto frame = Rect{
+          .origin = {.x = column * kCellSize, .y = row * kCellSize},
+          .size = {.width = kCellSize * 1.5f, .height = kCellSize * 1.5f}};
+      auto child =
+          Element<ViewShadowNode>()
+              .tag(++tag)
+              .props([index] {
+                auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+                if (index % 5 == 0) {
+                  sharedProps->transform = Transform::Scale(2, 0.5, 1);
+                }
+                if (index % 7 == 0) {
+                  sharedProps->pointerEvents = PointerEventsMode::None;
+                }
+                if (index % 11 == 0) {
+                  sharedProps->zIndex = 1;
+                  sharedProps->yogaStyle.setPositionType(
+                      yoga::PositionType::Absolute);
+                }
+                return sharedProps;
+              })
+              .finalize([frame, index](ViewShadowNode& shadowNode) {
+                auto layoutMetrics = EmptyLayoutMetrics;
+                layoutMetrics.frame = frame;
+                if (index % 13 == 0) {
+                  layoutMetrics.overflowInset = {
+                      .left = -15, .top = -15, .right = -15, .bottom = -15};
+                }
+                shadowNode.setLayoutMetrics(layoutMetrics);
+              });
+      if (index % 13 == 0) {
+        auto overflowingFrame = Rect{
+            .origin = {.x = -15, .y = -15},
+            .size = {.width = 10, .height = 10}};
+        child.children({view(++tag, overflowingFrame)});
+      }
+      children.push_back(child);
+    }
+  }
+
+  auto rootShadowNode = builder.build(
+      view(1, {.size = {.width = 300, .height = 300}}).children(children));
+  ASSERT_GE(
+      rootShadowNode->getChildren().size(), HitTestIndex::kMinChildrenForGrid);
+
+  expectSameNodesAtPoints(rootShadowNode, 300);
+}
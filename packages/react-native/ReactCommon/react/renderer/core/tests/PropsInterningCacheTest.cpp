@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <react/renderer/core/PropsInterningCache.h>
+#include <react/renderer/core/PropsParserContext.h>
+
+#include "TestComponent.h"
+
+using namespace facebook;
+using namespace facebook::react;
+
+namespace {
+
+class PropsInterningCacheTest : public testing::Test {
+ protected:
+  PropsInterningCacheTest()
+      : runtime_(hermes::makeHermesRuntime()),
+        cache_(std::make_shared<PropsInterningCache>(/*capacity*/ 2)),
+        contextContainer_(std::make_shared<ContextContainer>()) {
+    contextContainer_->insert(kPropsInterningCacheKey, cache_);
+    descriptor_ =
+        std::make_shared<TestComponentDescriptor>(ComponentDescriptorParameters{
+            .eventDispatcher = std::shared_ptr<const EventDispatcher>(),
+            .contextContainer = contextContainer_,
+            .flavor = nullptr});
+  }
+
+  RawProps rawProps(const std::string& json) {
+    auto parse = runtime_->global()
+                     .getPropertyAsObject(*runtime_, "JSON")
+                     .getPropertyAsFunction(*runtime_, "parse");
+    auto value =
+        parse.call(*runtime_, jsi::String::createFromUtf8(*runtime_, json));
+    return RawProps(*runtime_, value);
+  }
+
+  Props::Shared cloneProps(const Props::Shared& props, RawProps rawProps) {
+    PropsParserContext parserContext{-1, *contextContainer_};
+    return descriptor_->cloneProps(parserContext, props, std::move(rawProps));
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+  std::shared_ptr<PropsInterningCache> cache_;
+  std::shared_ptr<ContextContainer> contextContainer_;
+  SharedComponentDescriptor descriptor_;
+};
+
+} // namespace
+
+TEST_F(PropsInterningCacheTest, sharesPropsForIdenticalPayloads) {
+  auto json = std::string{
+      R"({"nativeID": "row", "style": {"transform": [{"scale": 2}]}})"};
+  auto props = cloneProps(nullptr, rawProps(json));
+  auto sameProps = cloneProps(nullptr, rawProps(json));
+
+  EXPECT_EQ(props, sameProps);
+  EXPECT_EQ(props->nativeId, "row");
+  EXPECT_EQ(cache_->getStats().hits, 1u);
+  EXPECT_EQ(cache_->getStats().misses, 1u);
+  EXPECT_EQ(cache_->getStats().size, 1u);
+
+  auto otherProps = cloneProps(nullptr, rawProps(R"({"nativeID": "other"})"));
+  EXPECT_NE(props, otherProps);
+  EXPECT_EQ(otherProps->nativeId, "other");
+}
+
+TEST_F(PropsInterningCacheTest, keysOnSourceProps) {
+  auto json = std::string{R"({"testID": "cell"})"};
+  auto sourceProps = cloneProps(nullptr, rawProps(R"({"nativeID": "a"})"));
+
+  auto props = cloneProps(nullptr, rawProps(json));
+  auto clonedProps = cloneProps(sourceProps, rawProps(json));
+
+  EXPECT_NE(props, clonedProps);
+  EXPECT_EQ(clonedProps->nativeId, "a");
+  EXPECT_EQ(clonedProps, cloneProps(sourceProps, rawProps(json)));
+}
+
+TEST_F(PropsInterningCacheTest, skipsPayloadsWithFunctions) {
+  auto object = jsi::Object(*runtime_);
+  object.setProperty(*runtime_, "nativeID", "row");
+  object.setProperty(
+      *runtime_,
+      "onSomething",
+      jsi::Function::createFromHostFunction(
+          *runtime_,
+          jsi::PropNameID::forAscii(*runtime_, "onSomething"),
+          0,
+          [](jsi::Runtime&, const jsi::Value&, const jsi::Value*, size_t) {
+            return jsi::Value::undefined();
+          }));
+  auto value = jsi::Value(*runtime_, object);
+
+  auto props = cloneProps(nullptr, RawProps(*runtime_, value));
+  auto otherProps = cloneProps(nullptr, RawProps(*runtime_, value));
+
+  EXPECT_NE(props, otherProps);
+  EXPECT_EQ(cache_->getStats().skipped, 2u);
+  EXPECT_EQ(cache_->getStats().size, 0u);
+}
+
+TEST_F(PropsInterningCacheTest, evictsLeastRecentlyUsedEntries) {
+  auto first = cloneProps(nullptr, rawProps(R"({"nativeID": "1"})"));
+  auto second = cloneProps(nullptr, rawProps(R"({"nativeID": "2"})"));
+  EXPECT_EQ(first, cloneProps(nullptr, rawProps(R"({"nativeID": "1"})")));
+
+  // Evicts "2", the least recently used entry.
+  cloneProps(nullptr, rawProps(R"({"nativeID": "3"})"));
+  EXPECT_EQ(cache_->getStats().evictions, 1u);
+  EXPECT_EQ(cache_->getStats().size, 2u);
+
+  EXPECT_EQ(first, cloneProps(nullptr, rawProps(R"({"nativeID": "1"})")));
+  EXPECT_NE(second, cloneProps(nullptr, rawProps(R"({"nativeID": "2"})")));
+
+  cache_->clear();
+  EXPECT_EQ(cache_->getStats().size, 0u);
+  EXPECT_NE(first, cloneProps(nullptr, rawProps(R"({"nativeID": "1"})")));
+}
+
+TEST_F(PropsInterningCacheTest, skipsObjectsWithTooManyProperties) {
+  auto json = std::string{"{"};
+  for (size_t i = 0; i <= PropsInterningCache::kMaxPropertyCount; i++) {
+    json += (i == 0 ? "\"p" : ", \"p") + std::to_string(i) + "\": 0";
+  }
+  json += "}";
+
+  auto props = cloneProps(nullptr, rawProps(json));
+  EXPECT_NE(props, cloneProps(nullptr, rawProps(json)));
+  EXPECT_EQ(cache_->getStats().skipped, 2u);
+  EXPECT_EQ(cache_->getStats().size, 0u);
+}
+
+TEST_F(PropsInterningCacheTest, skipsDisabledSurfaces) {
+  auto json = std::string{R"({"nativeID": "row"})"};
+  auto props = cloneProps(nullptr, rawProps(json));
+  EXPECT_EQ(cache_->getStats().size, 1u);
+
+  // `cloneProps` parses for surface -1.
+  cache_->setSurfaceEnabled(-1, false);
+  EXPECT_EQ(cache_->getStats().size, 0u);
+  EXPECT_NE(props, cloneProps(nullptr, rawProps(json)));
+  EXPECT_EQ(cache_->getStats().skipped, 1u);
+  EXPECT_EQ(cache_->getStats().size, 0u);
+
+  cache_->setSurfaceEnabled(-1, true);
+  props = cloneProps(nullptr, rawProps(json));
+  EXPECT_EQ(props, cloneProps(nullptr, rawProps(json)));
+}
+
+TEST_F(PropsInterningCacheTest, backsOffWhenLookupsMiss) {
+  for (size_t i = 0; i < PropsInterningCache::kHitRateSampleSize; i++) {
+    cloneProps(
+        nullptr,
+        rawProps(R"({"nativeID": ")" + std::to_string(i) + R"("})"));
+  }
+  EXPECT_EQ(cache_->getStats().skipped, 0u);
+
+  auto json = std::string{R"({"nativeID": "row"})"};
+  EXPECT_NE(
+      cloneProps(nullptr, rawProps(json)),
+      cloneProps(nullptr, rawProps(json)));
+  EXPECT_EQ(cache_->getStats().skipped, 2u);
+
+  for (int i = 2; i < PropsInterningCache::kBackoffCalls; i++) {
+    cloneProps(nullptr, rawProps(json));
+  }
+  auto props = cloneProps(nullptr, rawProps(json));
+  EXPECT_EQ(props, cloneProps(nullptr, rawProps(json)));
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/core/RawPropsKeyMap.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+RawPropsValueIndex at(RawPropsKeyMap& map, const std::string& name) {
+  return map.at(name.data(), static_cast<RawPropsPropNameLength>(name.size()));
+}
+
+} // namespace
+
+TEST(RawPropsKeyMapTest, findsInsertedKeys) {
+  auto map = RawPropsKeyMap{};
+  map.insert({.name = "opacity"}, 0);
+  map.insert({.prefix = "margin", .name = "Top"}, 1);
+  map.insert({.prefix = "border", .name = "Top", .suffix = "Width"}, 2);
+  map.insert({.name = "flex"}, 3);
+  map.reindex();
+
+  EXPECT_EQ(at(map, "opacity"), 0);
+  EXPECT_EQ(at(map, "marginTop"), 1);
+  EXPECT_EQ(at(map, "borderTopWidth"), 2);
+  EXPECT_EQ(at(map, "flex"), 3);
+
+  EXPECT_EQ(at(map, "margin"), kRawPropsValueIndexEmpty);
+  EXPECT_EQ(at(map, "flexGrow"), kRawPropsValueIndexEmpty);
+  EXPECT_EQ(at(map, "opacitx"), kRawPropsValueIndexEmpty);
+}
+
+TEST(RawPropsKeyMapTest, keepsFirstValueOfDuplicatedKeys) {
+  auto map = RawPropsKeyMap{};
+  map.insert({.name = "width"}, 0);
+  map.insert({.name = "height"}, 1);
+  map.insert({.name = "width"}, 2);
+  map.reindex();
+
+  EXPECT_EQ(at(map, "width"), 0);
+  EXPECT_EQ(at(map, "height"), 1);
+}
+
+TEST(RawPropsKeyMapTest, findsKeysOfTheSameLength) {
+  // Hundreds of names of the same length, differing only in the middle.
+  auto names = std::vector<std::string>{};
+  for (int i = 0; i < 500; i++) {
+    names.push_back("prefix" + std::to_string(1000 + i) + "Suffix");
+  }
+
+  auto map = RawPropsKeyMap{};
+  for (size_t i = 0; i < names.size(); i++) {
+    map.insert(
+        {.name = names[i].c_str()}, static_cast<RawPropsValueIndex>(i));
+  }
+  map.reindex();
+
+  for (size_t i = 0; i < names.size(); i++) {
+    EXPECT_EQ(at(map, names[i]), i);
+  }
+  EXPECT_EQ(at(map, "prefix9999Suffix"), kRawPropsValueIndexEmpty);
+}
+
+TEST(RawPropsKeyMapTest, emptyMap) {
+  auto map = RawPropsKeyMap{};
+  map.reindex();
+
+  EXPECT_EQ(at(map, "opacity"), kRawPropsValueIndexEmpty);
+}
+
+} // namespace facebook::react
@@ -80,3 +80,109 @@ TEST(ShadowNodeFamilyTest, sealObjectCorrectly) {
   EXPECT_EQ(&ancestors2[0].first.get(), shadowNodeA.get());
   EXPECT_EQ(&ancestors2[1].first.get(), shadowNodeAA.get());
 }
+
+TEST(ShadowNodeFamilyTest, getAncestorsOfWideTree) {
+  /*
+   * The structure:
+   * <A>
+   *  <AA/> x 64
+   *  <AB>
+   *    <ABA/>
+   *  </AB>
+   * </A>
+   */
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              .eventDispatcher = eventDispatcher,
+              .contextContainer = nullptr,
+              .flavor = nullptr});
+
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+  auto builder = ComponentBuilder{componentDescriptorRegistry};
+
+  auto shadowNodeAB = std::shared_ptr<ViewShadowNode>{};
+  auto shadowNodeABA = std::shared_ptr<ViewShadowNode>{};
+
+  auto children = std::vector<ElementFragment>{};
+  for (int i = 0; i < 64; i++) {
+    children.push_back(Element<ViewShadowNode>().tag(100 + i));
+  }
+  // clang-format off
+  children.push_back(
+    Element<ViewShadowNode>()
+      .tag(2)
+      .reference(shadowNodeAB)
+      .children({
+        Element<ViewShadowNode>()
+          .tag(3)
+          .reference(shadowNodeABA)
+      }));
+
+  auto elementA =
+      Element<ViewShadowNode>()
+        .tag(1)
+        .finalize([](ViewShadowNode &shadowNode){
+          shadowNode.sealRecursive();
+        })
+        .children(children);
+  // clang-format on
+
+  auto shadowNodeA = builder.build(elementA);
+
+  // Repeated lookups must be served consistently from the lazily built index.
+  for (int i = 0; i < 2; i++) {
+    auto ancestors = shadowNodeABA->getFamily().getAncestors(*shadowNodeA);
+    EXPECT_EQ(ancestors.size(), 2);
+    EXPECT_EQ(&ancestors[0].first.get(), shadowNodeA.get());
+    EXPECT_EQ(ancestors[0].second, 64);
+    EXPECT_EQ(&ancestors[1].first.get(), shadowNodeAB.get());
+    EXPECT_EQ(ancestors[1].second, 0);
+  }
+
+  EXPECT_EQ(shadowNodeA->getChildIndex(shadowNodeAB->getFamily()), 64);
+  EXPECT_EQ(shadowNodeA->getChildIndex(shadowNodeABA->getFamily()), -1);
+}
+
+TEST(ShadowNodeFamilyTest, childIndexIsInvalidatedOnMutation) {
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              .eventDispatcher = eventDispatcher,
+              .contextContainer = nullptr,
+              .flavor = nullptr});
+
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+  auto builder = ComponentBuilder{componentDescriptorRegistry};
+
+  auto shadowNodeAA = std::shared_ptr<ViewShadowNode>{};
+  auto children = std::vector<ElementFragment>{};
+  children.push_back(Element<ViewShadowNode>().tag(2).reference(shadowNodeAA));
+  for (int i = 0; i < 32; i++) {
+    children.push_back(Element<ViewShadowNode>().tag(100 + i));
+  }
+
+  // The node is left unsealed so that it can be mutated.
+  auto shadowNodeA =
+      builder.build(Element<ViewShadowNode>().tag(1).children(children));
+  auto shadowNodeB = builder.build(Element<ViewShadowNode>().tag(3));
+
+  // Builds the index.
+  EXPECT_EQ(shadowNodeA->getChildIndex(shadowNodeAA->getFamily()), 0);
+  EXPECT_EQ(shadowNodeA->getChildIndex(shadowNodeB->getFamily()), -1);
+
+  shadowNodeA->appendChild(shadowNodeB);
+  EXPECT_EQ(shadowNodeA->getChildIndex(shadowNodeB->getFamily()), 33);
+
+  shadowNodeA->replaceChild(*shadowNodeAA, shadowNodeB->clone({}));
+  EXPECT_EQ(shadowNodeA->getChildIndex(shadowNodeAA->getFamily()), -1);
+  EXPECT_EQ(shadowNodeA->getChildIndex(shadowNodeB->getFamily()), 0);
+}
@@ -12,6 +12,7 @@
 #include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
 #include <react/renderer/core/ConcreteShadowNode.h>
 #include <react/renderer/core/ShadowNode.h>
+#include <react/utils/PoolAllocator.h>
 
 #include "TestComponent.h"
 
@@ -201,6 +202,25 @@ TEST_F(ShadowNodeTest, handleShadowNodeSimpleCloning) {
   EXPECT_EQ(nodeA_->getEventEmitter(), nodeARevision2->getEventEmitter());
 }
 
+TEST_F(ShadowNodeTest, handleCloningWithPooledAllocation) {
+  ShadowNode::setUsePooledAllocation(true);
+  auto telemetryBefore = getPoolAllocatorTelemetry();
+  auto nodeABRevision2 = nodeAB_->clone(
+      {.children = ShadowNode::makeSharedChildren(nodeAB_->getChildren())});
+  auto telemetryAfter = getPoolAllocatorTelemetry();
+  ShadowNode::setUsePooledAllocation(false);
+
+  // The node and its list of children.
+  EXPECT_EQ(telemetryAfter.allocations - telemetryBefore.allocations, 2u);
+  EXPECT_EQ(nodeABRevision2->getTag(), nodeAB_->getTag());
+  EXPECT_EQ(nodeABRevision2->getChildren(), nodeAB_->getChildren());
+
+  nodeABRevision2.reset();
+  EXPECT_EQ(
+      getPoolAllocatorTelemetry().deallocations - telemetryBefore.deallocations,
+      2u);
+}
+
 TEST_F(ShadowNodeTest, handleShadowNodeMutation) {
   auto nodeABChildren = nodeAB_->getChildren();
   EXPECT_EQ(nodeABChildren.size(), 2);
@@ -282,7 +302,9 @@ TEST_F(ShadowNodeTest, handleState) {
           initialState);
   _state->updateState(TestState());
 
+  auto thirdNodeRevision = thirdNode->getSubtreeRevision();
   thirdNode->setStateData(TestState());
+  EXPECT_NE(thirdNode->getSubtreeRevision(), thirdNodeRevision);
   // State object are compared by pointer, not by value.
   EXPECT_EQ(firstNode->getState(), secondNode->getState());
   EXPECT_NE(firstNode->getState(), thirdNode->getState());
@@ -296,6 +318,50 @@ TEST_F(ShadowNodeTest, handleState) {
       "Attempt to mutate a sealed object.");
 }
 
+TEST_F(ShadowNodeTest, handleSubtreeRevision) {
+  // Distinct nodes never share a revision.
+  EXPECT_NE(nodeAA_->getSubtreeRevision(), nodeAB_->getSubtreeRevision());
+
+  // A clone which does not change anything describes the same subtree.
+  auto nodeABRevision2 = nodeAB_->clone({});
+  EXPECT_EQ(
+      nodeABRevision2->getSubtreeRevision(), nodeAB_->getSubtreeRevision());
+
+  auto nodeABRevision3 =
+      nodeAB_->clone({.props = std::make_shared<const TestProps>()});
+  EXPECT_NE(
+      nodeABRevision3->getSubtreeRevision(), nodeAB_->getSubtreeRevision());
+
+  auto nodeABRevision4 = nodeAB_->clone(
+      {.children = ShadowNode::makeSharedChildren(nodeAB_->getChildren())});
+  EXPECT_NE(
+      nodeABRevision4->getSubtreeRevision(), nodeAB_->getSubtreeRevision());
+
+  // Replacing a child changes the subtree, even with an identical clone.
+  auto nodeABRevision5 = nodeAB_->clone({});
+  nodeABRevision5->replaceChild(*nodeABA_, nodeABA_->clone({}));
+  EXPECT_NE(
+      nodeABRevision5->getSubtreeRevision(), nodeAB_->getSubtreeRevision());
+
+  auto nodeABRevision6 = nodeAB_->clone({});
+  nodeABRevision6->appendChild(nodeZ_);
+  EXPECT_NE(
+      nodeABRevision6->getSubtreeRevision(), nodeAB_->getSubtreeRevision());
+  EXPECT_NE(
+      nodeABRevision6->getSubtreeRevision(),
+      nodeABRevision5->getSubtreeRevision());
+
+  // Ancestors cloned by `cloneTree` get new revisions.
+  auto nodeARevision2 = nodeA_->cloneTree(
+      nodeABA_->getFamily(), [](const ShadowNode& oldShadowNode) {
+        return oldShadowNode.clone({});
+      });
+  EXPECT_NE(nodeARevision2->getSubtreeRevision(), nodeA_->getSubtreeRevision());
+  EXPECT_EQ(
+      nodeARevision2->getChildren().at(0)->getSubtreeRevision(),
+      nodeAA_->getSubtreeRevision());
+}
+
 TEST_F(ShadowNodeTest, handleRuntimeReferenceTransferOnClone) {
   auto nodeABRev1 = nodeAB_->clone({});
   auto wrappedShadowNode = std::make_shared<ShadowNodeWrapper>(nodeABRev1);
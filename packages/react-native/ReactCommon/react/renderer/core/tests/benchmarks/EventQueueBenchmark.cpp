@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/RawEvent.h>
+#include <react/renderer/core/ValueFactoryEventPayload.h>
+#include <react/utils/MPSCQueue.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * The previous implementation of `EventQueue`: a vector guarded by a mutex
+ * which is scanned on every unique event.
+ */
+class MutexEventQueue {
+ public:
+  void push(RawEvent&& rawEvent) {
+    std::scoped_lock lock(mutex_);
+
+    if (rawEvent.isUnique) {
+      for (auto it = events_.rbegin(); it != events_.rend(); ++it) {
+        if (it->eventTarget == rawEvent.eventTarget) {
+          if (it->isUnique && it->type == rawEvent.type) {
+            *it = std::move(rawEvent);
+            return;
+          }
+          break;
+        }
+      }
+    }
+
+    events_.push_back(std::move(rawEvent));
+  }
+
+  std::vector<RawEvent> drain() {
+    std::scoped_lock lock(mutex_);
+    return std::move(events_);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<RawEvent> events_;
+};
+
+class LockFreeEventQueue {
+ public:
+  void push(RawEvent&& rawEvent) {
+    queue_.push(std::move(rawEvent));
+  }
+
+  std::vector<RawEvent> drain() {
+    return queue_.drain();
+  }
+
+ private:
+  MPSCQueue<RawEvent> queue_;
+};
+
+/*
+ * Every thread enqueues `scroll`-like unique events for its own target and
+ * `layout`-like regular events, as the UI thread and various callbacks do
+ * during a fling. The first thread also plays the role of the JS thread and
+ * drains the queue once per 64 of its own events (approximating a beat).
+ * Only the producer side is compared: the lock-free queue coalesces unique
+ * events when it is flushed.
+ */
+template <typename QueueT>
+void enqueueEventsUnderContention(benchmark::State& state) {
+  static auto queue = std::make_unique<QueueT>();
+  auto eventTarget = std::make_shared<EventTarget>(nullptr, 1);
+  auto eventPayload =
+      std::make_shared<ValueFactoryEventPayload>(ValueFactory{});
+
+  size_t iteration = 0;
+  size_t flushedEvents = 0;
+  for (auto _ : state) {
+    queue->push(
+        RawEvent(
+            "topScroll",
+            eventPayload,
+            eventTarget,
+            {},
+            RawEvent::Category::Continuous,
+            /* isUnique */ true));
+    if (++iteration % 4 == 0) {
+      queue->push(RawEvent("topLayout", eventPayload, eventTarget, {}));
+    }
+
+    if (state.thread_index() == 0 && iteration % 64 == 0) {
+      flushedEvents += queue->drain().size();
+    }
+  }
+
+  if (state.thread_index() == 0) {
+    flushedEvents += queue->drain().size();
+    state.counters["flushedEvents"] = benchmark::Counter(
+        static_cast<double>(flushedEvents), benchmark::Counter::kAvgIterations);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+void mutexEventQueue(benchmark::State& state) {
+  enqueueEventsUnderContention<MutexEventQueue>(state);
+}
+BENCHMARK(mutexEventQueue)->ThreadRange(1, 8)->UseRealTime();
+
+void lockFreeEventQueue(benchmark::State& state) {
+  enqueueEventsUnderContention<LockFreeEventQueue>(state);
+}
+BENCHMARK(lockFreeEventQueue)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
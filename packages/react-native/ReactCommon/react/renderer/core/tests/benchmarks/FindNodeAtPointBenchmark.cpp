@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/HitTestIndex.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr Float kCanvasSize = 2000;
+constexpr int kPointsCount = 64;
+
+ComponentBuilder createComponentBuilder() {
+  static auto componentDescriptorProviderRegistry = [] {
+    auto registry = std::make_unique<ComponentDescriptorProviderRegistry>();
+    registry->add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    return registry;
+  }();
+
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry->createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              .eventDispatcher = EventDispatcher::Shared{},
+              .contextContainer = nullptr,
+              .flavor = nullptr});
+  return ComponentBuilder{componentDescriptorRegistry};
+}
+
+auto sealRecursive = [](ViewShadowNode& shadowNode) {
+  shadowNode.sealRecursive();
+};
+
+Element<ViewShadowNode> view(Tag tag, Rect frame) {
+  return Element<ViewShadowNode>().tag(tag).finalize(
+      [frame](ViewShadowNode& shadowNode) {
+        auto layoutMetrics = EmptyLayoutMetrics;
+        layoutMetrics.frame = frame;
+        shadowNode.setLayoutMetrics(layoutMetrics);
+      });
+}
+
+/*
+ * Builds a canvas with `count` absolutely positioned, slightly overlapping
+ * views laid out on a grid, each of them with a label view inside.
+ */
+std::shared_ptr<const ShadowNode> buildDenseCanvas(int64_t count) {
+  auto builder = createComponentBuilder();
+  auto side = static_cast<int64_t>(std::ceil(std::sqrt(count)));
+  auto cellSize = kCanvasSize / static_cast<Float>(side);
+
+  Tag tag = 1;
+  auto children = std::vector<ElementFragment>{};
+  children.reserve(count);
+  for (int64_t index = 0; index < count; index++) {
+    auto frame = Rect{
+        .origin =
+            {.x = static_cast<Float>(index % side) * cellSize,
+             .y = static_cast<Float>(index / side) * cellSize},
+        .size = {.width = cellSize * 1.25f, .height = cellSize * 1.25f}};
+    auto labelFrame = Rect{
+        .origin = {.x = 2, .y = 2},
+        .size = {.width = cellSize / 2, .height = cellSize / 4}};
+    children.push_back(
+        view(++tag, frame).children({view(++tag, labelFrame)}));
+  }
+
+  return builder.build(
+      view(1, {.size = {.width = kCanvasSize, .height = kCanvasSize}})
+          .children(children)
+          .finalize(sealRecursive));
+}
+
+std::vector<Point> pointerPath() {
+  // A diagonal pointer move across the canvas.
+  auto points = std::vector<Point>{};
+  points.reserve(kPointsCount);
+  for (int index = 0; index < kPointsCount; index++) {
+    auto offset = kCanvasSize * static_cast<Float>(index) / kPointsCount;
+    points.push_back({.x = offset, .y = kCanvasSize - offset});
+  }
+  return points;
+}
+
+void findNodeAtPointTraversingTree(benchmark::State& state) {
+  auto root = buildDenseCanvas(state.range(0));
+  auto points = pointerPath();
+  for (auto _ : state) {
+    for (const auto& point : points) {
+      benchmark::DoNotOptimize(
+          LayoutableShadowNode::findNodeAtPoint(root, point));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kPointsCount);
+}
+BENCHMARK(findNodeAtPointTraversingTree)->Arg(100)->Arg(1000)->Arg(10000);
+
+void findNodeAtPointWithIndex(benchmark::State& state) {
+  auto root = buildDenseCanvas(state.range(0));
+  auto points = pointerPath();
+  auto hitTestIndex = HitTestIndex{root};
+  for (auto _ : state) {
+    for (const auto& point : points) {
+      benchmark::DoNotOptimize(hitTestIndex.findNodeAtPoint(root, point));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kPointsCount);
+}
+BENCHMARK(findNodeAtPointWithIndex)->Arg(100)->Arg(1000)->Arg(10000);
+
+/*
+ * Includes building the index, as after every commit.
+ */
+void findNodeAtPointWithNewIndex(benchmark::State& state) {
+  auto root = buildDenseCanvas(state.range(0));
+  auto points = pointerPath();
+  for (auto _ : state) {
+    auto hitTestIndex = HitTestIndex{root};
+    for (const auto& point : points) {
+      benchmark::DoNotOptimize(hitTestIndex.findNodeAtPoint(root, point));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kPointsCount);
+}
+BENCHMARK(findNodeAtPointWithNewIndex)->Arg(100)->Arg(1000)->Arg(10000);
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
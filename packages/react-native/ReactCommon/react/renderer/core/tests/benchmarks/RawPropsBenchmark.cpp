@@ -33,6 +33,47 @@ auto propsStringWithSomeUnsupportedProps = std::string{
 auto unsupportedPropsDynamic =
     folly::parseJson(propsStringWithSomeUnsupportedProps);
 
+// A typical styled and accessible view: 30 props.
+auto mediumPropsString = std::string{R"({
+  "flex": 1, "flexDirection": "row", "alignItems": "center",
+  "justifyContent": "space-between", "marginTop": 8, "marginBottom": 8,
+  "marginHorizontal": 16, "paddingVertical": 12, "paddingHorizontal": 16,
+  "borderRadius": 12, "borderWidth": 1, "borderColor": 4278190335,
+  "backgroundColor": 4294967295, "opacity": 0.9, "shadowColor": 4278190080,
+  "shadowOpacity": 0.2, "shadowRadius": 4, "elevation": 2,
+  "overflow": "hidden", "minHeight": 48, "width": "100%",
+  "zIndex": 1, "nativeID": "card", "testID": "card-test",
+  "accessible": true, "accessibilityLabel": "Card",
+  "accessibilityHint": "Opens the details", "accessibilityRole": "button",
+  "pointerEvents": "box-none", "collapsable": false
+})"};
+auto mediumPropsDynamic = folly::parseJson(mediumPropsString);
+
+// A heavily customized view: 60 props, a few of which aren't view props.
+auto largePropsString = std::string{R"({
+  "flex": 1, "flexDirection": "column", "flexWrap": "wrap", "flexGrow": 1,
+  "flexShrink": 0, "alignItems": "stretch", "alignSelf": "auto",
+  "alignContent": "flex-start", "justifyContent": "center",
+  "position": "relative", "top": 0, "left": 0, "right": 0, "bottom": 0,
+  "marginTop": 4, "marginBottom": 4, "marginLeft": 8, "marginRight": 8,
+  "paddingTop": 10, "paddingBottom": 10, "paddingLeft": 12,
+  "paddingRight": 12, "rowGap": 4, "columnGap": 4, "width": 320,
+  "height": 200, "minWidth": 100, "maxWidth": 480, "minHeight": 40,
+  "maxHeight": 640, "aspectRatio": 1.5, "borderTopLeftRadius": 8,
+  "borderTopRightRadius": 8, "borderBottomLeftRadius": 4,
+  "borderBottomRightRadius": 4, "borderTopWidth": 1, "borderBottomWidth": 2,
+  "borderStyle": "solid", "borderColor": 4278190335,
+  "backgroundColor": 4294967295, "opacity": 1, "backfaceVisibility": "hidden",
+  "shadowColor": 4278190080, "shadowOpacity": 0.3, "shadowRadius": 6,
+  "overflow": "visible", "zIndex": 2, "direction": "ltr", "display": "flex",
+  "nativeID": "hero", "testID": "hero-test", "accessible": true,
+  "accessibilityLabel": "Hero image", "accessibilityRole": "image",
+  "importantForAccessibility": "yes", "pointerEvents": "auto",
+  "removeClippedSubviews": false, "onLayout": true, "customDataSet": 1,
+  "someUnsupportedProp": "value"
+})"};
+auto largePropsDynamic = folly::parseJson(largePropsString);
+
 auto sourceProps = ViewProps{};
 auto sharedSourceProps = ViewShadowNode::defaultSharedProps();
 
@@ -73,6 +114,26 @@ static void propParsingUnsupportedRawProps(benchmark::State& state) {
 }
 BENCHMARK(propParsingUnsupportedRawProps);
 
+static void propParsingMediumRawProps(benchmark::State& state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext, sharedSourceProps, RawProps{mediumPropsDynamic});
+  }
+}
+BENCHMARK(propParsingMediumRawProps);
+
+static void propParsingLargeRawProps(benchmark::State& state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext, sharedSourceProps, RawProps{largePropsDynamic});
+  }
+}
+BENCHMARK(propParsingLargeRawProps);
+
 static void propParsingRegularRawPropsWithNoSourceProps(
     benchmark::State& state) {
   ContextContainer contextContainer{};
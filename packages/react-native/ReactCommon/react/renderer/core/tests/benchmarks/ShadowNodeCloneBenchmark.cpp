@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/utils/PoolAllocator.h>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+ComponentBuilder createComponentBuilder() {
+  static auto componentDescriptorProviderRegistry = [] {
+    auto registry = std::make_unique<ComponentDescriptorProviderRegistry>();
+    registry->add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    return registry;
+  }();
+
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry->createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              .eventDispatcher = EventDispatcher::Shared{},
+              .contextContainer = nullptr,
+              .flavor = nullptr});
+  return ComponentBuilder{componentDescriptorRegistry};
+}
+
+/*
+ * Simulates a stream of commits which each clone every node of a tree with
+ * `width` sections of `width` views. The tree of the previous commit is
+ * released while the next one is built, as it happens in a running app.
+ */
+void cloneEveryNodePerCommit(
+    benchmark::State& state,
+    bool usePooledAllocation) {
+  ShadowNode::setUsePooledAllocation(usePooledAllocation);
+  auto builder = createComponentBuilder();
+  auto width = state.range(0);
+
+  Tag tag = 1;
+  auto sections = std::vector<ElementFragment>{};
+  sections.reserve(width);
+  for (int section = 0; section < width; section++) {
+    auto views = std::vector<ElementFragment>{};
+    views.reserve(width);
+    for (int view = 0; view < width; view++) {
+      views.push_back(Element<ViewShadowNode>().tag(++tag));
+    }
+    sections.push_back(Element<ViewShadowNode>().tag(++tag).children(views));
+  }
+
+  std::shared_ptr<const ShadowNode> root =
+      builder.build(Element<ViewShadowNode>().tag(1).children(sections));
+
+  auto families = std::unordered_set<std::shared_ptr<const ShadowNodeFamily>>{};
+  for (const auto& section : root->getChildren()) {
+    families.insert(section->getFamilyShared());
+    for (const auto& view : section->getChildren()) {
+      families.insert(view->getFamilyShared());
+    }
+  }
+
+  auto telemetryBefore = getPoolAllocatorTelemetry();
+  for (auto _ : state) {
+    root = root->cloneMultiple(
+        families,
+        [](const ShadowNode& oldShadowNode,
+           const ShadowNodeFragment& fragment) {
+          return oldShadowNode.clone(fragment);
+        });
+  }
+  auto telemetryAfter = getPoolAllocatorTelemetry();
+
+  auto allocations = telemetryAfter.allocations - telemetryBefore.allocations;
+  auto reusedAllocations =
+      telemetryAfter.reusedAllocations - telemetryBefore.reusedAllocations;
+  state.counters["pooledAllocationsPerCommit"] = benchmark::Counter(
+      static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+  state.counters["reusedAllocationsPerCommit"] = benchmark::Counter(
+      static_cast<double>(reusedAllocations),
+      benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(
+      static_cast<int64_t>(state.iterations() * (families.size() + 1)));
+
+  ShadowNode::setUsePooledAllocation(false);
+}
+
+void heapAllocatedCommit(benchmark::State& state) {
+  cloneEveryNodePerCommit(state, false);
+}
+BENCHMARK(heapAllocatedCommit)->Arg(8)->Arg(32)->Arg(100);
+
+void pooledCommit(benchmark::State& state) {
+  cloneEveryNodePerCommit(state, true);
+}
+BENCHMARK(pooledCommit)->Arg(8)->Arg(32)->Arg(100);
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
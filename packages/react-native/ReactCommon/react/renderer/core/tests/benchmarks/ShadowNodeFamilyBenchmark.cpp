@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+ComponentBuilder createComponentBuilder() {
+  static auto componentDescriptorProviderRegistry = [] {
+    auto registry = std::make_unique<ComponentDescriptorProviderRegistry>();
+    registry->add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    return registry;
+  }();
+
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry->createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              .eventDispatcher = EventDispatcher::Shared{},
+              .contextContainer = nullptr,
+              .flavor = nullptr});
+  return ComponentBuilder{componentDescriptorRegistry};
+}
+
+auto sealRecursive = [](ViewShadowNode& shadowNode) {
+  shadowNode.sealRecursive();
+};
+
+/*
+ * Builds a root with `width` children where the last child is the target.
+ */
+void getAncestorsOfWideTree(benchmark::State& state) {
+  auto builder = createComponentBuilder();
+  auto width = state.range(0);
+
+  auto target = std::shared_ptr<ViewShadowNode>{};
+  auto children = std::vector<ElementFragment>{};
+  children.reserve(width);
+  for (Tag tag = 2; tag < width + 1; tag++) {
+    children.push_back(Element<ViewShadowNode>().tag(tag));
+  }
+  children.push_back(
+      Element<ViewShadowNode>().tag(width + 1).reference(target));
+
+  auto root = builder.build(Element<ViewShadowNode>()
+                                .tag(1)
+                                .children(children)
+                                .finalize(sealRecursive));
+
+  const auto& family = target->getFamily();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(family.getAncestors(*root));
+  }
+}
+BENCHMARK(getAncestorsOfWideTree)->Arg(8)->Arg(64)->Arg(512)->Arg(2000);
+
+/*
+ * Builds a chain of `depth` nodes where every level also has `width - 1`
+ * siblings preceding the next link.
+ */
+void getAncestorsOfDeepTree(benchmark::State& state) {
+  auto builder = createComponentBuilder();
+  auto depth = state.range(0);
+  auto width = state.range(1);
+
+  auto target = std::shared_ptr<ViewShadowNode>{};
+  Tag tag = 1;
+  auto element = Element<ViewShadowNode>().tag(tag++).reference(target);
+  for (int level = 0; level < depth; level++) {
+    auto children = std::vector<ElementFragment>{};
+    children.reserve(width);
+    for (int index = 0; index < width - 1; index++) {
+      children.push_back(Element<ViewShadowNode>().tag(tag++));
+    }
+    children.push_back(element);
+    element = Element<ViewShadowNode>().tag(tag++).children(children);
+  }
+
+  auto root = builder.build(element.finalize(sealRecursive));
+
+  const auto& family = target->getFamily();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(family.getAncestors(*root));
+  }
+}
+BENCHMARK(getAncestorsOfDeepTree)
+    ->Args({16, 4})
+    ->Args({16, 64})
+    ->Args({64, 4})
+    ->Args({64, 64});
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -12,6 +12,9 @@
 #include <react/renderer/graphics/Rect.h>
 #include <react/renderer/graphics/Size.h>
 #include <cmath>
+#include <optional>
+#include <unordered_map>
+#include <utility>
 
 namespace facebook::react::dom {
 
@@ -156,6 +159,226 @@ Rect getScrollableContentBounds(
       .size = Size{.width = maxX - minX, .height = maxY - minY}};
 }
 
+DOMRect domRectFromFrame(const Rect& frame) {
+  return DOMRect{
+      .x = frame.origin.x,
+      .y = frame.origin.y,
+      .width = frame.size.width,
+      .height = frame.size.height};
+}
+
+/*
+ * Maps rects in the coordinate space of the children of a node to the
+ * coordinate space of the root, as `LayoutableShadowNode` does going through
+ * the ancestors of each child one by one. The mapping is kept as a scale and a
+ * translation per axis, which is only possible if no transform in the way
+ * rotates or skews (`isAffine`). `isEmpty` is set if a node in the way is not
+ * displayed or isn't layoutable.
+ */
+struct AncestorsMapping {
+  Float scaleX{1};
+  Float scaleY{1};
+  Float translateX{0};
+  Float translateY{0};
+  bool isAffine{true};
+  bool isEmpty{false};
+};
+
+bool isRootNodeKind(const ShadowNode& shadowNode) {
+  return shadowNode.getTraits().check(ShadowNodeTraits::Trait::RootNodeKind);
+}
+
+bool shouldApplyTransform(
+    const ShadowNode& shadowNode,
+    LayoutableShadowNode::LayoutInspectingPolicy policy) {
+  return isRootNodeKind(shadowNode) ? policy.includeViewportOffset
+                                    : policy.includeTransform;
+}
+
+AncestorsMapping getChildrenMapping(
+    const ShadowNode& shadowNode,
+    const AncestorsMapping& parentMapping,
+    LayoutableShadowNode::LayoutInspectingPolicy policy) {
+  // Computing layout metrics stops at the closest node with the
+  // `RootNodeKind` trait.
+  auto isRootNode = isRootNodeKind(shadowNode);
+  auto mapping = isRootNode ? AncestorsMapping{} : parentMapping;
+  if (mapping.isEmpty) {
+    return mapping;
+  }
+
+  auto layoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode*>(&shadowNode);
+  if (layoutableShadowNode == nullptr ||
+      layoutableShadowNode->getLayoutMetrics().displayType ==
+          DisplayType::None) {
+    mapping.isEmpty = true;
+    return mapping;
+  }
+
+  if (!mapping.isAffine) {
+    return mapping;
+  }
+
+  auto frame = layoutableShadowNode->getLayoutMetrics().frame;
+  if (isRootNode) {
+    frame.origin = {.x = 0, .y = 0};
+  }
+
+  Float scaleX = 1;
+  Float scaleY = 1;
+  auto translateX = frame.origin.x;
+  auto translateY = frame.origin.y;
+
+  if (shouldApplyTransform(shadowNode, policy)) {
+    auto transform = layoutableShadowNode->getTransform();
+    const auto& matrix = transform.matrix;
+    if (matrix[1] != 0 || matrix[4] != 0) {
+      mapping.isAffine = false;
+      return mapping;
+    }
+
+    // Same as `Transform::applyWithCenter` for a transform that keeps rects
+    // axis-aligned.
+    auto center = frame.getCenter();
+    scaleX = matrix[0];
+    scaleY = matrix[5];
+    translateX =
+        matrix[0] * (frame.origin.x - center.x) + matrix[12] + center.x;
+    translateY =
+        matrix[5] * (frame.origin.y - center.y) + matrix[13] + center.y;
+  }
+
+  if (policy.includeTransform) {
+    auto contentOriginOffset = layoutableShadowNode->getContentOriginOffset(
+        /* includeTransform */ true);
+    translateX += contentOriginOffset.x;
+    translateY += contentOriginOffset.y;
+  }
+
+  mapping.translateX += mapping.scaleX * translateX;
+  mapping.translateY += mapping.scaleY * translateY;
+  mapping.scaleX *= scaleX;
+  mapping.scaleY *= scaleY;
+  return mapping;
+}
+
+/*
+ * Returns the frame `LayoutableShadowNode::computeRelativeLayoutMetrics`
+ * computes for `shadowNode` (the last node in `ancestors`), given the mapping
+ * of its parent.
+ */
+std::optional<Rect> getFrameFromRoot(
+    const ShadowNode& shadowNode,
+    const ShadowNodeFamily::AncestorList& ancestors,
+    const AncestorsMapping& parentMapping,
+    LayoutableShadowNode::LayoutInspectingPolicy policy) {
+  if (parentMapping.isEmpty) {
+    return std::nullopt;
+  }
+
+  if (!parentMapping.isAffine) {
+    auto layoutMetrics =
+        LayoutableShadowNode::computeRelativeLayoutMetrics(ancestors, policy);
+    if (layoutMetrics == EmptyLayoutMetrics) {
+      return std::nullopt;
+    }
+    return layoutMetrics.frame;
+  }
+
+  auto layoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode*>(&shadowNode);
+  if (layoutableShadowNode == nullptr ||
+      layoutableShadowNode->getLayoutMetrics().displayType ==
+          DisplayType::None) {
+    return std::nullopt;
+  }
+
+  auto frame = layoutableShadowNode->getLayoutMetrics().frame;
+  if (shouldApplyTransform(shadowNode, policy)) {
+    frame = layoutableShadowNode->getTransform().applyWithCenter(
+        frame, frame.getCenter());
+  }
+
+  auto minX = frame.getMinX() * parentMapping.scaleX + parentMapping.translateX;
+  auto maxX = frame.getMaxX() * parentMapping.scaleX + parentMapping.translateX;
+  auto minY = frame.getMinY() * parentMapping.scaleY + parentMapping.translateY;
+  auto maxY = frame.getMaxY() * parentMapping.scaleY + parentMapping.translateY;
+  if (minX > maxX) {
+    std::swap(minX, maxX);
+  }
+  if (minY > maxY) {
+    std::swap(minY, maxY);
+  }
+
+  return Rect{
+      .origin = Point{.x = minX, .y = minY},
+      .size = Size{.width = maxX - minX, .height = maxY - minY}};
+}
+
+/*
+ * Walks a revision once, measuring the nodes of the requested families when
+ * found and sharing the mapping of their common ancestors.
+ */
+class BoundingClientRectsWalker {
+ public:
+  BoundingClientRectsWalker(
+      std::unordered_map<const ShadowNodeFamily*, std::vector<size_t>>
+          pendingIndices,
+      LayoutableShadowNode::LayoutInspectingPolicy policy,
+      std::vector<DOMRect>& result)
+      : pendingIndices_(std::move(pendingIndices)),
+        policy_(policy),
+        result_(result) {}
+
+  /*
+   * Returns `false` once all the requested nodes have been found.
+   */
+  bool walk(const ShadowNode& shadowNode, const AncestorsMapping& mapping) {
+    const auto& children = shadowNode.getChildren();
+    for (size_t index = 0; index < children.size(); index++) {
+      const auto& childNode = *children[index];
+      ancestors_.emplace_back(shadowNode, static_cast<int>(index));
+
+      auto pendingIt = pendingIndices_.find(&childNode.getFamily());
+      if (pendingIt != pendingIndices_.end()) {
+        auto frame =
+            getFrameFromRoot(childNode, ancestors_, mapping, policy_);
+        if (frame) {
+          for (auto resultIndex : pendingIt->second) {
+            result_[resultIndex] = domRectFromFrame(*frame);
+          }
+        }
+        pendingIndices_.erase(pendingIt);
+        if (pendingIndices_.empty()) {
+          return false;
+        }
+      }
+
+      if (!childNode.getChildren().empty()) {
+        // Hidden subtrees are walked too: measuring stops at the closest
+        // node with the `RootNodeKind` trait, so the descendants of such a
+        // node under a node that isn't displayed can still be measured.
+        auto childrenMapping =
+            getChildrenMapping(childNode, mapping, policy_);
+        if (!walk(childNode, childrenMapping)) {
+          return false;
+        }
+      }
+
+      ancestors_.pop_back();
+    }
+    return true;
+  }
+
+ private:
+  std::unordered_map<const ShadowNodeFamily*, std::vector<size_t>>
+      pendingIndices_;
+  LayoutableShadowNode::LayoutInspectingPolicy policy_;
+  std::vector<DOMRect>& result_;
+  ShadowNodeFamily::AncestorList ancestors_;
+};
+
 } // namespace
 
 std::shared_ptr<const ShadowNode> getElementById(
@@ -297,6 +520,42 @@ DOMRect getBoundingClientRect(
       .height = frame.size.height};
 }
 
+std::vector<DOMRect> getBoundingClientRects(
+    const RootShadowNode::Shared& currentRevision,
+    const std::vector<std::shared_ptr<const ShadowNode>>& shadowNodes,
+    bool includeTransform) {
+  auto result = std::vector<DOMRect>(shadowNodes.size());
+
+  auto pendingIndices =
+      std::unordered_map<const ShadowNodeFamily*, std::vector<size_t>>{};
+  for (size_t index = 0; index < shadowNodes.size(); index++) {
+    const auto& shadowNode = shadowNodes[index];
+    if (shadowNode == nullptr) {
+      continue;
+    }
+    if (ShadowNode::sameFamily(*currentRevision, *shadowNode)) {
+      result[index] = getBoundingClientRect(
+          currentRevision, *shadowNode, includeTransform);
+      continue;
+    }
+    pendingIndices[&shadowNode->getFamily()].push_back(index);
+  }
+
+  if (pendingIndices.empty()) {
+    return result;
+  }
+
+  auto policy = LayoutableShadowNode::LayoutInspectingPolicy{
+      .includeTransform = includeTransform, .includeViewportOffset = true};
+  auto walker =
+      BoundingClientRectsWalker{std::move(pendingIndices), policy, result};
+  walker.walk(
+      *currentRevision,
+      getChildrenMapping(*currentRevision, AncestorsMapping{}, policy));
+
+  return result;
+}
+
 DOMOffset getOffset(
     const RootShadowNode::Shared& currentRevision,
     const ShadowNode& shadowNode) {
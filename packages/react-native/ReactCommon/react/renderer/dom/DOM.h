@@ -86,6 +86,16 @@ DOMRect getBoundingClientRect(
     const ShadowNode &shadowNode,
     bool includeTransform);
 
+/*
+ * Equivalent to calling `getBoundingClientRect` for each node in
+ * `shadowNodes`, but measures all of them in a single walk of
+ * `currentRevision`, sharing the work for their common ancestors.
+ */
+std::vector<DOMRect> getBoundingClientRects(
+    const RootShadowNode::Shared &currentRevision,
+    const std::vector<std::shared_ptr<const ShadowNode>> &shadowNodes,
+    bool includeTransform);
+
 DOMOffset getOffset(const RootShadowNode::Shared &currentRevision, const ShadowNode &shadowNode);
 
 DOMPoint getScrollPosition(const RootShadowNode::Shared &currentRevision, const ShadowNode &shadowNode);
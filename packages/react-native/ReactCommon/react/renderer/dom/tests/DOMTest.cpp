@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/dom/DOM.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+
+namespace facebook::react {
+
+namespace {
+
+template <typename ShadowNodeT>
+auto setFrame(Rect frame, DisplayType displayType = DisplayType::Flex) {
+  return [=](ShadowNodeT& shadowNode) {
+    auto layoutMetrics = EmptyLayoutMetrics;
+    layoutMetrics.frame = frame;
+    layoutMetrics.displayType = displayType;
+    shadowNode.setLayoutMetrics(layoutMetrics);
+  };
+}
+
+auto viewProps(Transform transform) {
+  return [=]() {
+    auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+    sharedProps->transform = transform;
+    return sharedProps;
+  };
+}
+
+auto rootProps(Point viewportOffset) {
+  return [=]() {
+    auto sharedProps = std::make_shared<RootProps>();
+    sharedProps->layoutContext.viewportOffset = viewportOffset;
+    return sharedProps;
+  };
+}
+
+/*
+ * Checks that `getBoundingClientRects` returns what `getBoundingClientRect`
+ * returns for each node, with and without transforms.
+ */
+void expectSameRectsAsPerNodeMeasurement(
+    const RootShadowNode::Shared& currentRevision,
+    const std::vector<std::shared_ptr<const ShadowNode>>& shadowNodes) {
+  for (auto includeTransform : {false, true}) {
+    auto rects = dom::getBoundingClientRects(
+        currentRevision, shadowNodes, includeTransform);
+    ASSERT_EQ(rects.size(), shadowNodes.size());
+
+    for (size_t i = 0; i < shadowNodes.size(); i++) {
+      auto expected = shadowNodes[i] == nullptr
+          ? dom::DOMRect{}
+          : dom::getBoundingClientRect(
+                currentRevision, *shadowNodes[i], includeTransform);
+      SCOPED_TRACE(
+          "node " + std::to_string(i) + ", includeTransform " +
+          std::to_string(includeTransform));
+      EXPECT_NEAR(rects[i].x, expected.x, 1e-4);
+      EXPECT_NEAR(rects[i].y, expected.y, 1e-4);
+      EXPECT_NEAR(rects[i].width, expected.width, 1e-4);
+      EXPECT_NEAR(rects[i].height, expected.height, 1e-4);
+    }
+  }
+}
+
+} // namespace
+
+/*
+ * <Root viewportOffset>
+ *   <View A scale>
+ *     <View B translate>
+ *       <View C non-uniform scale />
+ *     </View>
+ *   </View>
+ *   <View D rotate>
+ *     <View E scale>
+ *       <View F />
+ *     </View>
+ *   </View>
+ *   <View G display:none>
+ *     <View H />
+ *     <Root L viewportOffset>
+ *       <View M scale />
+ *     </Root>
+ *   </View>
+ *   <View I translate>
+ *     <Root J viewportOffset>
+ *       <View K scale />
+ *     </Root>
+ *   </View>
+ * </Root>
+ */
+class DOMTest : public testing::Test {
+ protected:
+  DOMTest() {
+    auto builder = simpleComponentBuilder();
+
+    // clang-format off
+    auto element =
+      Element<RootShadowNode>()
+        .props(rootProps({.x = 10, .y = 20}))
+        .finalize(setFrame<RootShadowNode>(
+          {.origin = {.x = 0, .y = 0}, .size = {.width = 1000, .height = 1000}}))
+        .children({
+          Element<ViewShadowNode>()
+            .reference(nodeA_)
+            .props(viewProps(Transform::Scale(2, 2, 1)))
+            .finalize(setFrame<ViewShadowNode>(
+              {.origin = {.x = 10, .y = 20}, .size = {.width = 400, .height = 400}}))
+            .children({
+              Element<ViewShadowNode>()
+                .reference(nodeB_)
+                .props(viewProps(Transform::Translate(7, 9, 0)))
+                .finalize(setFrame<ViewShadowNode>(
+                  {.origin = {.x = 5, .y = 5}, .size = {.width = 100, .height = 100}}))
+                .children({
+                  Element<ViewShadowNode>()
+                    .reference(nodeC_)
+                    .props(viewProps(Transform::Scale(0.5, 1.5, 1)))
+                    .finalize(setFrame<ViewShadowNode>(
+                      {.origin = {.x = 1, .y = 2}, .size = {.width = 30, .height = 40}}))
+                })
+            }),
+          Element<ViewShadowNode>()
+            .reference(nodeD_)
+            .props(viewProps(Transform::RotateZ(0.3)))
+            .finalize(setFrame<ViewShadowNode>(
+              {.origin = {.x = 50, .y = 50}, .size = {.width = 200, .height = 200}}))
+            .children({
+              Element<ViewShadowNode>()
+                .reference(nodeE_)
+                .props(viewProps(Transform::Scale(2, 2, 1)))
+                .finalize(setFrame<ViewShadowNode>(
+                  {.origin = {.x = 10, .y = 10}, .size = {.width = 50, .height = 50}}))
+                .children({
+                  Element<ViewShadowNode>()
+                    .reference(nodeF_)
+                    .finalize(setFrame<ViewShadowNode>(
+                      {.origin = {.x = 3, .y = 4}, .size = {.width = 10, .height = 10}}))
+                })
+            }),
+          Element<ViewShadowNode>()
+            .reference(nodeG_)
+            .finalize(setFrame<ViewShadowNode>(
+              {.origin = {.x = 5, .y = 5}, .size = {.width = 50, .height = 50}},
+              DisplayType::None))
+            .children({
+              Element<ViewShadowNode>()
+                .reference(nodeH_)
+                .finalize(setFrame<ViewShadowNode>(
+                  {.origin = {.x = 1, .y = 1}, .size = {.width = 10, .height = 10}})),
+              Element<RootShadowNode>()
+                .reference(nodeL_)
+                .props(rootProps({.x = 3, .y = 4}))
+                .finalize(setFrame<RootShadowNode>(
+                  {.origin = {.x = 2, .y = 2}, .size = {.width = 40, .height = 40}}))
+                .children({
+                  Element<ViewShadowNode>()
+                    .reference(nodeM_)
+                    .props(viewProps(Transform::Scale(2, 2, 1)))
+                    .finalize(setFrame<ViewShadowNode>(
+                      {.origin = {.x = 5, .y = 6}, .size = {.width = 10, .height = 10}}))
+                })
+            }),
+          Element<ViewShadowNode>()
+            .reference(nodeI_)
+            .props(viewProps(Transform::Translate(-30, 40, 0)))
+            .finalize(setFrame<ViewShadowNode>(
+              {.origin = {.x = 100, .y = 100}, .size = {.width = 300, .height = 300}}))
+            .children({
+              Element<RootShadowNode>()
+                .reference(nodeJ_)
+                .props(rootProps({.x = 5, .y = 6}))
+                .finalize(setFrame<RootShadowNode>(
+                  {.origin = {.x = 20, .y = 20}, .size = {.width = 100, .height = 100}}))
+                .children({
+                  Element<ViewShadowNode>()
+                    .reference(nodeK_)
+                    .props(viewProps(Transform::Scale(3, 3, 1)))
+                    .finalize(setFrame<ViewShadowNode>(
+                      {.origin = {.x = 1, .y = 1}, .size = {.width = 10, .height = 10}}))
+                })
+            })
+        });
+    // clang-format on
+
+    root_ = builder.build(element);
+
+    auto unmountedElement = Element<ViewShadowNode>().finalize(
+        setFrame<ViewShadowNode>(
+            {.origin = {.x = 1, .y = 1},
+             .size = {.width = 10, .height = 10}}));
+    unmountedNode_ = builder.build(unmountedElement);
+  }
+
+  RootShadowNode::Shared root_;
+  std::shared_ptr<ViewShadowNode> nodeA_;
+  std::shared_ptr<ViewShadowNode> nodeB_;
+  std::shared_ptr<ViewShadowNode> nodeC_;
+  std::shared_ptr<ViewShadowNode> nodeD_;
+  std::shared_ptr<ViewShadowNode> nodeE_;
+  std::shared_ptr<ViewShadowNode> nodeF_;
+  std::shared_ptr<ViewShadowNode> nodeG_;
+  std::shared_ptr<ViewShadowNode> nodeH_;
+  std::shared_ptr<ViewShadowNode> nodeI_;
+  std::shared_ptr<RootShadowNode> nodeJ_;
+  std::shared_ptr<ViewShadowNode> nodeK_;
+  std::shared_ptr<RootShadowNode> nodeL_;
+  std::shared_ptr<ViewShadowNode> nodeM_;
+  std::shared_ptr<const ShadowNode> unmountedNode_;
+};
+
+TEST_F(DOMTest, getBoundingClientRectsWithNestedScaleAndTranslate) {
+  expectSameRectsAsPerNodeMeasurement(root_, {nodeA_, nodeB_, nodeC_});
+
+  // The transforms are applied: C isn't just offset by its ancestors' frames.
+  auto rects = dom::getBoundingClientRects(root_, {nodeC_}, true);
+  auto rectsWithoutTransform =
+      dom::getBoundingClientRects(root_, {nodeC_}, false);
+  EXPECT_NE(rects[0].height, rectsWithoutTransform[0].height);
+  EXPECT_NE(rects[0].x, rectsWithoutTransform[0].x);
+}
+
+TEST_F(DOMTest, getBoundingClientRectsFallsBackUnderRotation) {
+  expectSameRectsAsPerNodeMeasurement(root_, {nodeD_, nodeE_, nodeF_});
+
+  // Nodes measured before and after the rotated subtree share one walk.
+  expectSameRectsAsPerNodeMeasurement(root_, {nodeC_, nodeF_, nodeK_});
+}
+
+TEST_F(DOMTest, getBoundingClientRectsUnderDisplayNone) {
+  expectSameRectsAsPerNodeMeasurement(root_, {nodeG_, nodeH_, nodeI_});
+
+  auto rects = dom::getBoundingClientRects(root_, {nodeG_, nodeH_}, true);
+  EXPECT_EQ(rects[0].width, 0);
+  EXPECT_EQ(rects[1].width, 0);
+}
+
+TEST_F(DOMTest, getBoundingClientRectsUnderRootNodeKindInDisplayNone) {
+  expectSameRectsAsPerNodeMeasurement(root_, {nodeG_, nodeL_, nodeM_});
+
+  // Measuring M stops at L, so the hidden G doesn't make it empty.
+  auto rects = dom::getBoundingClientRects(root_, {nodeL_, nodeM_}, true);
+  EXPECT_EQ(rects[0].width, 0);
+  EXPECT_NE(rects[1].width, 0);
+}
+
+TEST_F(DOMTest, getBoundingClientRectsAcrossNestedRootNodeKind) {
+  expectSameRectsAsPerNodeMeasurement(root_, {nodeI_, nodeJ_, nodeK_});
+}
+
+TEST_F(DOMTest, getBoundingClientRectsWithDuplicateAndUnmountedNodes) {
+  expectSameRectsAsPerNodeMeasurement(
+      root_,
+      {nodeK_,
+       unmountedNode_,
+       nodeC_,
+       nullptr,
+       nodeK_,
+       root_,
+       nodeF_,
+       nodeC_,
+       unmountedNode_});
+}
+
+TEST_F(DOMTest, getBoundingClientRectsForAllNodes) {
+  expectSameRectsAsPerNodeMeasurement(
+      root_,
+      {root_,
+       nodeA_,
+       nodeB_,
+       nodeC_,
+       nodeD_,
+       nodeE_,
+       nodeF_,
+       nodeG_,
+       nodeH_,
+       nodeI_,
+       nodeJ_,
+       nodeK_,
+       nodeL_,
+       nodeM_});
+}
+
+} // namespace facebook::react
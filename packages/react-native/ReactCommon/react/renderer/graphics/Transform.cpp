@@ -11,6 +11,7 @@
 
 #include <glog/logging.h>
 #include <react/debug/react_native_assert.h>
+#include <react/renderer/graphics/TransformKernels.h>
 #include <react/utils/FloatComparison.h>
 
 namespace facebook::react {
@@ -162,6 +163,17 @@ Transform::Translate(Float x, Float y, Float z) noexcept {
   return transform;
 }
 
+/* static */ std::optional<Transform> Transform::Inverse(
+    const Transform& transform) noexcept {
+  auto inverse = Transform{};
+  if (!invertTransformMatrix(transform.matrix, inverse.matrix)) {
+    return std::nullopt;
+  }
+  inverse.operations.push_back(
+      DefaultTransformOperation(TransformOperationType::Arbitrary));
+  return inverse;
+}
+
 /* static */ Transform Transform::FromTransformOperation(
     TransformOperation transformOperation,
     const Size& size,
@@ -378,59 +390,7 @@ Transform Transform::operator*(const Transform& rhs) const {
     result.operations.push_back(op);
   }
 
-  auto lhs00 = lhs.matrix[0];
-  auto lhs01 = lhs.matrix[1];
-  auto lhs02 = lhs.matrix[2];
-  auto lhs03 = lhs.matrix[3];
-  auto lhs10 = lhs.matrix[4];
-  auto lhs11 = lhs.matrix[5];
-  auto lhs12 = lhs.matrix[6];
-  auto lhs13 = lhs.matrix[7];
-  auto lhs20 = lhs.matrix[8];
-  auto lhs21 = lhs.matrix[9];
-  auto lhs22 = lhs.matrix[10];
-  auto lhs23 = lhs.matrix[11];
-  auto lhs30 = lhs.matrix[12];
-  auto lhs31 = lhs.matrix[13];
-  auto lhs32 = lhs.matrix[14];
-  auto lhs33 = lhs.matrix[15];
-
-  auto rhs0 = rhs.matrix[0];
-  auto rhs1 = rhs.matrix[1];
-  auto rhs2 = rhs.matrix[2];
-  auto rhs3 = rhs.matrix[3];
-  result.matrix[0] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[1] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[2] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[3] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[4];
-  rhs1 = rhs.matrix[5];
-  rhs2 = rhs.matrix[6];
-  rhs3 = rhs.matrix[7];
-  result.matrix[4] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[5] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[6] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[7] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[8];
-  rhs1 = rhs.matrix[9];
-  rhs2 = rhs.matrix[10];
-  rhs3 = rhs.matrix[11];
-  result.matrix[8] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[9] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[10] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[11] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[12];
-  rhs1 = rhs.matrix[13];
-  rhs2 = rhs.matrix[14];
-  rhs3 = rhs.matrix[15];
-  result.matrix[12] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[13] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[14] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[15] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
+  multiplyTransformMatrices(lhs.matrix, rhs.matrix, result.matrix);
   return result;
 }
 
@@ -458,23 +418,7 @@ Rect operator*(const Rect& rect, const Transform& transform) {
 }
 
 Rect Transform::applyWithCenter(const Rect& rect, const Point& center) const {
-  auto a = Point{.x = rect.origin.x, .y = rect.origin.y} - center;
-  auto b = Point{.x = rect.getMaxX(), .y = rect.origin.y} - center;
-  auto c = Point{.x = rect.getMaxX(), .y = rect.getMaxY()} - center;
-  auto d = Point{.x = rect.origin.x, .y = rect.getMaxY()} - center;
-
-  auto vectorA = *this * Vector{.x = a.x, .y = a.y, .z = 0, .w = 1};
-  auto vectorB = *this * Vector{.x = b.x, .y = b.y, .z = 0, .w = 1};
-  auto vectorC = *this * Vector{.x = c.x, .y = c.y, .z = 0, .w = 1};
-  auto vectorD = *this * Vector{.x = d.x, .y = d.y, .z = 0, .w = 1};
-
-  Point transformedA{.x = vectorA.x + center.x, .y = vectorA.y + center.y};
-  Point transformedB{.x = vectorB.x + center.x, .y = vectorB.y + center.y};
-  Point transformedC{.x = vectorC.x + center.x, .y = vectorC.y + center.y};
-  Point transformedD{.x = vectorD.x + center.x, .y = vectorD.y + center.y};
-
-  return Rect::boundingRect(
-      transformedA, transformedB, transformedC, transformedD);
+  return transformRectBounds(matrix, rect, center);
 }
 
 EdgeInsets operator*(const EdgeInsets& edgeInsets, const Transform& transform) {
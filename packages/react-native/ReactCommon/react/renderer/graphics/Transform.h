@@ -8,7 +8,7 @@
 #pragma once
 
 #include <array>
-#include <vector>
+#include <optional>
 
 #include <react/renderer/debug/flags.h>
 #include <react/renderer/graphics/Float.h>
@@ -19,6 +19,7 @@
 #include <react/renderer/graphics/Vector.h>
 #include <react/utils/hash_combine.h>
 
+#include <folly/container/small_vector.h>
 #include <folly/dynamic.h>
 
 namespace facebook::react {
@@ -68,11 +69,17 @@ struct TransformOrigin {
 #endif
 };
 
+/*
+ * Most transforms consist of a translation and/or a scale, so two operations
+ * are stored inline and such transforms don't allocate.
+ */
+using TransformOperations = folly::small_vector<TransformOperation, 2>;
+
 /*
  * Defines transform matrix to apply affine transformations.
  */
 struct Transform {
-  std::vector<TransformOperation> operations{};
+  TransformOperations operations{};
 
   std::array<Float, 16> matrix{{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}};
 
@@ -130,6 +137,12 @@ struct Transform {
   static Transform RotateZ(Float radians) noexcept;
   static Transform Rotate(Float angleX, Float angleY, Float angleZ) noexcept;
 
+  /*
+   * Returns the inverse of the given transform (as an `Arbitrary` one), or
+   * `std::nullopt` if it isn't invertible.
+   */
+  static std::optional<Transform> Inverse(const Transform &transform) noexcept;
+
   /**
    * Perform an interpolation between lhs and rhs, given progress.
    * This first decomposes the matrices into translation, scale, and rotation,
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TransformKernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64)
+#include <xmmintrin.h>
+#define RN_GRAPHICS_SSE 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RN_GRAPHICS_NEON 1
+#endif
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * `corners` and `bounds` hold `{minX, minY, maxX, maxY}`.
+ */
+template <typename T>
+struct PortableKernels {
+  static void multiply(const T* lhs, const T* rhs, T* result) noexcept {
+    T product[16];
+    for (int row = 0; row < 16; row += 4) {
+      for (int column = 0; column < 4; column++) {
+        product[row + column] = rhs[row] * lhs[column] +
+            rhs[row + 1] * lhs[4 + column] + rhs[row + 2] * lhs[8 + column] +
+            rhs[row + 3] * lhs[12 + column];
+      }
+    }
+    std::copy(product, product + 16, result);
+  }
+
+  static bool invert(const T* m, T* result) noexcept {
+    // Expansion by 2x2 minors of the top and bottom row pairs.
+    T b00 = m[0] * m[5] - m[1] * m[4];
+    T b01 = m[0] * m[6] - m[2] * m[4];
+    T b02 = m[0] * m[7] - m[3] * m[4];
+    T b03 = m[1] * m[6] - m[2] * m[5];
+    T b04 = m[1] * m[7] - m[3] * m[5];
+    T b05 = m[2] * m[7] - m[3] * m[6];
+    T b06 = m[8] * m[13] - m[9] * m[12];
+    T b07 = m[8] * m[14] - m[10] * m[12];
+    T b08 = m[8] * m[15] - m[11] * m[12];
+    T b09 = m[9] * m[14] - m[10] * m[13];
+    T b10 = m[9] * m[15] - m[11] * m[13];
+    T b11 = m[10] * m[15] - m[11] * m[14];
+
+    T determinant =
+        b00 * b11 - b01 * b10 + b02 * b09 + b03 * b08 - b04 * b07 + b05 * b06;
+    if (determinant == 0 || !std::isfinite(determinant)) {
+      return false;
+    }
+    T factor = 1 / determinant;
+
+    T inverse[16] = {
+        (m[5] * b11 - m[6] * b10 + m[7] * b09) * factor,
+        (m[2] * b10 - m[1] * b11 - m[3] * b09) * factor,
+        (m[13] * b05 - m[14] * b04 + m[15] * b03) * factor,
+        (m[10] * b04 - m[9] * b05 - m[11] * b03) * factor,
+        (m[6] * b08 - m[4] * b11 - m[7] * b07) * factor,
+        (m[0] * b11 - m[2] * b08 + m[3] * b07) * factor,
+        (m[14] * b02 - m[12] * b05 - m[15] * b01) * factor,
+        (m[8] * b05 - m[10] * b02 + m[11] * b01) * factor,
+        (m[4] * b10 - m[5] * b08 + m[7] * b06) * factor,
+        (m[1] * b08 - m[0] * b10 - m[3] * b06) * factor,
+        (m[12] * b04 - m[13] * b02 + m[15] * b00) * factor,
+        (m[9] * b02 - m[8] * b04 - m[11] * b00) * factor,
+        (m[5] * b07 - m[4] * b09 - m[6] * b06) * factor,
+        (m[0] * b09 - m[1] * b07 + m[2] * b06) * factor,
+        (m[13] * b01 - m[12] * b03 - m[14] * b00) * factor,
+        (m[8] * b03 - m[9] * b01 + m[10] * b00) * factor};
+    std::copy(inverse, inverse + 16, result);
+    return true;
+  }
+
+  static void
+  transformBounds(const T* m, const T* corners, T* bounds) noexcept {
+    const T xs[4] = {corners[0], corners[2], corners[2], corners[0]};
+    const T ys[4] = {corners[1], corners[1], corners[3], corners[3]};
+    T transformedXs[4];
+    T transformedYs[4];
+    for (int i = 0; i < 4; i++) {
+      transformedXs[i] = xs[i] * m[0] + ys[i] * m[4] + m[12];
+      transformedYs[i] = xs[i] * m[1] + ys[i] * m[5] + m[13];
+    }
+    bounds[0] = *std::min_element(transformedXs, transformedXs + 4);
+    bounds[1] = *std::min_element(transformedYs, transformedYs + 4);
+    bounds[2] = *std::max_element(transformedXs, transformedXs + 4);
+    bounds[3] = *std::max_element(transformedYs, transformedYs + 4);
+  }
+};
+
+template <typename T>
+struct Kernels : PortableKernels<T> {};
+
+#if defined(RN_GRAPHICS_SSE) || defined(RN_GRAPHICS_NEON)
+
+#ifdef RN_GRAPHICS_SSE
+
+using Float4 = __m128;
+
+inline Float4 load(const float* values) {
+  return _mm_loadu_ps(values);
+}
+
+inline void store(float* values, Float4 vector) {
+  _mm_storeu_ps(values, vector);
+}
+
+inline Float4 splat(float value) {
+  return _mm_set1_ps(value);
+}
+
+inline Float4 add(Float4 lhs, Float4 rhs) {
+  return _mm_add_ps(lhs, rhs);
+}
+
+inline Float4 mul(Float4 lhs, Float4 rhs) {
+  return _mm_mul_ps(lhs, rhs);
+}
+
+inline float horizontalMin(Float4 vector) {
+  vector = _mm_min_ps(
+      vector, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 0, 3, 2)));
+  vector = _mm_min_ps(
+      vector, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtss_f32(vector);
+}
+
+inline float horizontalMax(Float4 vector) {
+  vector = _mm_max_ps(
+      vector, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 0, 3, 2)));
+  vector = _mm_max_ps(
+      vector, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtss_f32(vector);
+}
+
+#else
+
+using Float4 = float32x4_t;
+
+inline Float4 load(const float* values) {
+  return vld1q_f32(values);
+}
+
+inline void store(float* values, Float4 vector) {
+  vst1q_f32(values, vector);
+}
+
+inline Float4 splat(float value) {
+  return vdupq_n_f32(value);
+}
+
+inline Float4 add(Float4 lhs, Float4 rhs) {
+  return vaddq_f32(lhs, rhs);
+}
+
+inline Float4 mul(Float4 lhs, Float4 rhs) {
+  return vmulq_f32(lhs, rhs);
+}
+
+inline float horizontalMin(Float4 vector) {
+  auto pair = vpmin_f32(vget_low_f32(vector), vget_high_f32(vector));
+  return vget_lane_f32(vpmin_f32(pair, pair), 0);
+}
+
+inline float horizontalMax(Float4 vector) {
+  auto pair = vpmax_f32(vget_low_f32(vector), vget_high_f32(vector));
+  return vget_lane_f32(vpmax_f32(pair, pair), 0);
+}
+
+#endif
+
+template <>
+struct Kernels<float> : PortableKernels<float> {
+  static void
+  multiply(const float* lhs, const float* rhs, float* result) noexcept {
+    // Each row of the result is a combination of the rows of `lhs`.
+    auto row0 = load(lhs);
+    auto row1 = load(lhs + 4);
+    auto row2 = load(lhs + 8);
+    auto row3 = load(lhs + 12);
+    for (int row = 0; row < 16; row += 4) {
+      auto product = add(
+          add(add(mul(splat(rhs[row]), row0), mul(splat(rhs[row + 1]), row1)),
+              mul(splat(rhs[row + 2]), row2)),
+          mul(splat(rhs[row + 3]), row3));
+      store(result + row, product);
+    }
+  }
+
+  static void transformBounds(
+      const float* m,
+      const float* corners,
+      float* bounds) noexcept {
+    const float xs[4] = {corners[0], corners[2], corners[2], corners[0]};
+    const float ys[4] = {corners[1], corners[1], corners[3], corners[3]};
+    auto x = load(xs);
+    auto y = load(ys);
+    auto transformedXs =
+        add(add(mul(x, splat(m[0])), mul(y, splat(m[4]))), splat(m[12]));
+    auto transformedYs =
+        add(add(mul(x, splat(m[1])), mul(y, splat(m[5]))), splat(m[13]));
+    bounds[0] = horizontalMin(transformedXs);
+    bounds[1] = horizontalMin(transformedYs);
+    bounds[2] = horizontalMax(transformedXs);
+    bounds[3] = horizontalMax(transformedYs);
+  }
+};
+
+#endif
+
+} // namespace
+
+void multiplyTransformMatrices(
+    const TransformMatrix& lhs,
+    const TransformMatrix& rhs,
+    TransformMatrix& result) noexcept {
+  Kernels<Float>::multiply(lhs.data(), rhs.data(), result.data());
+}
+
+bool invertTransformMatrix(
+    const TransformMatrix& matrix,
+    TransformMatrix& result) noexcept {
+  return Kernels<Float>::invert(matrix.data(), result.data());
+}
+
+Rect transformRectBounds(
+    const TransformMatrix& matrix,
+    const Rect& rect,
+    const Point& center) noexcept {
+  const Float corners[4] = {
+      rect.origin.x - center.x,
+      rect.origin.y - center.y,
+      rect.getMaxX() - center.x,
+      rect.getMaxY() - center.y};
+  Float bounds[4];
+
+  if (matrix[1] == 0 && matrix[4] == 0) {
+    // Scale and translation only: the corners stay axis-aligned.
+    auto x0 = corners[0] * matrix[0] + matrix[12];
+    auto x1 = corners[2] * matrix[0] + matrix[12];
+    auto y0 = corners[1] * matrix[5] + matrix[13];
+    auto y1 = corners[3] * matrix[5] + matrix[13];
+    bounds[0] = std::min(x0, x1);
+    bounds[1] = std::min(y0, y1);
+    bounds[2] = std::max(x0, x1);
+    bounds[3] = std::max(y0, y1);
+  } else {
+    Kernels<Float>::transformBounds(matrix.data(), corners, bounds);
+  }
+
+  auto minX = bounds[0] + center.x;
+  auto minY = bounds[1] + center.y;
+  return {
+      .origin = {.x = minX, .y = minY},
+      .size = {
+          .width = (bounds[2] + center.x) - minX,
+          .height = (bounds[3] + center.y) - minY}};
+}
+
+} // namespace facebook::react
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+
+#include <react/renderer/graphics/Float.h>
+#include <react/renderer/graphics/Point.h>
+#include <react/renderer/graphics/Rect.h>
+
+namespace facebook::react {
+
+/*
+ * Row-major 4x4 matrix, laid out as `Transform::matrix`.
+ */
+using TransformMatrix = std::array<Float, 16>;
+
+/*
+ * Kernels backing `Transform`. They use SSE or NEON when `Float` is `float`
+ * and the target supports it, and a portable implementation otherwise.
+ */
+
+/*
+ * Stores the concatenation of `lhs` and `rhs` (`lhs * rhs` in `Transform`
+ * terms) in `result`, which may alias either argument.
+ */
+void multiplyTransformMatrices(const TransformMatrix &lhs, const TransformMatrix &rhs, TransformMatrix &result) noexcept;
+
+/*
+ * Stores the inverse of `matrix` in `result`, which may alias `matrix`.
+ * Returns `false` (leaving `result` untouched) if `matrix` isn't invertible.
+ */
+bool invertTransformMatrix(const TransformMatrix &matrix, TransformMatrix &result) noexcept;
+
+/*
+ * Returns the bounding rect of the four corners of `rect` transformed around
+ * `center`, ignoring the `z` and `w` components.
+ */
+Rect transformRectBounds(const TransformMatrix &matrix, const Rect &rect, const Point &center) noexcept;
+
+} // namespace facebook::react
@@ -134,3 +134,80 @@ TEST(TransformTest, scalingAndTranslatingRect) {
   EXPECT_EQ(transformedRect.size.width, 150);
   EXPECT_EQ(transformedRect.size.height, 200);
 }
+
+TEST(TransformTest, multiplyingMatchesRowByRowProduct) {
+  auto lhs = Transform::Rotate(0.3, 0.2, 0.1) * Transform::Perspective(500);
+  auto rhs = Transform::Skew(0.4, 0.1) * Transform::Translate(10, 20, 30);
+
+  auto product = lhs * rhs;
+
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      Float expected = 0;
+      for (int k = 0; k < 4; k++) {
+        expected += rhs.at(i, k) * lhs.at(k, j);
+      }
+      ASSERT_NEAR(product.at(i, j), expected, 0.0001);
+    }
+  }
+}
+
+TEST(TransformTest, invertingTransform) {
+  auto transform = Transform::Translate(10, -20, 5) *
+      Transform::Rotate(0.3, 0.2, 0.1) * Transform::Scale(2, 0.5, 1);
+
+  auto inverse = Transform::Inverse(transform);
+  ASSERT_TRUE(inverse.has_value());
+  EXPECT_EQ(inverse->operations.size(), 1);
+  EXPECT_EQ(inverse->operations[0].type, TransformOperationType::Arbitrary);
+
+  auto identity = transform * *inverse;
+  for (int i = 0; i < 16; i++) {
+    ASSERT_NEAR(identity.matrix[i], Transform::Identity().matrix[i], 0.0001);
+  }
+
+  auto vector = Vector{.x = 30, .y = 40, .z = 50, .w = 1};
+  auto roundTrip = *inverse * (transform * vector);
+  ASSERT_NEAR(roundTrip.x, 30, 0.0001);
+  ASSERT_NEAR(roundTrip.y, 40, 0.0001);
+  ASSERT_NEAR(roundTrip.z, 50, 0.0001);
+
+  EXPECT_FALSE(Transform::Inverse(Transform::Scale(0, 1, 1)).has_value());
+}
+
+TEST(TransformTest, transformingRectMatchesCorners) {
+  auto rect = facebook::react::Rect{{100, 200}, {300, 400}};
+  auto center = facebook::react::Point{50, 60};
+  auto transform = Transform::Skew(0.2, -0.4) * Transform::RotateZ(1) *
+      Transform::Translate(-7, 9, 0);
+
+  auto transformCorner = [&](Float x, Float y) {
+    auto vector = transform *
+        Vector{.x = x - center.x, .y = y - center.y, .z = 0, .w = 1};
+    return facebook::react::Point{
+        .x = vector.x + center.x, .y = vector.y + center.y};
+  };
+  auto expectedRect = Rect::boundingRect(
+      transformCorner(rect.getMinX(), rect.getMinY()),
+      transformCorner(rect.getMaxX(), rect.getMinY()),
+      transformCorner(rect.getMaxX(), rect.getMaxY()),
+      transformCorner(rect.getMinX(), rect.getMaxY()));
+
+  auto transformedRect = transform.applyWithCenter(rect, center);
+
+  ASSERT_NEAR(transformedRect.origin.x, expectedRect.origin.x, 0.001);
+  ASSERT_NEAR(transformedRect.origin.y, expectedRect.origin.y, 0.001);
+  ASSERT_NEAR(transformedRect.size.width, expectedRect.size.width, 0.001);
+  ASSERT_NEAR(transformedRect.size.height, expectedRect.size.height, 0.001);
+}
+
+TEST(TransformTest, mirroringRect) {
+  auto rect = facebook::react::Rect{{100, 200}, {300, 400}};
+
+  auto transformedRect = rect * Transform::Scale(-2, -1, 1);
+
+  EXPECT_EQ(transformedRect.origin.x, -50);
+  EXPECT_EQ(transformedRect.origin.y, 200);
+  EXPECT_EQ(transformedRect.size.width, 600);
+  EXPECT_EQ(transformedRect.size.height, 400);
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/graphics/Transform.h>
+
+namespace facebook::react {
+
+auto rotation = Transform::Rotate(0.3, 0.2, 0.1);
+auto perspective = Transform::Perspective(500) * Transform::RotateY(0.4);
+auto scaleAndTranslation =
+    Transform::Scale(2, 2, 1) * Transform::Translate(10, 20, 0);
+auto rect =
+    Rect{.origin = {.x = 10, .y = 20}, .size = {.width = 300, .height = 400}};
+
+static void transformMultiplication(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rotation * perspective);
+  }
+}
+BENCHMARK(transformMultiplication);
+
+static void transformInversion(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Transform::Inverse(perspective));
+  }
+}
+BENCHMARK(transformInversion);
+
+static void rectTransformation(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect * rotation);
+  }
+}
+BENCHMARK(rectTransformation);
+
+static void rectScalingAndTranslation(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect * scaleAndTranslation);
+  }
+}
+BENCHMARK(rectScalingAndTranslation);
+
+static void scaleAndTranslationCopy(benchmark::State& state) {
+  for (auto _ : state) {
+    auto transform = scaleAndTranslation;
+    benchmark::DoNotOptimize(transform);
+  }
+}
+BENCHMARK(scaleAndTranslationCopy);
+
+static void transformInterpolation(benchmark::State& state) {
+  auto size = Size{.width = 300, .height = 400};
+  auto from = Transform::Translate(0, 0, 0) * Transform::Scale(1, 1, 1) *
+      Transform::RotateZ(0);
+  auto to = Transform::Translate(100, 50, 0) * Transform::Scale(2, 2, 1) *
+      Transform::RotateZ(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Transform::Interpolate(0.5, from, to, size));
+  }
+}
+BENCHMARK(transformInterpolation);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -126,7 +126,10 @@ class MapBuffer {
 
   std::string getString(MapBuffer::Key key) const;
 
-  // TODO T83483191: review this declaration
+  /*
+   * Returns a copy of the nested map. Use `MapBufferView` to read nested maps
+   * and strings without copying them.
+   */
   MapBuffer getMapBuffer(MapBuffer::Key key) const;
 
   std::vector<MapBuffer> getMapBufferList(MapBuffer::Key key) const;
@@ -144,13 +147,6 @@ class MapBuffer {
   // amount of items in the MapBuffer
   uint16_t count_ = 0;
 
-  // returns the relative offset of the first byte of dynamic data
-  int32_t getDynamicDataOffset() const;
-
-  int32_t getKeyBucket(MapBuffer::Key key) const;
-
-  inline int32_t getIntAtBucket(int32_t bucketIndex) const;
-
   friend JReadableMapBuffer;
 };
 
@@ -83,7 +83,7 @@ void MapBufferBuilder::putLong(MapBuffer::Key key, int64_t value) {
       LONG_SIZE);
 }
 
-void MapBufferBuilder::putString(MapBuffer::Key key, const std::string& value) {
+void MapBufferBuilder::putString(MapBuffer::Key key, std::string_view value) {
   // The wire format encodes lengths and offsets as int32_t (see
   // MapBuffer::getString). Without an explicit narrowing cast, `auto` deduces
   // size_t (8 bytes on 64-bit) and `memcpy(&x, ..., INT_SIZE)` then copies only
@@ -106,7 +106,7 @@ void MapBufferBuilder::putString(MapBuffer::Key key, const std::string& value) {
       INT_SIZE);
 }
 
-void MapBufferBuilder::putMapBuffer(MapBuffer::Key key, const MapBuffer& map) {
+void MapBufferBuilder::putMapBuffer(MapBuffer::Key key, MapBufferView map) {
   // Wire format encodes lengths and offsets as int32_t (see
   // MapBuffer::getMapBuffer). Cast explicitly so memcpy(&x, ..., INT_SIZE)
   // copies the full value, not the first 4 bytes of an 8-byte size_t.
@@ -118,7 +118,9 @@ void MapBufferBuilder::putMapBuffer(MapBuffer::Key key, const MapBuffer& map) {
   dynamicData_.resize(offset + INT_SIZE + mapBufferSize, 0);
   memcpy(dynamicData_.data() + offset, &mapBufferSize, INT_SIZE);
   // Copy the content of the map into dynamicData_
-  memcpy(dynamicData_.data() + offset + INT_SIZE, map.data(), mapBufferSize);
+  if (mapBufferSize > 0) {
+    memcpy(dynamicData_.data() + offset + INT_SIZE, map.data(), mapBufferSize);
+  }
 
   // Store Key and pointer to the string
   storeKeyValue(
@@ -128,6 +130,25 @@ void MapBufferBuilder::putMapBuffer(MapBuffer::Key key, const MapBuffer& map) {
       INT_SIZE);
 }
 
+void MapBufferBuilder::putMapBuffer(
+    MapBuffer::Key key,
+    MapBufferBuilder&& builder) {
+  auto mapBufferSize = static_cast<int32_t>(builder.getBufferSize());
+
+  auto offset = static_cast<int32_t>(dynamicData_.size());
+
+  // format [length of buffer (int)] + [bytes of MapBuffer]
+  dynamicData_.resize(offset + INT_SIZE + mapBufferSize, 0);
+  memcpy(dynamicData_.data() + offset, &mapBufferSize, INT_SIZE);
+  builder.buildInto(dynamicData_.data() + offset + INT_SIZE);
+
+  storeKeyValue(
+      key,
+      MapBuffer::DataType::Map,
+      reinterpret_cast<const uint8_t*>(&offset),
+      INT_SIZE);
+}
+
 void MapBufferBuilder::putMapBufferList(
     MapBuffer::Key key,
     const std::vector<MapBuffer>& mapBufferList) {
@@ -167,28 +188,44 @@ static inline bool compareBuckets(
   return a.key < b.key;
 }
 
-MapBuffer MapBufferBuilder::build() {
+size_t MapBufferBuilder::getBufferSize() const {
+  return sizeof(MapBuffer::Header) +
+      buckets_.size() * sizeof(MapBuffer::Bucket) + dynamicData_.size();
+}
+
+void MapBufferBuilder::buildInto(uint8_t* destination) {
   // Create buffer: [header] + [key, values] + [dynamic data]
   auto bucketSize = buckets_.size() * sizeof(MapBuffer::Bucket);
   auto headerSize = sizeof(MapBuffer::Header);
-  auto bufferSize = headerSize + bucketSize + dynamicData_.size();
 
-  header_.bufferSize = static_cast<uint32_t>(bufferSize);
+  header_.bufferSize = static_cast<uint32_t>(getBufferSize());
 
   if (needsSort_) {
     std::sort(buckets_.begin(), buckets_.end(), compareBuckets);
+    needsSort_ = false;
   }
 
   // TODO(T83483191): add pass to check for duplicates
 
-  std::vector<uint8_t> buffer(bufferSize);
-  memcpy(buffer.data(), &header_, headerSize);
-  memcpy(buffer.data() + headerSize, buckets_.data(), bucketSize);
-  memcpy(
-      buffer.data() + headerSize + bucketSize,
-      dynamicData_.data(),
-      dynamicData_.size());
+  memcpy(destination, &header_, headerSize);
+  memcpy(destination + headerSize, buckets_.data(), bucketSize);
+  if (!dynamicData_.empty()) {
+    memcpy(
+        destination + headerSize + bucketSize,
+        dynamicData_.data(),
+        dynamicData_.size());
+  }
+}
 
+MapBufferView MapBufferBuilder::buildInto(std::vector<uint8_t>& buffer) {
+  buffer.resize(getBufferSize());
+  buildInto(buffer.data());
+  return {buffer.data(), buffer.size()};
+}
+
+MapBuffer MapBufferBuilder::build() {
+  std::vector<uint8_t> buffer(getBufferSize());
+  buildInto(buffer.data());
   return MapBuffer(std::move(buffer));
 }
 
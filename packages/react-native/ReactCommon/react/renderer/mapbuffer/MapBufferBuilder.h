@@ -8,8 +8,10 @@
 #pragma once
 
 #include <react/debug/react_native_assert.h>
+#include <string_view>
 #include <vector>
 #include "MapBuffer.h"
+#include "MapBufferView.h"
 
 namespace facebook::react {
 
@@ -33,12 +35,35 @@ class MapBufferBuilder {
 
   void putDouble(MapBuffer::Key key, double value);
 
-  void putString(MapBuffer::Key key, const std::string &value);
+  void putString(MapBuffer::Key key, std::string_view value);
 
-  void putMapBuffer(MapBuffer::Key key, const MapBuffer &map);
+  void putMapBuffer(MapBuffer::Key key, MapBufferView map);
+
+  /*
+   * Serializes the nested builder straight into this one, without building an
+   * intermediate MapBuffer for it.
+   */
+  void putMapBuffer(MapBuffer::Key key, MapBufferBuilder &&builder);
 
   void putMapBufferList(MapBuffer::Key key, const std::vector<MapBuffer> &mapBufferList);
 
+  /*
+   * Returns the number of bytes `build` and `buildInto` produce.
+   */
+  size_t getBufferSize() const;
+
+  /*
+   * Serializes the map into caller-provided memory of at least
+   * `getBufferSize()` bytes (e.g. a direct ByteBuffer or an arena).
+   */
+  void buildInto(uint8_t *destination);
+
+  /*
+   * Serializes the map into `buffer`, reusing its capacity, and returns a view
+   * of it. The view is valid as long as `buffer` isn't modified.
+   */
+  MapBufferView buildInto(std::vector<uint8_t> &buffer);
+
   MapBuffer build();
 
  private:
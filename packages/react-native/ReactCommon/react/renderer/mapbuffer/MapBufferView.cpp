@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "MapBufferView.h"
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+
+#include <cstring>
+
+namespace facebook::react {
+
+static inline int32_t bucketOffset(int32_t index) {
+  return sizeof(MapBuffer::Header) + sizeof(MapBuffer::Bucket) * index;
+}
+
+static inline int32_t valueOffset(int32_t bucketIndex) {
+  return bucketOffset(bucketIndex) + offsetof(MapBuffer::Bucket, data);
+}
+
+template <typename T>
+static inline T readValue(const uint8_t* data) {
+  T value;
+  memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+MapBufferView::MapBufferView(const uint8_t* data, size_t size)
+    : data_(data), size_(size) {
+  auto header = readValue<MapBuffer::Header>(data_);
+  count_ = header.count;
+
+  if (header.bufferSize != size_) {
+    LOG(ERROR) << "Error: Data size does not match, expected "
+               << header.bufferSize << " found: " << size_;
+    abort();
+  }
+}
+
+MapBufferView::MapBufferView(const MapBuffer& mapBuffer)
+    : data_(mapBuffer.data()),
+      size_(mapBuffer.size()),
+      count_(mapBuffer.count()) {}
+
+int32_t MapBufferView::getKeyBucket(MapBuffer::Key key) const {
+  int32_t lo = 0;
+  int32_t hi = count_ - 1;
+  while (lo <= hi) {
+    int32_t mid = (lo + hi) >> 1;
+
+    auto midVal = readValue<MapBuffer::Key>(data_ + bucketOffset(mid));
+
+    if (midVal < key) {
+      lo = mid + 1;
+    } else if (midVal > key) {
+      hi = mid - 1;
+    } else {
+      return mid;
+    }
+  }
+
+  return -1;
+}
+
+int32_t MapBufferView::getIntAtBucket(int32_t bucketIndex) const {
+  return readValue<int32_t>(data_ + valueOffset(bucketIndex));
+}
+
+int32_t MapBufferView::getDynamicDataOffset() const {
+  // The start of dynamic data can be calculated as the offset of the next
+  // key in the map
+  return bucketOffset(count_);
+}
+
+int32_t MapBufferView::getInt(MapBuffer::Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+  if (bucketIndex == -1) {
+    return 0;
+  }
+
+  return getIntAtBucket(bucketIndex);
+}
+
+int64_t MapBufferView::getLong(MapBuffer::Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+  if (bucketIndex == -1) {
+    return 0;
+  }
+
+  return readValue<int64_t>(data_ + valueOffset(bucketIndex));
+}
+
+bool MapBufferView::getBool(MapBuffer::Key key) const {
+  return getInt(key) != 0;
+}
+
+double MapBufferView::getDouble(MapBuffer::Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+  if (bucketIndex == -1) {
+    return 0;
+  }
+
+  return readValue<double>(data_ + valueOffset(bucketIndex));
+}
+
+std::string_view MapBufferView::getString(MapBuffer::Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+  if (bucketIndex == -1) {
+    return {};
+  }
+
+  int32_t offset = getDynamicDataOffset() + getIntAtBucket(bucketIndex);
+  auto stringLength = readValue<int32_t>(data_ + offset);
+  const auto* stringPtr =
+      reinterpret_cast<const char*>(data_ + offset + sizeof(int32_t));
+
+  return {stringPtr, static_cast<size_t>(stringLength)};
+}
+
+MapBufferView MapBufferView::getMapBuffer(MapBuffer::Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+  if (bucketIndex == -1) {
+    return {};
+  }
+
+  int32_t offset = getDynamicDataOffset() + getIntAtBucket(bucketIndex);
+  auto mapBufferLength =
+      static_cast<size_t>(readValue<int32_t>(data_ + offset));
+  size_t maxLength = size_ - offset - sizeof(int32_t);
+  if (mapBufferLength > maxLength) {
+    mapBufferLength = maxLength;
+  }
+
+  return {data_ + offset + sizeof(int32_t), mapBufferLength};
+}
+
+std::vector<MapBufferView> MapBufferView::getMapBufferList(
+    MapBuffer::Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+  if (bucketIndex == -1) {
+    return {};
+  }
+
+  std::vector<MapBufferView> mapBufferList;
+  int32_t offset = getDynamicDataOffset() + getIntAtBucket(bucketIndex);
+  auto mapBufferListLength = readValue<int32_t>(data_ + offset);
+  offset = offset + sizeof(uint32_t);
+
+  int32_t curLen = 0;
+  while (curLen < mapBufferListLength) {
+    auto mapBufferLength = readValue<int32_t>(data_ + offset + curLen);
+    curLen = curLen + sizeof(uint32_t);
+    mapBufferList.emplace_back(
+        data_ + offset + curLen, static_cast<size_t>(mapBufferLength));
+    curLen = curLen + mapBufferLength;
+  }
+  return mapBufferList;
+}
+
+MapBuffer MapBufferView::toMapBuffer() const {
+  if (data_ == nullptr) {
+    return MapBufferBuilder::EMPTY();
+  }
+  return MapBuffer(std::vector<uint8_t>(data_, data_ + size_));
+}
+
+size_t MapBufferView::size() const {
+  return size_;
+}
+
+const uint8_t* MapBufferView::data() const {
+  return data_;
+}
+
+uint16_t MapBufferView::count() const {
+  return count_;
+}
+
+} // namespace facebook::react
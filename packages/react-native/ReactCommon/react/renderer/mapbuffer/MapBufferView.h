@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/mapbuffer/MapBuffer.h>
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace facebook::react {
+
+/**
+ * Non-owning, read-only view of a serialized MapBuffer (see MapBuffer.h for
+ * the layout).
+ *
+ * Nested maps and strings are returned as views into the same memory, so
+ * reading a deeply nested value doesn't copy anything. The view must not
+ * outlive the buffer it refers to.
+ */
+class MapBufferView {
+ public:
+  MapBufferView() = default;
+
+  MapBufferView(const uint8_t *data, size_t size);
+
+  /* implicit */ MapBufferView(const MapBuffer &mapBuffer);
+
+  int32_t getInt(MapBuffer::Key key) const;
+
+  int64_t getLong(MapBuffer::Key key) const;
+
+  bool getBool(MapBuffer::Key key) const;
+
+  double getDouble(MapBuffer::Key key) const;
+
+  std::string_view getString(MapBuffer::Key key) const;
+
+  MapBufferView getMapBuffer(MapBuffer::Key key) const;
+
+  std::vector<MapBufferView> getMapBufferList(MapBuffer::Key key) const;
+
+  /*
+   * Copies the viewed bytes into a new owning MapBuffer.
+   */
+  MapBuffer toMapBuffer() const;
+
+  size_t size() const;
+
+  const uint8_t *data() const;
+
+  uint16_t count() const;
+
+ private:
+  const uint8_t *data_{nullptr};
+
+  size_t size_{0};
+
+  uint16_t count_{0};
+
+  // returns the relative offset of the first byte of dynamic data
+  int32_t getDynamicDataOffset() const;
+
+  int32_t getKeyBucket(MapBuffer::Key key) const;
+
+  int32_t getIntAtBucket(int32_t bucketIndex) const;
+};
+
+} // namespace facebook::react
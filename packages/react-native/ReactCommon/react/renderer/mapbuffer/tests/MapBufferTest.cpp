@@ -12,6 +12,7 @@
 #include <gtest/gtest.h>
 #include <react/renderer/mapbuffer/MapBuffer.h>
 #include <react/renderer/mapbuffer/MapBufferBuilder.h>
+#include <react/renderer/mapbuffer/MapBufferView.h>
 
 using namespace facebook::react;
 
@@ -219,3 +220,110 @@ TEST(MapBufferTest, testMapRandomAccess) {
   EXPECT_EQ(map.getInt(1234), 4321);
   EXPECT_EQ(map.getString(65535), "Let's count: 的, 一, 是");
 }
+
+TEST(MapBufferTest, testMapBufferViewReadsWithoutCopying) {
+  auto innerBuilder = MapBufferBuilder();
+  innerBuilder.putString(0, "This is a test");
+  innerBuilder.putDouble(1, 908.1);
+
+  auto builder = MapBufferBuilder();
+  builder.putInt(0, 1234);
+  builder.putMapBuffer(1, innerBuilder.build());
+  builder.putString(2, "Let's count: 的, 一, 是");
+  auto map = builder.build();
+
+  auto view = MapBufferView(map);
+  EXPECT_EQ(view.count(), 3);
+  EXPECT_EQ(view.getInt(0), 1234);
+  EXPECT_EQ(view.getString(2), "Let's count: 的, 一, 是");
+
+  auto innerView = view.getMapBuffer(1);
+  EXPECT_EQ(innerView.count(), 2);
+  EXPECT_EQ(innerView.getString(0), "This is a test");
+  EXPECT_EQ(innerView.getDouble(1), 908.1);
+
+  // Nested maps and strings point into the original buffer.
+  auto begin = reinterpret_cast<const char*>(map.data());
+  auto end = begin + map.size();
+  EXPECT_GE(reinterpret_cast<const char*>(innerView.data()), begin);
+  EXPECT_LE(reinterpret_cast<const char*>(innerView.data()), end);
+  EXPECT_GE(innerView.getString(0).data(), begin);
+  EXPECT_LE(innerView.getString(0).data(), end);
+
+  auto innerMap = innerView.toMapBuffer();
+  EXPECT_EQ(innerMap.getString(0), "This is a test");
+}
+
+TEST(MapBufferTest, testMapBufferViewListEntries) {
+  std::vector<MapBuffer> mapBufferList;
+  auto builder = MapBufferBuilder();
+  builder.putString(0, "This is a test");
+  mapBufferList.push_back(builder.build());
+
+  auto builder2 = MapBufferBuilder();
+  builder2.putInt(2, 4321);
+  mapBufferList.push_back(builder2.build());
+
+  auto builder3 = MapBufferBuilder();
+  builder3.putMapBufferList(5, mapBufferList);
+  auto map = builder3.build();
+
+  auto views = MapBufferView(map).getMapBufferList(5);
+
+  ASSERT_EQ(views.size(), 2);
+  EXPECT_EQ(views[0].getString(0), "This is a test");
+  EXPECT_EQ(views[1].getInt(2), 4321);
+}
+
+TEST(MapBufferTest, testNestedBuilderMatchesNestedMapBuffer) {
+  auto createInnerBuilder = []() {
+    auto builder = MapBufferBuilder();
+    builder.putString(3, "This is a test");
+    builder.putInt(1, 1234);
+    return builder;
+  };
+
+  auto copyingBuilder = MapBufferBuilder();
+  copyingBuilder.putMapBuffer(1, createInnerBuilder().build());
+  copyingBuilder.putInt(0, 4321);
+  auto copyingMap = copyingBuilder.build();
+
+  auto nestingBuilder = MapBufferBuilder();
+  nestingBuilder.putMapBuffer(1, createInnerBuilder());
+  nestingBuilder.putInt(0, 4321);
+  auto nestingMap = nestingBuilder.build();
+
+  ASSERT_EQ(nestingMap.size(), copyingMap.size());
+  EXPECT_EQ(
+      std::vector<uint8_t>(
+          nestingMap.data(), nestingMap.data() + nestingMap.size()),
+      std::vector<uint8_t>(
+          copyingMap.data(), copyingMap.data() + copyingMap.size()));
+
+  auto innerMap = nestingMap.getMapBuffer(1);
+  EXPECT_EQ(innerMap.getString(3), "This is a test");
+  EXPECT_EQ(innerMap.getInt(1), 1234);
+}
+
+TEST(MapBufferTest, testBuildIntoCallerProvidedBuffer) {
+  auto builder = MapBufferBuilder();
+  builder.putInt(1, 1234);
+  builder.putString(0, "This is a test");
+
+  auto buffer = std::vector<uint8_t>(builder.getBufferSize() + 4, 0xAB);
+  builder.buildInto(buffer.data() + 4);
+
+  auto view = MapBufferView(buffer.data() + 4, builder.getBufferSize());
+  EXPECT_EQ(view.count(), 2);
+  EXPECT_EQ(view.getString(0), "This is a test");
+  EXPECT_EQ(view.getInt(1), 1234);
+  EXPECT_EQ(buffer[0], 0xAB);
+
+  // The arena keeps its capacity between uses.
+  auto arena = std::vector<uint8_t>();
+  arena.reserve(1024);
+  auto arenaData = arena.data();
+  auto arenaView = builder.buildInto(arena);
+  EXPECT_EQ(arena.data(), arenaData);
+  EXPECT_EQ(arenaView.getString(0), "This is a test");
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/attributedstring/AttributedString.h>
+#include <react/renderer/attributedstring/ParagraphAttributes.h>
+#include <react/renderer/attributedstring/conversions.h>
+#include <react/renderer/mapbuffer/MapBuffer.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+#include <react/renderer/mapbuffer/MapBufferView.h>
+#include <string>
+#include <vector>
+
+// The payloads are produced by the Android-only (`RN_SERIALIZABLE_STATE`)
+// MapBuffer conversions of attributed strings and paragraph attributes.
+
+namespace facebook::react {
+
+namespace {
+
+constexpr MapBuffer::Key kAttributedStringKey = 0;
+constexpr MapBuffer::Key kParagraphAttributesKey = 1;
+
+/*
+ * A paragraph with a few differently styled fragments, which is what a
+ * typical `<Text>` with nested `<Text>` children sends to Android.
+ */
+AttributedString createAttributedString(int64_t fragmentCount) {
+  auto attributedString = AttributedString{};
+  auto baseTextAttributes = TextAttributes::defaultTextAttributes();
+  baseTextAttributes.fontFamily = "Roboto";
+  attributedString.setBaseTextAttributes(baseTextAttributes);
+
+  for (int64_t i = 0; i < fragmentCount; i++) {
+    auto fragment = AttributedString::Fragment{};
+    fragment.string = "Lorem ipsum dolor sit amet, consectetur adipiscing " +
+        std::to_string(i);
+    fragment.textAttributes = baseTextAttributes;
+    fragment.textAttributes.fontSize = static_cast<Float>(14 + i % 3);
+    fragment.textAttributes.foregroundColor =
+        colorFromRGBA(static_cast<uint8_t>(i * 10), 0, 0, 255);
+    fragment.textAttributes.fontWeight =
+        i % 2 == 0 ? FontWeight::Bold : FontWeight::Regular;
+    fragment.textAttributes.fontVariant = FontVariant::TabularNums;
+    attributedString.appendFragment(std::move(fragment));
+  }
+
+  return attributedString;
+}
+
+ParagraphAttributes createParagraphAttributes() {
+  auto paragraphAttributes = ParagraphAttributes{};
+  paragraphAttributes.maximumNumberOfLines = 3;
+  paragraphAttributes.ellipsizeMode = EllipsizeMode::Tail;
+  return paragraphAttributes;
+}
+
+/*
+ * How payloads used to be serialized: every nested map is built into its own
+ * buffer first and then copied into its parent.
+ */
+MapBuffer toCopyingMapBuffer(const AttributedString& attributedString) {
+  auto fragmentsBuilder = MapBufferBuilder();
+  int index = 0;
+  for (const auto& fragment : attributedString.getFragments()) {
+    auto fragmentBuilder = MapBufferBuilder();
+    fragmentBuilder.putString(FR_KEY_STRING, fragment.string);
+    fragmentBuilder.putMapBuffer(
+        FR_KEY_TEXT_ATTRIBUTES, toMapBuffer(fragment.textAttributes));
+    fragmentsBuilder.putMapBuffer(index++, fragmentBuilder.build());
+  }
+
+  auto builder = MapBufferBuilder();
+  builder.putString(AS_KEY_STRING, attributedString.getString());
+  builder.putMapBuffer(
+      AS_KEY_BASE_ATTRIBUTES,
+      toMapBuffer(attributedString.getBaseTextAttributes()));
+  builder.putMapBuffer(AS_KEY_FRAGMENTS, fragmentsBuilder.build());
+  return builder.build();
+}
+
+void serializeParagraphWithCopies(benchmark::State& state) {
+  auto attributedString = createAttributedString(state.range(0));
+  auto paragraphAttributes = createParagraphAttributes();
+
+  for (auto _ : state) {
+    auto builder = MapBufferBuilder();
+    builder.putMapBuffer(
+        kAttributedStringKey, toCopyingMapBuffer(attributedString));
+    builder.putMapBuffer(
+        kParagraphAttributesKey, toMapBuffer(paragraphAttributes));
+    benchmark::DoNotOptimize(builder.build());
+  }
+}
+BENCHMARK(serializeParagraphWithCopies)->Arg(1)->Arg(8)->Arg(64);
+
+void serializeParagraphWithNestedBuilders(benchmark::State& state) {
+  auto attributedString = createAttributedString(state.range(0));
+  auto paragraphAttributes = createParagraphAttributes();
+
+  for (auto _ : state) {
+    auto builder = MapBufferBuilder();
+    builder.putMapBuffer(
+        kAttributedStringKey, toMapBufferBuilder(attributedString));
+    builder.putMapBuffer(
+        kParagraphAttributesKey, toMapBufferBuilder(paragraphAttributes));
+    benchmark::DoNotOptimize(builder.build());
+  }
+}
+BENCHMARK(serializeParagraphWithNestedBuilders)->Arg(1)->Arg(8)->Arg(64);
+
+void serializeParagraphIntoArena(benchmark::State& state) {
+  auto attributedString = createAttributedString(state.range(0));
+  auto paragraphAttributes = createParagraphAttributes();
+  auto arena = std::vector<uint8_t>{};
+
+  for (auto _ : state) {
+    auto builder = MapBufferBuilder();
+    builder.putMapBuffer(
+        kAttributedStringKey, toMapBufferBuilder(attributedString));
+    builder.putMapBuffer(
+        kParagraphAttributesKey, toMapBufferBuilder(paragraphAttributes));
+    benchmark::DoNotOptimize(builder.buildInto(arena).data());
+  }
+}
+BENCHMARK(serializeParagraphIntoArena)->Arg(1)->Arg(8)->Arg(64);
+
+/*
+ * Reads every fragment string and font size, as the text measurement code
+ * does.
+ */
+void readParagraphWithCopies(benchmark::State& state) {
+  auto map = toMapBuffer(createAttributedString(state.range(0)));
+
+  for (auto _ : state) {
+    auto fragments = map.getMapBuffer(AS_KEY_FRAGMENTS);
+    for (uint16_t i = 0; i < fragments.count(); i++) {
+      auto fragment = fragments.getMapBuffer(i);
+      benchmark::DoNotOptimize(fragment.getString(FR_KEY_STRING));
+      benchmark::DoNotOptimize(fragment.getMapBuffer(FR_KEY_TEXT_ATTRIBUTES)
+                                   .getDouble(TA_KEY_FONT_SIZE));
+    }
+  }
+}
+BENCHMARK(readParagraphWithCopies)->Arg(1)->Arg(8)->Arg(64);
+
+void readParagraphWithViews(benchmark::State& state) {
+  auto map = toMapBuffer(createAttributedString(state.range(0)));
+
+  for (auto _ : state) {
+    auto fragments = MapBufferView(map).getMapBuffer(AS_KEY_FRAGMENTS);
+    for (uint16_t i = 0; i < fragments.count(); i++) {
+      auto fragment = fragments.getMapBuffer(i);
+      benchmark::DoNotOptimize(fragment.getString(FR_KEY_STRING));
+      benchmark::DoNotOptimize(fragment.getMapBuffer(FR_KEY_TEXT_ATTRIBUTES)
+                                   .getDouble(TA_KEY_FONT_SIZE));
+    }
+  }
+}
+BENCHMARK(readParagraphWithViews)->Arg(1)->Arg(8)->Arg(64);
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
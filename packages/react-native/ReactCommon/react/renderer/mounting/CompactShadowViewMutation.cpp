@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "CompactShadowViewMutation.h"
+
+#include <react/debug/react_native_assert.h>
+
+#include <utility>
+
+namespace facebook::react {
+
+#pragma mark - ShadowViewTable
+
+ShadowViewTable::Index ShadowViewTable::add(const ShadowView& shadowView) {
+  if (!shadowViews_.empty()) {
+    const auto& lastShadowView = shadowViews_.back();
+    if (lastShadowView.tag == shadowView.tag &&
+        lastShadowView.componentHandle == shadowView.componentHandle &&
+        lastShadowView.traits.get() == shadowView.traits.get() &&
+        lastShadowView == shadowView) {
+      return static_cast<Index>(shadowViews_.size() - 1);
+    }
+  }
+
+  react_native_assert(shadowViews_.size() < NoShadowView);
+  shadowViews_.push_back(shadowView);
+  return static_cast<Index>(shadowViews_.size() - 1);
+}
+
+const ShadowView& ShadowViewTable::at(Index index) const {
+  static const auto emptyShadowView = ShadowView{};
+  return index == NoShadowView ? emptyShadowView : shadowViews_[index];
+}
+
+size_t ShadowViewTable::size() const {
+  return shadowViews_.size();
+}
+
+void ShadowViewTable::reserve(size_t size) {
+  shadowViews_.reserve(size);
+}
+
+#pragma mark - CompactShadowViewMutation
+
+CompactShadowViewMutation CompactShadowViewMutation::CreateMutation(
+    ShadowViewTable& shadowViews,
+    const ShadowView& shadowView) {
+  return {
+      .type = ShadowViewMutation::Create,
+      .newChildShadowView = shadowViews.add(shadowView),
+  };
+}
+
+CompactShadowViewMutation CompactShadowViewMutation::DeleteMutation(
+    ShadowViewTable& shadowViews,
+    const ShadowView& shadowView) {
+  return {
+      .type = ShadowViewMutation::Delete,
+      .oldChildShadowView = shadowViews.add(shadowView),
+  };
+}
+
+CompactShadowViewMutation CompactShadowViewMutation::InsertMutation(
+    ShadowViewTable& shadowViews,
+    Tag parentTag,
+    const ShadowView& childShadowView,
+    int index) {
+  return {
+      .type = ShadowViewMutation::Insert,
+      .parentTag = parentTag,
+      .newChildShadowView = shadowViews.add(childShadowView),
+      .index = index,
+  };
+}
+
+CompactShadowViewMutation CompactShadowViewMutation::RemoveMutation(
+    ShadowViewTable& shadowViews,
+    Tag parentTag,
+    const ShadowView& childShadowView,
+    int index) {
+  return {
+      .type = ShadowViewMutation::Remove,
+      .parentTag = parentTag,
+      .oldChildShadowView = shadowViews.add(childShadowView),
+      .index = index,
+  };
+}
+
+CompactShadowViewMutation CompactShadowViewMutation::UpdateMutation(
+    ShadowViewTable& shadowViews,
+    const ShadowView& oldChildShadowView,
+    const ShadowView& newChildShadowView,
+    Tag parentTag) {
+  auto oldIndex = shadowViews.add(oldChildShadowView);
+  auto newIndex = shadowViews.add(newChildShadowView);
+  return {
+      .type = ShadowViewMutation::Update,
+      .parentTag = parentTag,
+      .oldChildShadowView = oldIndex,
+      .newChildShadowView = newIndex,
+  };
+}
+
+#pragma mark - CompactShadowViewMutationList
+
+const ShadowView& CompactShadowViewMutationList::oldChildShadowView(
+    const CompactShadowViewMutation& mutation) const {
+  return shadowViews.at(mutation.oldChildShadowView);
+}
+
+const ShadowView& CompactShadowViewMutationList::newChildShadowView(
+    const CompactShadowViewMutation& mutation) const {
+  return shadowViews.at(mutation.newChildShadowView);
+}
+
+ShadowViewMutation::List
+CompactShadowViewMutationList::toShadowViewMutationList() && {
+  auto& table = shadowViews.shadowViews_;
+
+  // Number of mutations which still have to receive each view; the last one
+  // takes the view out of the table.
+  auto remainingUses = std::vector<uint32_t>(table.size(), 0);
+  for (const auto& mutation : mutations) {
+    if (mutation.oldChildShadowView != ShadowViewTable::NoShadowView) {
+      remainingUses[mutation.oldChildShadowView]++;
+    }
+    if (mutation.newChildShadowView != ShadowViewTable::NoShadowView) {
+      remainingUses[mutation.newChildShadowView]++;
+    }
+  }
+
+  auto takeShadowView = [&](ShadowViewTable::Index index) -> ShadowView {
+    if (index == ShadowViewTable::NoShadowView) {
+      return {};
+    }
+    if (--remainingUses[index] == 0) {
+      return std::move(table[index]);
+    }
+    return table[index];
+  };
+
+  auto result = ShadowViewMutation::List{};
+  result.reserve(mutations.size());
+  for (const auto& mutation : mutations) {
+    switch (mutation.type) {
+      case ShadowViewMutation::Create:
+        result.push_back(ShadowViewMutation::CreateMutation(
+            takeShadowView(mutation.newChildShadowView)));
+        break;
+      case ShadowViewMutation::Delete:
+        result.push_back(ShadowViewMutation::DeleteMutation(
+            takeShadowView(mutation.oldChildShadowView)));
+        break;
+      case ShadowViewMutation::Insert:
+        result.push_back(ShadowViewMutation::InsertMutation(
+            mutation.parentTag,
+            takeShadowView(mutation.newChildShadowView),
+            mutation.index));
+        break;
+      case ShadowViewMutation::Remove:
+        result.push_back(ShadowViewMutation::RemoveMutation(
+            mutation.parentTag,
+            takeShadowView(mutation.oldChildShadowView),
+            mutation.index));
+        break;
+      case ShadowViewMutation::Update: {
+        auto oldChildShadowView = takeShadowView(mutation.oldChildShadowView);
+        auto newChildShadowView = takeShadowView(mutation.newChildShadowView);
+        result.push_back(ShadowViewMutation::UpdateMutation(
+            std::move(oldChildShadowView),
+            std::move(newChildShadowView),
+            mutation.parentTag));
+        break;
+      }
+    }
+  }
+
+  mutations.clear();
+  table.clear();
+  return result;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <react/renderer/mounting/ShadowView.h>
+#include <react/renderer/mounting/ShadowViewMutation.h>
+
+namespace facebook::react {
+
+/*
+ * Append-only table of the shadow views referred to by the mutations of a
+ * single transaction.
+ * Adding a view equal to the most recently added one (as happens for the
+ * `Insert` and `Create`, or `Delete` and `Remove` mutations of the same view)
+ * returns the index of the existing entry instead of copying the view again.
+ */
+class ShadowViewTable final {
+ public:
+  using Index = uint32_t;
+
+  static constexpr Index NoShadowView = std::numeric_limits<Index>::max();
+
+  ShadowViewTable() = default;
+
+  /*
+   * Move-only.
+   */
+  ShadowViewTable(ShadowViewTable &&other) noexcept = default;
+  ShadowViewTable &operator=(ShadowViewTable &&other) noexcept = default;
+  ShadowViewTable(const ShadowViewTable &) = delete;
+  ShadowViewTable &operator=(const ShadowViewTable &) = delete;
+
+  Index add(const ShadowView &shadowView);
+
+  /*
+   * Returns the view stored at `index`, or an empty view for `NoShadowView`.
+   */
+  const ShadowView &at(Index index) const;
+
+  size_t size() const;
+
+  void reserve(size_t size);
+
+ private:
+  friend class CompactShadowViewMutationList;
+
+  std::vector<ShadowView> shadowViews_;
+};
+
+/*
+ * Counterpart of `ShadowViewMutation` which refers to shadow views by their
+ * index in the `ShadowViewTable` of the transaction instead of owning copies
+ * of them, which makes it cheap to move around while diffing.
+ */
+struct CompactShadowViewMutation final {
+  using List = std::vector<CompactShadowViewMutation>;
+
+#pragma mark - Designated Initializers
+
+  static CompactShadowViewMutation CreateMutation(ShadowViewTable &shadowViews, const ShadowView &shadowView);
+
+  static CompactShadowViewMutation DeleteMutation(ShadowViewTable &shadowViews, const ShadowView &shadowView);
+
+  static CompactShadowViewMutation
+  InsertMutation(ShadowViewTable &shadowViews, Tag parentTag, const ShadowView &childShadowView, int index);
+
+  static CompactShadowViewMutation
+  RemoveMutation(ShadowViewTable &shadowViews, Tag parentTag, const ShadowView &childShadowView, int index);
+
+  static CompactShadowViewMutation UpdateMutation(
+      ShadowViewTable &shadowViews,
+      const ShadowView &oldChildShadowView,
+      const ShadowView &newChildShadowView,
+      Tag parentTag);
+
+#pragma mark - Fields
+
+  ShadowViewMutation::Type type = {ShadowViewMutation::Create};
+  Tag parentTag = -1;
+  ShadowViewTable::Index oldChildShadowView = ShadowViewTable::NoShadowView;
+  ShadowViewTable::Index newChildShadowView = ShadowViewTable::NoShadowView;
+  int index = -1;
+};
+
+/*
+ * Move-only list of compact mutations together with the table of shadow views
+ * they refer to.
+ */
+class CompactShadowViewMutationList final {
+ public:
+  CompactShadowViewMutationList() = default;
+
+  /*
+   * Move-only.
+   */
+  CompactShadowViewMutationList(CompactShadowViewMutationList &&other) noexcept = default;
+  CompactShadowViewMutationList &operator=(CompactShadowViewMutationList &&other) noexcept = default;
+  CompactShadowViewMutationList(const CompactShadowViewMutationList &) = delete;
+  CompactShadowViewMutationList &operator=(const CompactShadowViewMutationList &) = delete;
+
+  ShadowViewTable shadowViews;
+  CompactShadowViewMutation::List mutations;
+
+  const ShadowView &oldChildShadowView(const CompactShadowViewMutation &mutation) const;
+  const ShadowView &newChildShadowView(const CompactShadowViewMutation &mutation) const;
+
+  /*
+   * Adapter for consumers of `ShadowViewMutation::List` (e.g. platform
+   * mounting managers). Views are moved out of the table; only views
+   * referred to by more than one mutation are copied.
+   */
+  ShadowViewMutation::List toShadowViewMutationList() &&;
+};
+
+} // namespace facebook::react
@@ -92,6 +92,20 @@ sliceChildShadowNodeViewPairsFromViewNodePair(
       cullingContext);
 }
 
+/*
+ * Returns `true` if the subtrees of both pairs are known to be identical,
+ * either because they refer to the same node or because the nodes were cloned
+ * from each other without changing anything (e.g. during layout).
+ */
+static bool subtreesAreIdentical(
+    const ShadowViewNodePair& oldPair,
+    const ShadowViewNodePair& newPair) {
+  return oldPair.shadowNode == newPair.shadowNode ||
+      (oldPair.shadowNode != nullptr && newPair.shadowNode != nullptr &&
+       oldPair.shadowNode->getSubtreeRevision() ==
+           newPair.shadowNode->getSubtreeRevision());
+}
+
 /*
  * Before we start to diff, let's make sure all our core data structures are
  * in good shape to deliver the best performance.
@@ -99,6 +113,9 @@ sliceChildShadowNodeViewPairsFromViewNodePair(
 static_assert(
     std::is_move_constructible<ShadowViewMutation>::value,
     "`ShadowViewMutation` must be `move constructible`.");
+static_assert(
+    std::is_trivially_copyable<CompactShadowViewMutation>::value,
+    "`CompactShadowViewMutation` must be `trivially copyable`.");
 static_assert(
     std::is_move_constructible<ShadowView>::value,
     "`ShadowView` must be `move constructible`.");
@@ -121,7 +138,8 @@ static_assert(
 
 static void calculateShadowViewMutations(
     ViewNodePairScope& scope,
-    ShadowViewMutation::List& mutations,
+    ShadowViewTable& shadowViews,
+    CompactShadowViewMutation::List& mutations,
     Tag parentTag,
     std::vector<ShadowViewNodePair*>&& oldChildPairs,
     std::vector<ShadowViewNodePair*>&& newChildPairs,
@@ -131,13 +149,14 @@ static void calculateShadowViewMutations(
 namespace {
 
 struct OrderedMutationInstructionContainer {
-  ShadowViewMutation::List createMutations{};
-  ShadowViewMutation::List deleteMutations{};
-  ShadowViewMutation::List insertMutations{};
-  ShadowViewMutation::List removeMutations{};
-  ShadowViewMutation::List updateMutations{};
-  ShadowViewMutation::List downwardMutations{};
-  ShadowViewMutation::List destructiveDownwardMutations{};
+  ShadowViewTable& shadowViews;
+  CompactShadowViewMutation::List createMutations{};
+  CompactShadowViewMutation::List deleteMutations{};
+  CompactShadowViewMutation::List insertMutations{};
+  CompactShadowViewMutation::List removeMutations{};
+  CompactShadowViewMutation::List updateMutations{};
+  CompactShadowViewMutation::List downwardMutations{};
+  CompactShadowViewMutation::List destructiveDownwardMutations{};
 };
 
 } // namespace
@@ -295,9 +314,9 @@ static void updateMatchedPairSubtrees(
   auto newCullingContextCopy =
       newCullingContext.adjustCullingContextIfNeeded(newPair);
 
-  // Update subtrees if View is not flattened, and if node addresses
-  // are not equal
-  if (oldPair.shadowNode != newPair.shadowNode ||
+  // Update subtrees if View is not flattened, and if subtrees are not known
+  // to be identical
+  if (!subtreesAreIdentical(oldPair, newPair) ||
       oldCullingContextCopy != newCullingContextCopy) {
     ViewNodePairScope innerScope{};
     auto oldGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
@@ -308,6 +327,7 @@ static void updateMatchedPairSubtrees(
 
     calculateShadowViewMutations(
         innerScope,
+        mutationContainer.shadowViews,
         *(newGrandChildPairsSize != 0u
               ? &mutationContainer.downwardMutations
               : &mutationContainer.destructiveDownwardMutations),
@@ -343,30 +363,35 @@ static void updateMatchedPair(
     if (newPair.isConcreteView) {
       if (newNodeFoundInOrder) {
         mutationContainer.insertMutations.push_back(
-            ShadowViewMutation::InsertMutation(
+            CompactShadowViewMutation::InsertMutation(
+                mutationContainer.shadowViews,
                 parentTag,
                 newPair.shadowView,
                 static_cast<int>(newPair.mountIndex)));
       }
       mutationContainer.createMutations.push_back(
-          ShadowViewMutation::CreateMutation(newPair.shadowView));
+          CompactShadowViewMutation::CreateMutation(
+              mutationContainer.shadowViews, newPair.shadowView));
     } else {
       if (oldNodeFoundInOrder) {
         mutationContainer.removeMutations.push_back(
-            ShadowViewMutation::RemoveMutation(
+            CompactShadowViewMutation::RemoveMutation(
+                mutationContainer.shadowViews,
                 parentTag,
                 oldPair.shadowView,
                 static_cast<int>(oldPair.mountIndex)));
       }
       mutationContainer.deleteMutations.push_back(
-          ShadowViewMutation::DeleteMutation(oldPair.shadowView));
+          CompactShadowViewMutation::DeleteMutation(
+              mutationContainer.shadowViews, oldPair.shadowView));
     }
   } else if (oldPair.isConcreteView && newPair.isConcreteView) {
     // If we found the old node by traversing, but not the new node,
     // it means that there's some reordering requiring a REMOVE mutation.
     if (oldNodeFoundInOrder && !newNodeFoundInOrder) {
       mutationContainer.removeMutations.push_back(
-          ShadowViewMutation::RemoveMutation(
+          CompactShadowViewMutation::RemoveMutation(
+              mutationContainer.shadowViews,
               parentTag,
               newPair.shadowView,
               static_cast<int>(oldPair.mountIndex)));
@@ -377,8 +402,11 @@ static void updateMatchedPair(
     // above.
     if (oldPair.shadowView != newPair.shadowView) {
       mutationContainer.updateMutations.push_back(
-          ShadowViewMutation::UpdateMutation(
-              oldPair.shadowView, newPair.shadowView, parentTag));
+          CompactShadowViewMutation::UpdateMutation(
+              mutationContainer.shadowViews,
+              oldPair.shadowView,
+              newPair.shadowView,
+              parentTag));
     }
   }
 }
@@ -554,13 +582,15 @@ static void calculateShadowViewMutationsFlattener(
         if (treeChildPair.inOtherTree() &&
             treeChildPair.otherTreePair->isConcreteView) {
           mutationContainer.removeMutations.push_back(
-              ShadowViewMutation::RemoveMutation(
+              CompactShadowViewMutation::RemoveMutation(
+                  mutationContainer.shadowViews,
                   node.shadowView.tag,
                   treeChildPair.otherTreePair->shadowView,
                   static_cast<int>(treeChildPair.mountIndex)));
         } else {
           mutationContainer.removeMutations.push_back(
-              ShadowViewMutation::RemoveMutation(
+              CompactShadowViewMutation::RemoveMutation(
+                  mutationContainer.shadowViews,
                   node.shadowView.tag,
                   treeChildPair.shadowView,
                   static_cast<int>(treeChildPair.mountIndex)));
@@ -569,7 +599,8 @@ static void calculateShadowViewMutationsFlattener(
         // treeChildParent represents the "new" version of the node, so
         // we can safely insert it without checking in the other tree
         mutationContainer.insertMutations.push_back(
-            ShadowViewMutation::InsertMutation(
+            CompactShadowViewMutation::InsertMutation(
+                mutationContainer.shadowViews,
                 node.shadowView.tag,
                 treeChildPair.shadowView,
                 static_cast<int>(treeChildPair.mountIndex)));
@@ -621,7 +652,8 @@ static void calculateShadowViewMutationsFlattener(
         // TODO: whenever we insert, we already update the relevant properties,
         // so this update is redundant. We should remove this.
         mutationContainer.updateMutations.push_back(
-            ShadowViewMutation::UpdateMutation(
+            CompactShadowViewMutation::UpdateMutation(
+                mutationContainer.shadowViews,
                 oldTreeNodePair.shadowView,
                 newTreeNodePair.shadowView,
                 parentTagForUpdate));
@@ -638,7 +670,7 @@ static void calculateShadowViewMutationsFlattener(
 
       // Update children if appropriate.
       if (!oldTreeNodePair.flattened && !newTreeNodePair.flattened) {
-        if (oldTreeNodePair.shadowNode != newTreeNodePair.shadowNode ||
+        if (!subtreesAreIdentical(oldTreeNodePair, newTreeNodePair) ||
             adjustedOldCullingContext != adjustedNewCullingContext) {
           ViewNodePairScope innerScope{};
           auto oldGrandChildPairs =
@@ -656,6 +688,7 @@ static void calculateShadowViewMutationsFlattener(
 
           calculateShadowViewMutations(
               innerScope,
+              mutationContainer.shadowViews,
               mutationContainer.downwardMutations,
               newTreeNodePair.shadowView.tag,
               std::move(oldGrandChildPairs),
@@ -797,10 +830,12 @@ static void calculateShadowViewMutationsFlattener(
       if (newTreeNodePair.isConcreteView != oldTreeNodePair.isConcreteView) {
         if (newTreeNodePair.isConcreteView) {
           mutationContainer.createMutations.push_back(
-              ShadowViewMutation::CreateMutation(newTreeNodePair.shadowView));
+              CompactShadowViewMutation::CreateMutation(
+                  mutationContainer.shadowViews, newTreeNodePair.shadowView));
         } else {
           mutationContainer.deleteMutations.push_back(
-              ShadowViewMutation::DeleteMutation(oldTreeNodePair.shadowView));
+              CompactShadowViewMutation::DeleteMutation(
+                  mutationContainer.shadowViews, oldTreeNodePair.shadowView));
         }
       }
 
@@ -841,12 +876,14 @@ static void calculateShadowViewMutationsFlattener(
 
     if (reparentMode == ReparentMode::Flatten) {
       mutationContainer.deleteMutations.push_back(
-          ShadowViewMutation::DeleteMutation(treeChildPair.shadowView));
+          CompactShadowViewMutation::DeleteMutation(
+              mutationContainer.shadowViews, treeChildPair.shadowView));
 
       if (!treeChildPair.flattened) {
         ViewNodePairScope innerScope{};
         calculateShadowViewMutations(
             innerScope,
+            mutationContainer.shadowViews,
             mutationContainer.destructiveDownwardMutations,
             treeChildPair.shadowView.tag,
             sliceChildShadowNodeViewPairsFromViewNodePair(
@@ -857,12 +894,14 @@ static void calculateShadowViewMutationsFlattener(
       }
     } else {
       mutationContainer.createMutations.push_back(
-          ShadowViewMutation::CreateMutation(treeChildPair.shadowView));
+          CompactShadowViewMutation::CreateMutation(
+              mutationContainer.shadowViews, treeChildPair.shadowView));
 
       if (!treeChildPair.flattened) {
         ViewNodePairScope innerScope{};
         calculateShadowViewMutations(
             innerScope,
+            mutationContainer.shadowViews,
             mutationContainer.downwardMutations,
             treeChildPair.shadowView.tag,
             {},
@@ -877,7 +916,8 @@ static void calculateShadowViewMutationsFlattener(
 
 static void calculateShadowViewMutations(
     ViewNodePairScope& scope,
-    ShadowViewMutation::List& mutations,
+    ShadowViewTable& shadowViews,
+    CompactShadowViewMutation::List& mutations,
     Tag parentTag,
     std::vector<ShadowViewNodePair*>&& oldChildPairs,
     std::vector<ShadowViewNodePair*>&& newChildPairs,
@@ -890,7 +930,8 @@ static void calculateShadowViewMutations(
   size_t index = 0;
 
   // Lists of mutations
-  auto mutationContainer = OrderedMutationInstructionContainer{};
+  auto mutationContainer =
+      OrderedMutationInstructionContainer{.shadowViews = shadowViews};
 
   if (ReactNativeFeatureFlags::
           enableDifferentiatorMutationVectorPreallocation()) {
@@ -946,8 +987,11 @@ static void calculateShadowViewMutations(
     if (newChildPair.isConcreteView &&
         oldChildPair.shadowView != newChildPair.shadowView) {
       mutationContainer.updateMutations.push_back(
-          ShadowViewMutation::UpdateMutation(
-              oldChildPair.shadowView, newChildPair.shadowView, parentTag));
+          CompactShadowViewMutation::UpdateMutation(
+              mutationContainer.shadowViews,
+              oldChildPair.shadowView,
+              newChildPair.shadowView,
+              parentTag));
     }
 
     auto adjustedOldCullingContext =
@@ -955,9 +999,9 @@ static void calculateShadowViewMutations(
     auto adjustedNewCullingContext =
         newCullingContext.adjustCullingContextIfNeeded(newChildPair);
 
-    // Recursively update tree if ShadowNode pointers are not equal
+    // Recursively update tree if subtrees are not known to be identical
     if (!oldChildPair.flattened &&
-        (oldChildPair.shadowNode != newChildPair.shadowNode ||
+        (!subtreesAreIdentical(oldChildPair, newChildPair) ||
          adjustedOldCullingContext != adjustedNewCullingContext)) {
       ViewNodePairScope innerScope{};
       auto oldGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
@@ -969,6 +1013,7 @@ static void calculateShadowViewMutations(
 
       calculateShadowViewMutations(
           innerScope,
+          mutationContainer.shadowViews,
           *(newGrandChildPairsSize != 0u
                 ? &mutationContainer.downwardMutations
                 : &mutationContainer.destructiveDownwardMutations),
@@ -998,9 +1043,11 @@ static void calculateShadowViewMutations(
       }
 
       mutationContainer.deleteMutations.push_back(
-          ShadowViewMutation::DeleteMutation(oldChildPair.shadowView));
+          CompactShadowViewMutation::DeleteMutation(
+              mutationContainer.shadowViews, oldChildPair.shadowView));
       mutationContainer.removeMutations.push_back(
-          ShadowViewMutation::RemoveMutation(
+          CompactShadowViewMutation::RemoveMutation(
+              mutationContainer.shadowViews,
               parentTag,
               oldChildPair.shadowView,
               static_cast<int>(oldChildPair.mountIndex)));
@@ -1012,6 +1059,7 @@ static void calculateShadowViewMutations(
       ViewNodePairScope innerScope{};
       calculateShadowViewMutations(
           innerScope,
+          mutationContainer.shadowViews,
           mutationContainer.destructiveDownwardMutations,
           oldChildPair.shadowView.tag,
           sliceChildShadowNodeViewPairsFromViewNodePair(
@@ -1036,18 +1084,21 @@ static void calculateShadowViewMutations(
       }
 
       mutationContainer.insertMutations.push_back(
-          ShadowViewMutation::InsertMutation(
+          CompactShadowViewMutation::InsertMutation(
+              mutationContainer.shadowViews,
               parentTag,
               newChildPair.shadowView,
               static_cast<int>(newChildPair.mountIndex)));
       mutationContainer.createMutations.push_back(
-          ShadowViewMutation::CreateMutation(newChildPair.shadowView));
+          CompactShadowViewMutation::CreateMutation(
+              mutationContainer.shadowViews, newChildPair.shadowView));
       auto newCullingContextCopy =
           newCullingContext.adjustCullingContextIfNeeded(newChildPair);
 
       ViewNodePairScope innerScope{};
       calculateShadowViewMutations(
           innerScope,
+          mutationContainer.shadowViews,
           mutationContainer.downwardMutations,
           newChildPair.shadowView.tag,
           {},
@@ -1209,7 +1260,8 @@ static void calculateShadowViewMutations(
             // because we know the view is concrete, and still in the new
             // hierarchy.
             mutationContainer.removeMutations.push_back(
-                ShadowViewMutation::RemoveMutation(
+                CompactShadowViewMutation::RemoveMutation(
+                    mutationContainer.shadowViews,
                     parentTag,
                     otherTreeView,
                     static_cast<int>(oldChildPair.mountIndex)));
@@ -1217,7 +1269,8 @@ static void calculateShadowViewMutations(
           }
 
           mutationContainer.removeMutations.push_back(
-              ShadowViewMutation::RemoveMutation(
+              CompactShadowViewMutation::RemoveMutation(
+                  mutationContainer.shadowViews,
                   parentTag,
                   oldChildPair.shadowView,
                   static_cast<int>(oldChildPair.mountIndex)));
@@ -1241,7 +1294,8 @@ static void calculateShadowViewMutations(
       });
       if (newChildPair.isConcreteView) {
         mutationContainer.insertMutations.push_back(
-            ShadowViewMutation::InsertMutation(
+            CompactShadowViewMutation::InsertMutation(
+                mutationContainer.shadowViews,
                 parentTag,
                 newChildPair.shadowView,
                 static_cast<int>(newChildPair.mountIndex)));
@@ -1278,7 +1332,8 @@ static void calculateShadowViewMutations(
       // This can happen when the parent is unflattened
       if (!oldChildPair.inOtherTree() && oldChildPair.isConcreteView) {
         mutationContainer.deleteMutations.push_back(
-            ShadowViewMutation::DeleteMutation(oldChildPair.shadowView));
+            CompactShadowViewMutation::DeleteMutation(
+                mutationContainer.shadowViews, oldChildPair.shadowView));
         auto oldCullingContextCopy =
             oldCullingContext.adjustCullingContextIfNeeded(oldChildPair);
 
@@ -1290,6 +1345,7 @@ static void calculateShadowViewMutations(
             oldChildPair, innerScope, false, oldCullingContextCopy);
         calculateShadowViewMutations(
             innerScope,
+            mutationContainer.shadowViews,
             mutationContainer.destructiveDownwardMutations,
             oldChildPair.shadowView.tag,
             std::move(newGrandChildPairs),
@@ -1320,7 +1376,8 @@ static void calculateShadowViewMutations(
       }
 
       mutationContainer.createMutations.push_back(
-          ShadowViewMutation::CreateMutation(newChildPair.shadowView));
+          CompactShadowViewMutation::CreateMutation(
+              mutationContainer.shadowViews, newChildPair.shadowView));
 
       auto newCullingContextCopy =
           newCullingContext.adjustCullingContextIfNeeded(newChildPair);
@@ -1329,6 +1386,7 @@ static void calculateShadowViewMutations(
 
       calculateShadowViewMutations(
           innerScope,
+          mutationContainer.shadowViews,
           mutationContainer.downwardMutations,
           newChildPair.shadowView.tag,
           {},
@@ -1383,7 +1441,7 @@ static void calculateShadowViewMutations(
       std::back_inserter(mutations));
 }
 
-ShadowViewMutation::List calculateShadowViewMutations(
+CompactShadowViewMutationList calculateCompactShadowViewMutations(
     const ShadowNode& oldRootShadowNode,
     const ShadowNode& newRootShadowNode) {
   TraceSection s("calculateShadowViewMutations");
@@ -1396,15 +1454,17 @@ ShadowViewMutation::List calculateShadowViewMutations(
   ViewNodePairScope viewNodePairScope{};
   ViewNodePairScope innerViewNodePairScope{};
 
-  auto mutations = ShadowViewMutation::List{};
+  auto result = CompactShadowViewMutationList{};
+  auto& shadowViews = result.shadowViews;
+  auto& mutations = result.mutations;
 
   auto oldRootShadowView = ShadowView(oldRootShadowNode);
   auto newRootShadowView = ShadowView(newRootShadowNode);
 
   if (oldRootShadowView != newRootShadowView) {
     mutations.push_back(
-        ShadowViewMutation::UpdateMutation(
-            oldRootShadowView, newRootShadowView, {}));
+        CompactShadowViewMutation::UpdateMutation(
+            shadowViews, oldRootShadowView, newRootShadowView, {}));
   }
 
   auto sliceOne = sliceChildShadowNodeViewPairs(
@@ -1422,15 +1482,19 @@ ShadowViewMutation::List calculateShadowViewMutations(
 
   if (ReactNativeFeatureFlags::
           enableDifferentiatorMutationVectorPreallocation()) {
-    // Estimate ~2 mutations per view (create + insert or remove + delete).
-    mutations.reserve(
-        std::max(size_t(256), (sliceOne.size() + sliceTwo.size()) * 2));
+    // Estimate ~2 mutations per view (create + insert or remove + delete),
+    // which mostly share one entry in the table of shadow views.
+    auto estimatedSize =
+        std::max(size_t(256), (sliceOne.size() + sliceTwo.size()) * 2);
+    mutations.reserve(estimatedSize);
+    shadowViews.reserve(estimatedSize);
   } else {
     mutations.reserve(256);
   }
 
   calculateShadowViewMutations(
       innerViewNodePairScope,
+      shadowViews,
       mutations,
       oldRootShadowNode.getTag(),
       std::move(sliceOne),
@@ -1440,35 +1504,42 @@ ShadowViewMutation::List calculateShadowViewMutations(
     LOG(ERROR) << "Differ Completed: " << mutations.size() << " mutations";
     for (size_t i = 0; i < mutations.size(); i++) {
       auto& mutation = mutations[i];
+      auto& oldChildShadowView = result.oldChildShadowView(mutation);
+      auto& newChildShadowView = result.newChildShadowView(mutation);
       switch (mutation.type) {
         case ShadowViewMutation::Type::Create:
-          LOG(ERROR) << "[" << i << "] CREATE "
-                     << mutation.newChildShadowView.tag;
+          LOG(ERROR) << "[" << i << "] CREATE " << newChildShadowView.tag;
           break;
         case ShadowViewMutation::Type::Delete:
-          LOG(ERROR) << "[" << i << "] DELETE "
-                     << mutation.oldChildShadowView.tag;
+          LOG(ERROR) << "[" << i << "] DELETE " << oldChildShadowView.tag;
           break;
         case ShadowViewMutation::Type::Insert:
-          LOG(ERROR) << "[" << i << "] INSERT "
-                     << mutation.newChildShadowView.tag << " INTO "
-                     << mutation.parentTag << " @ " << mutation.index;
+          LOG(ERROR) << "[" << i << "] INSERT " << newChildShadowView.tag
+                     << " INTO " << mutation.parentTag << " @ "
+                     << mutation.index;
           break;
         case ShadowViewMutation::Type::Remove:
-          LOG(ERROR) << "[" << i << "] REMOVE "
-                     << mutation.oldChildShadowView.tag << " FROM "
-                     << mutation.parentTag << " @ " << mutation.index;
+          LOG(ERROR) << "[" << i << "] REMOVE " << oldChildShadowView.tag
+                     << " FROM " << mutation.parentTag << " @ "
+                     << mutation.index;
           break;
         case ShadowViewMutation::Type::Update:
-          LOG(ERROR) << "[" << i << "] UPDATE "
-                     << mutation.newChildShadowView.tag << " IN "
-                     << mutation.parentTag;
+          LOG(ERROR) << "[" << i << "] UPDATE " << newChildShadowView.tag
+                     << " IN " << mutation.parentTag;
           break;
       }
     }
   });
 
-  return mutations;
+  return result;
+}
+
+ShadowViewMutation::List calculateShadowViewMutations(
+    const ShadowNode& oldRootShadowNode,
+    const ShadowNode& newRootShadowNode) {
+  return calculateCompactShadowViewMutations(
+             oldRootShadowNode, newRootShadowNode)
+      .toShadowViewMutationList();
 }
 
 } // namespace facebook::react
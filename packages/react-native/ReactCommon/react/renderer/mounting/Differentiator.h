@@ -8,6 +8,7 @@
 #pragma once
 
 #include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/mounting/CompactShadowViewMutation.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 
 namespace facebook::react {
@@ -21,4 +22,13 @@ ShadowViewMutation::List calculateShadowViewMutations(
     const ShadowNode &oldRootShadowNode,
     const ShadowNode &newRootShadowNode);
 
+/*
+ * Same as `calculateShadowViewMutations`, but returns mutations which refer to
+ * a per-transaction table of shadow views instead of owning copies of them.
+ * `calculateShadowViewMutations` converts this list for existing consumers.
+ */
+CompactShadowViewMutationList calculateCompactShadowViewMutations(
+    const ShadowNode &oldRootShadowNode,
+    const ShadowNode &newRootShadowNode);
+
 } // namespace facebook::react
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/mounting/CompactShadowViewMutation.h>
+
+namespace facebook::react {
+
+namespace {
+
+ShadowView makeShadowView(Tag tag) {
+  auto shadowView = ShadowView{};
+  shadowView.tag = tag;
+  shadowView.props = std::make_shared<const Props>();
+  return shadowView;
+}
+
+} // namespace
+
+TEST(CompactShadowViewMutationTest, insertAndCreateShareShadowView) {
+  auto list = CompactShadowViewMutationList{};
+  auto shadowView = makeShadowView(42);
+
+  list.mutations.push_back(
+      CompactShadowViewMutation::InsertMutation(
+          list.shadowViews, 1, shadowView, 0));
+  list.mutations.push_back(
+      CompactShadowViewMutation::CreateMutation(list.shadowViews, shadowView));
+
+  EXPECT_EQ(list.shadowViews.size(), 1u);
+  EXPECT_EQ(
+      list.mutations[0].newChildShadowView,
+      list.mutations[1].newChildShadowView);
+  EXPECT_EQ(list.newChildShadowView(list.mutations[1]), shadowView);
+  EXPECT_EQ(list.oldChildShadowView(list.mutations[1]), ShadowView{});
+}
+
+TEST(CompactShadowViewMutationTest, differentShadowViewsAreNotShared) {
+  auto list = CompactShadowViewMutationList{};
+  auto oldShadowView = makeShadowView(42);
+  auto newShadowView = oldShadowView;
+  newShadowView.layoutMetrics.frame.size.width = 100;
+
+  list.mutations.push_back(
+      CompactShadowViewMutation::UpdateMutation(
+          list.shadowViews, oldShadowView, newShadowView, 1));
+
+  EXPECT_EQ(list.shadowViews.size(), 2u);
+  EXPECT_EQ(list.oldChildShadowView(list.mutations[0]), oldShadowView);
+  EXPECT_EQ(list.newChildShadowView(list.mutations[0]), newShadowView);
+}
+
+TEST(CompactShadowViewMutationTest, toShadowViewMutationList) {
+  auto list = CompactShadowViewMutationList{};
+  auto firstShadowView = makeShadowView(42);
+  auto secondShadowView = makeShadowView(43);
+
+  list.mutations.push_back(
+      CompactShadowViewMutation::RemoveMutation(
+          list.shadowViews, 1, firstShadowView, 0));
+  list.mutations.push_back(
+      CompactShadowViewMutation::DeleteMutation(
+          list.shadowViews, firstShadowView));
+  list.mutations.push_back(
+      CompactShadowViewMutation::CreateMutation(
+          list.shadowViews, secondShadowView));
+  list.mutations.push_back(
+      CompactShadowViewMutation::InsertMutation(
+          list.shadowViews, 1, secondShadowView, 0));
+
+  auto mutations = std::move(list).toShadowViewMutationList();
+
+  ASSERT_EQ(mutations.size(), 4u);
+  EXPECT_EQ(mutations[0].type, ShadowViewMutation::Remove);
+  EXPECT_EQ(mutations[0].parentTag, 1);
+  EXPECT_EQ(mutations[0].oldChildShadowView, firstShadowView);
+  EXPECT_EQ(mutations[0].index, 0);
+  EXPECT_EQ(mutations[1].type, ShadowViewMutation::Delete);
+  EXPECT_EQ(mutations[1].oldChildShadowView, firstShadowView);
+  EXPECT_EQ(mutations[2].type, ShadowViewMutation::Create);
+  EXPECT_EQ(mutations[2].newChildShadowView, secondShadowView);
+  EXPECT_EQ(mutations[3].type, ShadowViewMutation::Insert);
+  EXPECT_EQ(mutations[3].newChildShadowView, secondShadowView);
+  EXPECT_EQ(mutations[3].newChildShadowView.props, secondShadowView.props);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/stubs/stubs.h>
+#include <react/renderer/observers/mutation/MutationObserverManager.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <react/utils/Telemetry.h>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int kFanOut = 10;
+constexpr SurfaceId kSurfaceId = 1;
+
+/*
+ * The stages of `ShadowTree::commit`, in order.
+ */
+enum class CommitStage {
+  Clone,
+  StateProgression,
+  CommitHooks,
+  Layout,
+  UpdateMountedFlag,
+  Diff,
+};
+
+/*
+ * Points in time of the last commit. The stages happening inside of
+ * `ShadowTree` are read from the telemetry of the mounting transaction.
+ */
+struct CommitTimeline {
+  TelemetryTimePoint cloneStartTime;
+  TelemetryTimePoint cloneEndTime;
+  TelemetryTimePoint commitHooksStartTime;
+  TelemetryTimePoint commitHooksEndTime;
+  TransactionTelemetry telemetry;
+};
+
+/*
+ * Dispatches commit hooks through `UIManager`, and mounts every transaction
+ * synchronously on a stub view tree.
+ */
+class BenchmarkShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  BenchmarkShadowTreeDelegate(CommitTimeline& timeline, UIManager& uiManager)
+      : timeline_(timeline), uiManager_(uiManager) {}
+
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& shadowTree,
+      const RootShadowNode::Shared& oldRootShadowNode,
+      const RootShadowNode::Unshared& newRootShadowNode,
+      const ShadowTree::CommitOptions& commitOptions) const override {
+    // The benchmark commits synchronously, which commits coming from React
+    // can't do on the React branch, so hooks are told the commit comes from
+    // React without `ShadowTree` seeing it. Hooks such as mutation observers
+    // only run for React commits.
+    auto hookCommitOptions = commitOptions;
+    hookCommitOptions.source = ShadowTree::CommitSource::React;
+
+    timeline_.commitHooksStartTime = TelemetryClock::now();
+    auto resultRootShadowNode = uiManager_.shadowTreeWillCommit(
+        shadowTree, oldRootShadowNode, newRootShadowNode, hookCommitOptions);
+    timeline_.commitHooksEndTime = TelemetryClock::now();
+    return resultRootShadowNode;
+  }
+
+  void shadowTreeDidFinishTransaction(
+      std::shared_ptr<const MountingCoordinator> mountingCoordinator,
+      bool /*mountSynchronously*/) const override {
+    auto transaction = mountingCoordinator->pullTransaction();
+    if (transaction) {
+      timeline_.telemetry = transaction->getTelemetry();
+      viewTree.mutate(transaction->getMutations());
+    }
+  }
+
+  void shadowTreeDidFinishReactCommit(
+      const ShadowTree& /*shadowTree*/) const override {}
+
+  void shadowTreeDidPromoteReactRevision(
+      const ShadowTree& /*shadowTree*/) const override {}
+
+  mutable StubViewTree viewTree;
+
+ private:
+  CommitTimeline& timeline_;
+  UIManager& uiManager_;
+};
+
+std::shared_ptr<const ViewShadowNodeProps> viewProps(Float width) {
+  auto props = std::make_shared<ViewShadowNodeProps>();
+  // Keeps every node a host view, so every node is diffed and mounted.
+  props->collapsable = false;
+  props->yogaStyle.setDimension(
+      yoga::Dimension::Width, yoga::StyleSizeLength::points(width));
+  return props;
+}
+
+/*
+ * Builds a tree of views with `kFanOut` children per view, `depth` levels
+ * below the top one.
+ */
+Element<ViewShadowNode> buildTree(
+    Tag& tag,
+    int depth,
+    const std::shared_ptr<const ViewShadowNodeProps>& props) {
+  auto element =
+      Element<ViewShadowNode>().tag(++tag).surfaceId(kSurfaceId).props(props);
+  if (depth > 0) {
+    auto children = std::vector<ElementFragment>{};
+    children.reserve(kFanOut);
+    for (int i = 0; i < kFanOut; i++) {
+      children.push_back(buildTree(tag, depth - 1, props));
+    }
+    element.children(children);
+  }
+  return element;
+}
+
+void collectFamilies(
+    const ShadowNode& shadowNode,
+    std::unordered_set<std::shared_ptr<const ShadowNodeFamily>>& families) {
+  for (const auto& child : shadowNode.getChildren()) {
+    families.insert(child->getFamilyShared());
+    collectFamilies(*child, families);
+  }
+}
+
+TelemetryDuration stageDuration(
+    const CommitTimeline& timeline,
+    CommitStage stage) {
+  const auto& telemetry = timeline.telemetry;
+  switch (stage) {
+    case CommitStage::Clone:
+      return timeline.cloneEndTime - timeline.cloneStartTime;
+    case CommitStage::StateProgression:
+      return timeline.commitHooksStartTime - timeline.cloneEndTime;
+    case CommitStage::CommitHooks:
+      return timeline.commitHooksEndTime - timeline.commitHooksStartTime;
+    case CommitStage::Layout:
+      return telemetry.getLayoutEndTime() - telemetry.getLayoutStartTime();
+    case CommitStage::UpdateMountedFlag:
+      // The commit ends right after `updateMountedFlag`.
+      return telemetry.getCommitEndTime() - telemetry.getLayoutEndTime();
+    case CommitStage::Diff:
+      return telemetry.getDiffEndTime() - telemetry.getDiffStartTime();
+  }
+  return {};
+}
+
+/*
+ * Commits a tree of about `state.range(0)` views, updating the props (and so
+ * the layout) of every view in each commit, and reports the time spent in
+ * `stage` only.
+ */
+void commitStage(benchmark::State& state, CommitStage stage) {
+  auto builder = simpleComponentBuilder();
+  auto contextContainer = ContextContainer{};
+  auto timeline = CommitTimeline{};
+  auto uiManager = UIManager{
+      [](std::function<void(jsi::Runtime&)>&& /*callback*/) {},
+      std::make_shared<ContextContainer>()};
+  auto delegate = BenchmarkShadowTreeDelegate{timeline, uiManager};
+  auto shadowTree = ShadowTree{
+      kSurfaceId,
+      LayoutConstraints{
+          .minimumSize = Size{.width = 0, .height = 0},
+          .maximumSize =
+              Size{
+                  .width = 1000,
+                  .height = std::numeric_limits<Float>::infinity()}},
+      LayoutContext{},
+      delegate,
+      contextContainer};
+  delegate.viewTree =
+      StubViewTree(ShadowView(*shadowTree.getCurrentRevision().rootShadowNode));
+
+  // About 1.11 times `state.range(0)` views.
+  auto depth = static_cast<int>(std::lround(std::log10(state.range(0))));
+  auto props = std::array{viewProps(100), viewProps(200)};
+  Tag tag = 1;
+  std::shared_ptr<const ShadowNode> tree =
+      builder.build(buildTree(tag, depth, props[0]));
+
+  auto commitOptions = ShadowTree::CommitOptions{
+      .enableStateReconciliation = true, .mountSynchronously = true};
+  shadowTree.commit(
+      [&](const RootShadowNode& oldRootShadowNode) {
+        return std::static_pointer_cast<RootShadowNode>(
+            oldRootShadowNode.ShadowNode::clone(
+                {.children = std::make_shared<
+                     std::vector<std::shared_ptr<const ShadowNode>>>(
+                     std::vector<std::shared_ptr<const ShadowNode>>{tree})}));
+      },
+      commitOptions);
+
+  // A representative commit hook: a mutation observer of the whole tree,
+  // which compares the children of every node of both revisions.
+  auto mutationObserverManager = MutationObserverManager{};
+  mutationObserverManager.connect(
+      uiManager, [](std::vector<MutationRecord>& /*mutationRecords*/) {});
+  mutationObserverManager.observe(
+      MutationObserverId{1}, tree, /*observeSubtree*/ true, uiManager);
+
+  auto families = std::unordered_set<std::shared_ptr<const ShadowNodeFamily>>{};
+  collectFamilies(*shadowTree.getCurrentRevision().rootShadowNode, families);
+
+  size_t commitsCount = 0;
+  for (auto _ : state) {
+    const auto& nextProps = props[++commitsCount % props.size()];
+    shadowTree.commit(
+        [&](const RootShadowNode& oldRootShadowNode) {
+          timeline.cloneStartTime = TelemetryClock::now();
+          auto newRootShadowNode = std::static_pointer_cast<RootShadowNode>(
+              oldRootShadowNode.cloneMultiple(
+                  families,
+                  [&](const ShadowNode& oldShadowNode,
+                      const ShadowNodeFragment& fragment) {
+                    return oldShadowNode.clone(
+                        {.props = nextProps, .children = fragment.children});
+                  }));
+          timeline.cloneEndTime = TelemetryClock::now();
+          return newRootShadowNode;
+        },
+        commitOptions);
+
+    state.SetIterationTime(
+        std::chrono::duration<double>(stageDuration(timeline, stage)).count());
+  }
+
+  state.counters["nodes"] = static_cast<double>(families.size());
+
+  mutationObserverManager.disconnect(uiManager);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(commitStage, clone, CommitStage::Clone)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->UseManualTime();
+BENCHMARK_CAPTURE(commitStage, stateProgression, CommitStage::StateProgression)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->UseManualTime();
+BENCHMARK_CAPTURE(commitStage, commitHooks, CommitStage::CommitHooks)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->UseManualTime();
+BENCHMARK_CAPTURE(commitStage, layout, CommitStage::Layout)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->UseManualTime();
+BENCHMARK_CAPTURE(
+    commitStage,
+    updateMountedFlag,
+    CommitStage::UpdateMountedFlag)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->UseManualTime();
+BENCHMARK_CAPTURE(commitStage, diff, CommitStage::Diff)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->UseManualTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -14,6 +14,7 @@
 #include <react/renderer/consistency/ScopedShadowTreeRevisionLock.h>
 #include <react/timing/primitives.h>
 #include <react/utils/OnScopeExit.h>
+#include <react/utils/PoolAllocator.h>
 
 namespace facebook::react {
 
@@ -30,6 +31,22 @@ int64_t durationToMilliseconds(HighResDuration duration) {
   return duration.toNanoseconds() / static_cast<int64_t>(1e6);
 }
 
+/*
+ * Tasks are created and destroyed at a high rate, so they are allocated from
+ * a pool.
+ */
+template <typename CallbackT>
+std::shared_ptr<Task> createTask(
+    SchedulerPriority priority,
+    CallbackT&& callback,
+    HighResTimeStamp expirationTime) {
+  return std::allocate_shared<Task>(
+      PoolAllocator<Task>{},
+      priority,
+      std::forward<CallbackT>(callback),
+      expirationTime);
+}
+
 } // namespace
 
 #pragma mark - Public
@@ -51,8 +68,7 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleTask(
     SchedulerPriority priority,
     jsi::Function&& callback) noexcept {
   auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
-  auto task =
-      std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  auto task = createTask(priority, std::move(callback), expirationTime);
 
   scheduleTask(task);
 
@@ -63,8 +79,7 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleTask(
     SchedulerPriority priority,
     RawCallback&& callback) noexcept {
   auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
-  auto task =
-      std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  auto task = createTask(priority, std::move(callback), expirationTime);
 
   scheduleTask(task);
 
@@ -83,7 +98,7 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleIdleTask(
 
   auto timeout = getResolvedTimeoutForIdleTask(customTimeout);
   auto expirationTime = now_() + timeout;
-  auto task = std::make_shared<Task>(
+  auto task = createTask(
       SchedulerPriority::IdlePriority, std::move(callback), expirationTime);
 
   scheduleTask(task);
@@ -102,7 +117,7 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleIdleTask(
       "RawCallback");
 
   auto expirationTime = now_() + getResolvedTimeoutForIdleTask(customTimeout);
-  auto task = std::make_shared<Task>(
+  auto task = createTask(
       SchedulerPriority::IdlePriority, std::move(callback), expirationTime);
 
   scheduleTask(task);
@@ -121,6 +136,13 @@ bool RuntimeScheduler_Modern::getShouldYield() noexcept {
 
 void RuntimeScheduler_Modern::cancelTask(Task& task) noexcept {
   task.callback.reset();
+
+  // The task which is being executed stays in the queue, it's removed once it
+  // finishes (unless it returns a continuation).
+  if (&task != currentTask_) {
+    std::unique_lock lock(schedulingMutex_);
+    taskQueue_.remove(task);
+  }
 }
 
 SchedulerPriority RuntimeScheduler_Modern::getCurrentPriorityLevel()
@@ -462,7 +484,7 @@ void RuntimeScheduler_Modern::handleTaskError(
 void RuntimeScheduler_Modern::clearQueues() {
   {
     std::unique_lock lock(schedulingMutex_);
-    taskQueue_ = {};
+    taskQueue_.clear();
     isEventLoopScheduled_ = false;
   }
 
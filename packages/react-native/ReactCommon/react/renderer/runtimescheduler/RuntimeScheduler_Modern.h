@@ -10,6 +10,7 @@
 #include <ReactCommon/RuntimeExecutor.h>
 #include <react/renderer/consistency/ShadowTreeRevisionConsistencyManager.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <react/renderer/runtimescheduler/SchedulerTaskQueue.h>
 #include <react/renderer/runtimescheduler/Task.h>
 #include <atomic>
 #include <memory>
@@ -83,7 +84,8 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
       HighResDuration customTimeout = timeoutForSchedulerPriority(SchedulerPriority::IdlePriority)) noexcept override;
 
   /*
-   * Cancelled task will never be executed.
+   * Cancelled task will never be executed. Unless it is being executed at the
+   * moment, the task is removed from the queue right away.
    *
    * Operates on JSI object.
    * Thread synchronization must be enforced externally.
@@ -146,7 +148,7 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
  private:
   std::atomic<uint_fast8_t> syncTaskRequests_{0};
 
-  std::priority_queue<std::shared_ptr<Task>, std::vector<std::shared_ptr<Task>>, TaskPriorityComparer> taskQueue_;
+  SchedulerTaskQueue taskQueue_;
 
   Task *currentTask_{};
   HighResTimeStamp lastYieldingOpportunity_;
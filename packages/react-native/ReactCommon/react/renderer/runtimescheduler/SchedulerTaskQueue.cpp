@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "SchedulerTaskQueue.h"
+
+#include <react/debug/react_native_assert.h>
+
+#include <utility>
+
+namespace facebook::react {
+
+SchedulerTaskQueue::~SchedulerTaskQueue() {
+  clear();
+}
+
+void SchedulerTaskQueue::push(std::shared_ptr<Task> task) {
+  react_native_assert(!task->queuePosition && "Task is already queued.");
+
+  auto& bucket = buckets_[bucketIndex(task->priority)];
+
+  // Tasks almost always expire in the order they are scheduled in, so the
+  // position is found right at the end of the list.
+  auto position = bucket.end();
+  while (position != bucket.begin() &&
+         task->expirationTime < (*std::prev(position))->expirationTime) {
+    --position;
+  }
+
+  auto& taskRef = *task;
+  taskRef.queuePosition = bucket.insert(position, std::move(task));
+  size_++;
+}
+
+const std::shared_ptr<Task>& SchedulerTaskQueue::top() const {
+  static const auto noTask = std::shared_ptr<Task>{};
+
+  auto index = topBucketIndex();
+  return index == kPriorityCount ? noTask : buckets_[index].front();
+}
+
+void SchedulerTaskQueue::pop() {
+  auto index = topBucketIndex();
+  react_native_assert(index != kPriorityCount && "Queue is empty.");
+
+  auto& bucket = buckets_[index];
+  erase(bucket, bucket.begin());
+}
+
+bool SchedulerTaskQueue::remove(Task& task) {
+  if (!task.queuePosition) {
+    return false;
+  }
+
+  erase(buckets_[bucketIndex(task.priority)], *task.queuePosition);
+  return true;
+}
+
+bool SchedulerTaskQueue::empty() const {
+  return size_ == 0;
+}
+
+size_t SchedulerTaskQueue::size() const {
+  return size_;
+}
+
+void SchedulerTaskQueue::clear() {
+  for (auto& bucket : buckets_) {
+    for (auto& task : bucket) {
+      task->queuePosition.reset();
+    }
+    bucket.clear();
+  }
+  size_ = 0;
+}
+
+/* static */ size_t SchedulerTaskQueue::bucketIndex(
+    SchedulerPriority priority) {
+  auto index = static_cast<size_t>(priority) -
+      static_cast<size_t>(SchedulerPriority::ImmediatePriority);
+  react_native_assert(
+      index < kPriorityCount && "Unsupported SchedulerPriority value");
+  return index;
+}
+
+size_t SchedulerTaskQueue::topBucketIndex() const {
+  auto topIndex = kPriorityCount;
+  for (size_t index = 0; index < kPriorityCount; index++) {
+    const auto& bucket = buckets_[index];
+    if (bucket.empty()) {
+      continue;
+    }
+    if (topIndex == kPriorityCount ||
+        bucket.front()->expirationTime <
+            buckets_[topIndex].front()->expirationTime) {
+      topIndex = index;
+    }
+  }
+  return topIndex;
+}
+
+void SchedulerTaskQueue::erase(
+    TaskList& bucket,
+    TaskList::iterator position) {
+  (*position)->queuePosition.reset();
+  bucket.erase(position);
+  size_--;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <ReactCommon/SchedulerPriority.h>
+#include <react/renderer/runtimescheduler/Task.h>
+
+#include <array>
+#include <memory>
+
+namespace facebook::react {
+
+/*
+ * Queue of scheduled tasks ordered by expiration time.
+ *
+ * Tasks are kept in one list per `SchedulerPriority`. All tasks of a priority
+ * (except idle tasks with custom timeouts) share the same timeout, so a list is
+ * a FIFO in which every task is appended at the end; the top of the queue is
+ * the task with the earliest expiration time among the heads of the lists
+ * (the one with the higher priority on ties). This way a task with a lower
+ * priority is promoted in front of newer tasks with higher priorities once it
+ * expires earlier than them.
+ *
+ * Queued tasks remember their position in the queue, so removing a task (e.g.
+ * when it's cancelled) takes constant time.
+ *
+ * Not thread-safe; synchronization must be enforced externally.
+ */
+class SchedulerTaskQueue final {
+ public:
+  SchedulerTaskQueue() = default;
+
+  /*
+   * Not copyable.
+   */
+  SchedulerTaskQueue(const SchedulerTaskQueue &) = delete;
+  SchedulerTaskQueue &operator=(const SchedulerTaskQueue &) = delete;
+
+  ~SchedulerTaskQueue();
+
+  void push(std::shared_ptr<Task> task);
+
+  /*
+   * Returns the task with the earliest expiration time, or `nullptr` if the
+   * queue is empty.
+   */
+  const std::shared_ptr<Task> &top() const;
+
+  /*
+   * Removes the task returned by `top()`.
+   */
+  void pop();
+
+  /*
+   * Removes the task from the queue in constant time.
+   * Returns `false` if the task is not queued.
+   */
+  bool remove(Task &task);
+
+  bool empty() const;
+
+  size_t size() const;
+
+  void clear();
+
+ private:
+  static constexpr size_t kPriorityCount = 5;
+
+  static size_t bucketIndex(SchedulerPriority priority);
+
+  /*
+   * Returns the index of the list which holds the top task, or
+   * `kPriorityCount` if the queue is empty.
+   */
+  size_t topBucketIndex() const;
+
+  void erase(TaskList &bucket, TaskList::iterator position);
+
+  std::array<TaskList, kPriorityCount> buckets_;
+  size_t size_{0};
+};
+
+} // namespace facebook::react
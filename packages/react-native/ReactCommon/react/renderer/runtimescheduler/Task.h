@@ -10,8 +10,11 @@
 #include <ReactCommon/SchedulerPriority.h>
 #include <jsi/jsi.h>
 #include <react/timing/primitives.h>
+#include <react/utils/PoolAllocator.h>
 
 #include <cstdint>
+#include <list>
+#include <memory>
 #include <optional>
 #include <variant>
 
@@ -21,10 +24,17 @@ namespace facebook::react {
 class RuntimeScheduler_Legacy;
 #endif
 class RuntimeScheduler_Modern;
+class SchedulerTaskQueue;
 class TaskPriorityComparer;
+struct Task;
 
 using RawCallback = std::function<void(jsi::Runtime &)>;
 
+/*
+ * List of tasks of a single priority in `SchedulerTaskQueue`.
+ */
+using TaskList = std::list<std::shared_ptr<Task>, PoolAllocator<std::shared_ptr<Task>>>;
+
 struct Task final : public jsi::NativeState {
   Task(SchedulerPriority priority, jsi::Function &&callback, HighResTimeStamp expirationTime);
 
@@ -35,6 +45,7 @@ struct Task final : public jsi::NativeState {
   friend RuntimeScheduler_Legacy;
 #endif
   friend RuntimeScheduler_Modern;
+  friend SchedulerTaskQueue;
   friend TaskPriorityComparer;
 
   SchedulerPriority priority;
@@ -42,6 +53,11 @@ struct Task final : public jsi::NativeState {
   HighResTimeStamp expirationTime;
   uint64_t id;
 
+  /*
+   * Position of the task in `SchedulerTaskQueue` if the task is queued there.
+   */
+  std::optional<TaskList::iterator> queuePosition;
+
   jsi::Value execute(jsi::Runtime &runtime, bool didUserCallbackTimeout);
 };
 
@@ -424,6 +424,35 @@ TEST_P(RuntimeSchedulerTest, cancelTask) {
   EXPECT_EQ(stubQueue_->size(), 0);
 }
 
+TEST_P(RuntimeSchedulerTest, cancelledTaskIsRemovedFromQueue) {
+  // Only for event loop
+  if (!GetParam()) {
+    return;
+  }
+
+  auto firstTask = runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      [](const jsi::Runtime& /*unused*/) {});
+  auto secondTask = runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      [](const jsi::Runtime& /*unused*/) {});
+
+  EXPECT_TRUE(runtimeScheduler_->getShouldYield());
+  EXPECT_EQ(firstTask.use_count(), 2);
+
+  runtimeScheduler_->cancelTask(*firstTask);
+  runtimeScheduler_->cancelTask(*secondTask);
+
+  // Cancelled tasks don't linger in the queue until they are popped.
+  EXPECT_FALSE(runtimeScheduler_->getShouldYield());
+  EXPECT_EQ(firstTask.use_count(), 1);
+  EXPECT_EQ(secondTask.use_count(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
 TEST_P(RuntimeSchedulerTest, continuationTask) {
   bool didRunTask = false;
   bool didContinuationTask = false;
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/runtimescheduler/SchedulerTaskQueue.h>
+#include <react/renderer/runtimescheduler/Task.h>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using namespace facebook::react;
+using namespace std::chrono_literals;
+
+namespace {
+
+std::shared_ptr<Task> createTask(
+    SchedulerPriority priority,
+    std::chrono::milliseconds expirationTime) {
+  return std::make_shared<Task>(
+      priority,
+      [](facebook::jsi::Runtime& /*runtime*/) {},
+      HighResTimeStamp::fromDOMHighResTimeStamp(
+          static_cast<double>(expirationTime.count())));
+}
+
+std::vector<std::shared_ptr<Task>> popAll(SchedulerTaskQueue& queue) {
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  while (!queue.empty()) {
+    tasks.push_back(queue.top());
+    queue.pop();
+  }
+  return tasks;
+}
+
+} // namespace
+
+TEST(SchedulerTaskQueueTest, emptyQueue) {
+  auto queue = SchedulerTaskQueue{};
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.size(), 0u);
+  EXPECT_EQ(queue.top(), nullptr);
+}
+
+TEST(SchedulerTaskQueueTest, tasksOfSamePriorityAreFirstInFirstOut) {
+  auto queue = SchedulerTaskQueue{};
+  auto first = createTask(SchedulerPriority::NormalPriority, 10ms);
+  auto second = createTask(SchedulerPriority::NormalPriority, 10ms);
+  auto third = createTask(SchedulerPriority::NormalPriority, 10ms);
+
+  queue.push(first);
+  queue.push(second);
+  queue.push(third);
+
+  EXPECT_EQ(queue.size(), 3u);
+  EXPECT_EQ(popAll(queue), (std::vector{first, second, third}));
+}
+
+TEST(SchedulerTaskQueueTest, tasksAreOrderedByExpirationTime) {
+  auto queue = SchedulerTaskQueue{};
+  auto low = createTask(SchedulerPriority::LowPriority, 100ms);
+  auto normal = createTask(SchedulerPriority::NormalPriority, 200ms);
+  auto immediate = createTask(SchedulerPriority::ImmediatePriority, 300ms);
+  auto idle = createTask(SchedulerPriority::IdlePriority, 50ms);
+  auto laterIdle = createTask(SchedulerPriority::IdlePriority, 250ms);
+  auto earlierIdle = createTask(SchedulerPriority::IdlePriority, 150ms);
+
+  queue.push(low);
+  queue.push(normal);
+  queue.push(immediate);
+  queue.push(idle);
+  queue.push(laterIdle);
+  queue.push(earlierIdle);
+
+  EXPECT_EQ(
+      popAll(queue),
+      (std::vector{idle, low, earlierIdle, normal, laterIdle, immediate}));
+}
+
+TEST(SchedulerTaskQueueTest, higherPriorityWinsOnTies) {
+  auto queue = SchedulerTaskQueue{};
+  auto normal = createTask(SchedulerPriority::NormalPriority, 100ms);
+  auto userBlocking = createTask(SchedulerPriority::UserBlockingPriority, 100ms);
+
+  queue.push(normal);
+  queue.push(userBlocking);
+
+  EXPECT_EQ(popAll(queue), (std::vector{userBlocking, normal}));
+}
+
+TEST(SchedulerTaskQueueTest, removeTask) {
+  auto queue = SchedulerTaskQueue{};
+  auto first = createTask(SchedulerPriority::NormalPriority, 10ms);
+  auto second = createTask(SchedulerPriority::NormalPriority, 20ms);
+  auto third = createTask(SchedulerPriority::NormalPriority, 30ms);
+
+  queue.push(first);
+  queue.push(second);
+  queue.push(third);
+
+  EXPECT_TRUE(queue.remove(*second));
+  EXPECT_FALSE(queue.remove(*second));
+  EXPECT_EQ(queue.size(), 2u);
+  EXPECT_EQ(popAll(queue), (std::vector{first, third}));
+
+  // A removed task can be queued again.
+  queue.push(second);
+  EXPECT_EQ(queue.top(), second);
+}
+
+TEST(SchedulerTaskQueueTest, clearReleasesTasks) {
+  auto queue = SchedulerTaskQueue{};
+  auto task = createTask(SchedulerPriority::NormalPriority, 10ms);
+
+  queue.push(task);
+  EXPECT_EQ(task.use_count(), 2);
+
+  queue.clear();
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(task.use_count(), 1);
+  EXPECT_FALSE(queue.remove(*task));
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler_Modern.h>
+#include <react/renderer/runtimescheduler/SchedulerPriorityUtils.h>
+#include <react/renderer/runtimescheduler/SchedulerTaskQueue.h>
+#include <react/renderer/runtimescheduler/Task.h>
+#include <memory>
+#include <queue>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int64_t kBatchSize = 1000;
+
+const SchedulerPriority kPriorities[] = {
+    SchedulerPriority::ImmediatePriority,
+    SchedulerPriority::UserBlockingPriority,
+    SchedulerPriority::NormalPriority,
+    SchedulerPriority::LowPriority,
+    SchedulerPriority::IdlePriority,
+};
+
+SchedulerPriority priorityAt(int64_t index) {
+  return kPriorities[static_cast<size_t>(index) % std::size(kPriorities)];
+}
+
+/*
+ * The event loop is never run, so the scheduler only accumulates and cancels
+ * tasks.
+ */
+std::unique_ptr<RuntimeScheduler_Modern> createRuntimeScheduler() {
+  return std::make_unique<RuntimeScheduler_Modern>(
+      [](std::function<void(jsi::Runtime&)>&& /*callback*/) {},
+      []() { return HighResTimeStamp::now(); },
+      [](jsi::Runtime& /*runtime*/, jsi::JSError& /*error*/) {});
+}
+
+void scheduleTasks(benchmark::State& state) {
+  auto runtimeScheduler = createRuntimeScheduler();
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  tasks.reserve(kBatchSize);
+
+  for (auto _ : state) {
+    for (int64_t i = 0; i < kBatchSize; i++) {
+      tasks.push_back(runtimeScheduler->scheduleTask(
+          priorityAt(i), [](jsi::Runtime& /*runtime*/) {}));
+    }
+
+    state.PauseTiming();
+    for (auto& task : tasks) {
+      runtimeScheduler->cancelTask(*task);
+    }
+    tasks.clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+BENCHMARK(scheduleTasks);
+
+/*
+ * Typical pattern of a list which is virtualized while scrolling: most of the
+ * scheduled work is cancelled before it gets a chance to run.
+ */
+void scheduleAndCancelTasks(benchmark::State& state) {
+  auto runtimeScheduler = createRuntimeScheduler();
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  tasks.reserve(kBatchSize);
+
+  for (auto _ : state) {
+    for (int64_t i = 0; i < kBatchSize; i++) {
+      tasks.push_back(runtimeScheduler->scheduleTask(
+          priorityAt(i), [](jsi::Runtime& /*runtime*/) {}));
+    }
+    for (auto& task : tasks) {
+      runtimeScheduler->cancelTask(*task);
+    }
+    tasks.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize * 2);
+}
+BENCHMARK(scheduleAndCancelTasks);
+
+/*
+ * Compares the queue with the binary heap it replaced. The heap can't remove
+ * cancelled tasks, so they are drained along with the live ones.
+ */
+std::shared_ptr<Task> createTask(int64_t index) {
+  auto priority = priorityAt(index);
+  return std::make_shared<Task>(
+      priority,
+      [](jsi::Runtime& /*runtime*/) {},
+      HighResTimeStamp::now() + timeoutForSchedulerPriority(priority));
+}
+
+void priorityQueuePushCancelPop(benchmark::State& state) {
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  for (int64_t i = 0; i < kBatchSize; i++) {
+    tasks.push_back(createTask(i));
+  }
+
+  for (auto _ : state) {
+    std::priority_queue<
+        std::shared_ptr<Task>,
+        std::vector<std::shared_ptr<Task>>,
+        TaskPriorityComparer>
+        queue;
+    for (const auto& task : tasks) {
+      queue.push(task);
+    }
+    while (!queue.empty()) {
+      benchmark::DoNotOptimize(queue.top().get());
+      queue.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+BENCHMARK(priorityQueuePushCancelPop);
+
+void schedulerTaskQueuePushCancelPop(benchmark::State& state) {
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  for (int64_t i = 0; i < kBatchSize; i++) {
+    tasks.push_back(createTask(i));
+  }
+
+  for (auto _ : state) {
+    SchedulerTaskQueue queue;
+    for (const auto& task : tasks) {
+      queue.push(task);
+    }
+    // Half of the tasks are cancelled.
+    for (size_t i = 0; i < tasks.size(); i += 2) {
+      queue.remove(*tasks[i]);
+    }
+    while (!queue.empty()) {
+      benchmark::DoNotOptimize(queue.top().get());
+      queue.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+BENCHMARK(schedulerTaskQueuePushCancelPop);
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -10,6 +10,7 @@
 #include <cxxreact/TraceSection.h>
 #include <react/debug/react_native_assert.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/renderer/core/PropsInterningCache.h>
 #include <react/renderer/uimanager/UIManager.h>
 
 namespace facebook::react {
@@ -53,6 +54,8 @@ void SurfaceHandler::start() const noexcept {
     parameters = parameters_;
   }
 
+  updatePropsInterning(parameters.layoutContext);
+
   auto shadowTree = std::make_unique<ShadowTree>(
       parameters.surfaceId,
       parameters.layoutConstraints,
@@ -301,6 +304,8 @@ void SurfaceHandler::constraintLayout(
     parameters_.layoutContext = layoutContext;
   }
 
+  updatePropsInterning(layoutContext);
+
   {
     std::shared_lock lock(linkMutex_);
 
@@ -333,6 +338,24 @@ void SurfaceHandler::constraintLayout(
   }
 }
 
+void SurfaceHandler::updatePropsInterning(
+    const LayoutContext& layoutContext) const {
+  if (!parameters_.contextContainer) {
+    return;
+  }
+
+  auto propsInterningCache =
+      parameters_.contextContainer
+          ->find<std::shared_ptr<PropsInterningCache>>(kPropsInterningCacheKey)
+          .value_or(nullptr);
+  if (propsInterningCache) {
+    // Swapping left and right mutates props in place during layout, which
+    // would leak into every node sharing the interned props.
+    propsInterningCache->setSurfaceEnabled(
+        parameters_.surfaceId, !layoutContext.swapLeftAndRightInRTL);
+  }
+}
+
 LayoutConstraints SurfaceHandler::getLayoutConstraints() const noexcept {
   std::shared_lock lock(parametersMutex_);
   return parameters_.layoutConstraints;
@@ -157,6 +157,14 @@ class SurfaceHandler {
   void dirtyMeasurableNodes(ShadowNode &root) const;
   std::shared_ptr<const ShadowNode> dirtyMeasurableNodesRecursive(std::shared_ptr<const ShadowNode> node) const;
 
+  /*
+   * Disables props interning for the surface while it is laid out with
+   * `swapLeftAndRightInRTL`, which mutates props in place. Must only be
+   * called with the surface's own layout context (not with the temporary
+   * one passed to `measure`).
+   */
+  void updatePropsInterning(const LayoutContext &layoutContext) const;
+
 #pragma mark - Link & Parameters
 
   /*
@@ -10,8 +10,9 @@
 #include <react/renderer/attributedstring/AttributedString.h>
 #include <react/renderer/attributedstring/ParagraphAttributes.h>
 #include <react/renderer/core/LayoutConstraints.h>
+#include <react/utils/ContextContainer.h>
 #include <react/utils/FloatComparison.h>
-#include <react/utils/SimpleThreadSafeCache.h>
+#include <react/utils/ShardedThreadSafeCache.h>
 #include <react/utils/hash_combine.h>
 
 namespace facebook::react {
@@ -103,17 +104,35 @@ class PreparedTextCacheKey final {
  */
 constexpr auto kSimpleThreadSafeCacheSizeCap = size_t{1024};
 
+/*
+ * Key of an optional `size_t` value in `ContextContainer` which overrides the
+ * capacity of text measurement caches (e.g. for apps with long text feeds).
+ */
+constexpr auto kTextMeasureCacheCapacityKey = "TextMeasureCacheCapacity";
+
+/*
+ * Returns the capacity of text measurement caches configured via
+ * `ContextContainer` or `kSimpleThreadSafeCacheSizeCap` if not configured.
+ */
+inline size_t getTextMeasureCacheCapacity(const std::shared_ptr<const ContextContainer> &contextContainer)
+{
+  if (contextContainer == nullptr) {
+    return kSimpleThreadSafeCacheSizeCap;
+  }
+  return contextContainer->find<size_t>(kTextMeasureCacheCapacityKey).value_or(kSimpleThreadSafeCacheSizeCap);
+}
+
 /*
  * Thread-safe, evicting hash table designed to store text measurement
- * information.
+ * information. Sharded to let several surfaces measure text concurrently.
  */
-using TextMeasureCache = SimpleThreadSafeCache<TextMeasureCacheKey, TextMeasurement, kSimpleThreadSafeCacheSizeCap>;
+using TextMeasureCache = ShardedThreadSafeCache<TextMeasureCacheKey, TextMeasurement>;
 
 /*
  * Thread-safe, evicting hash table designed to store line measurement
- * information.
+ * information. Sharded to let several surfaces measure text concurrently.
  */
-using LineMeasureCache = SimpleThreadSafeCache<LineMeasureCacheKey, LinesMeasurements, kSimpleThreadSafeCacheSizeCap>;
+using LineMeasureCache = ShardedThreadSafeCache<LineMeasureCacheKey, LinesMeasurements>;
 
 inline bool areTextAttributesEquivalentLayoutWise(const TextAttributes &lhs, const TextAttributes &rhs)
 {
@@ -153,12 +153,22 @@ TextMeasurement doMeasure(
 TextLayoutManager::TextLayoutManager(
     const std::shared_ptr<const ContextContainer>& contextContainer)
     : contextContainer_(std::move(contextContainer)),
-      textMeasureCache_(kSimpleThreadSafeCacheSizeCap),
-      lineMeasureCache_(kSimpleThreadSafeCacheSizeCap),
+      textMeasureCache_(getTextMeasureCacheCapacity(contextContainer_)),
+      lineMeasureCache_(getTextMeasureCacheCapacity(contextContainer_)),
       preparedTextCache_(
           static_cast<size_t>(
               ReactNativeFeatureFlags::preparedTextCacheSize())) {}
 
+ThreadSafeCacheTelemetry TextLayoutManager::getTextMeasureCacheTelemetry()
+    const {
+  return textMeasureCache_.getTelemetry();
+}
+
+ThreadSafeCacheTelemetry TextLayoutManager::getLineMeasureCacheTelemetry()
+    const {
+  return lineMeasureCache_.getTelemetry();
+}
+
 TextMeasurement TextLayoutManager::measure(
     const AttributedStringBox& attributedStringBox,
     const ParagraphAttributes& paragraphAttributes,
@@ -91,11 +91,17 @@ class TextLayoutManager {
       const TextLayoutContext &layoutContext,
       const LayoutConstraints &layoutConstraints) const;
 
+  /*
+   * Returns hit/miss/eviction counters of the text and line measure caches.
+   */
+  ThreadSafeCacheTelemetry getTextMeasureCacheTelemetry() const;
+  ThreadSafeCacheTelemetry getLineMeasureCacheTelemetry() const;
+
  private:
   std::shared_ptr<const ContextContainer> contextContainer_;
   TextMeasureCache textMeasureCache_;
   LineMeasureCache lineMeasureCache_;
-  SimpleThreadSafeCache<PreparedTextCacheKey, PreparedTextLayout, -1 /* Set dynamically*/> preparedTextCache_;
+  ShardedThreadSafeCache<PreparedTextCacheKey, PreparedTextLayout> preparedTextCache_;
 };
 
 } // namespace facebook::react
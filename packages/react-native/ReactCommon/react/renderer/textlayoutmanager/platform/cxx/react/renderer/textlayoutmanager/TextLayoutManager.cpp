@@ -10,8 +10,13 @@
 namespace facebook::react {
 
 TextLayoutManager::TextLayoutManager(
-    const std::shared_ptr<const ContextContainer>& /*contextContainer*/)
-    : textMeasureCache_(kSimpleThreadSafeCacheSizeCap) {}
+    const std::shared_ptr<const ContextContainer>& contextContainer)
+    : textMeasureCache_(getTextMeasureCacheCapacity(contextContainer)) {}
+
+ThreadSafeCacheTelemetry TextLayoutManager::getTextMeasureCacheTelemetry()
+    const {
+  return textMeasureCache_.getTelemetry();
+}
 
 TextMeasurement TextLayoutManager::measure(
     const AttributedStringBox& attributedStringBox,
@@ -49,6 +49,11 @@ class TextLayoutManager {
       const TextLayoutContext &layoutContext,
       const LayoutConstraints &layoutConstraints) const;
 
+  /*
+   * Returns hit/miss/eviction counters of the text measure cache.
+   */
+  ThreadSafeCacheTelemetry getTextMeasureCacheTelemetry() const;
+
  protected:
   std::shared_ptr<const ContextContainer> contextContainer_;
   TextMeasureCache textMeasureCache_;
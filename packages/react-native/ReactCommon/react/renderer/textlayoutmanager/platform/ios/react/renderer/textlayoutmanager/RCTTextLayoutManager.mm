@@ -15,12 +15,20 @@
 #import <React/RCTUtils.h>
 #import <react/featureflags/ReactNativeFeatureFlags.h>
 #import <react/utils/ManagedObjectWrapper.h>
-#import <react/utils/SimpleThreadSafeCache.h>
+#import <react/utils/ShardedThreadSafeCache.h>
 
 using namespace facebook::react;
 
 @implementation RCTTextLayoutManager {
-  SimpleThreadSafeCache<AttributedString, std::shared_ptr<void>, 256> _cache;
+  std::unique_ptr<ShardedThreadSafeCache<AttributedString, std::shared_ptr<void>>> _cache;
+}
+
+- (instancetype)init
+{
+  if (self = [super init]) {
+    _cache = std::make_unique<ShardedThreadSafeCache<AttributedString, std::shared_ptr<void>>>(256);
+  }
+  return self;
 }
 
 static NSLineBreakMode RCTNSLineBreakModeFromEllipsizeMode(EllipsizeMode ellipsizeMode)
@@ -459,7 +467,7 @@ static NSLineBreakMode RCTNSLineBreakModeFromEllipsizeMode(EllipsizeMode ellipsi
 
 - (NSAttributedString *)_nsAttributedStringFromAttributedString:(AttributedString)attributedString
 {
-  auto sharedNSAttributedString = _cache.get(attributedString, [&]() {
+  auto sharedNSAttributedString = _cache->get(attributedString, [&]() {
     return wrapManagedObject(RCTNSAttributedStringFromAttributedString(attributedString));
   });
 
@@ -61,6 +61,12 @@ class TextLayoutManager {
    */
   std::shared_ptr<void> getNativeTextLayoutManager() const;
 
+  /*
+   * Returns hit/miss/eviction counters of the text and line measure caches.
+   */
+  ThreadSafeCacheTelemetry getTextMeasureCacheTelemetry() const;
+  ThreadSafeCacheTelemetry getLineMeasureCacheTelemetry() const;
+
  protected:
   std::shared_ptr<const ContextContainer> contextContainer_;
   std::shared_ptr<void> nativeTextLayoutManager_;
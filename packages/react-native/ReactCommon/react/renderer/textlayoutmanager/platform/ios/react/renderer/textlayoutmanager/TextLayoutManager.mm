@@ -14,7 +14,9 @@
 
 namespace facebook::react {
 
-TextLayoutManager::TextLayoutManager(const std::shared_ptr<const ContextContainer> & /*contextContainer*/)
+TextLayoutManager::TextLayoutManager(const std::shared_ptr<const ContextContainer> &contextContainer)
+    : textMeasureCache_(getTextMeasureCacheCapacity(contextContainer)),
+      lineMeasureCache_(getTextMeasureCacheCapacity(contextContainer))
 {
   nativeTextLayoutManager_ = wrapManagedObject([RCTTextLayoutManager new]);
 }
@@ -25,6 +27,16 @@ std::shared_ptr<void> TextLayoutManager::getNativeTextLayoutManager() const
   return nativeTextLayoutManager_;
 }
 
+ThreadSafeCacheTelemetry TextLayoutManager::getTextMeasureCacheTelemetry() const
+{
+  return textMeasureCache_.getTelemetry();
+}
+
+ThreadSafeCacheTelemetry TextLayoutManager::getLineMeasureCacheTelemetry() const
+{
+  return lineMeasureCache_.getTelemetry();
+}
+
 TextMeasurement TextLayoutManager::measure(
     const AttributedStringBox &attributedStringBox,
     const ParagraphAttributes &paragraphAttributes,
@@ -276,6 +276,11 @@ ShadowTree::Unique UIManager::stopSurface(SurfaceId surfaceId) const {
   // Stop any ongoing layout animations.
   stopSurfaceForAnimationDelegate(surfaceId);
 
+  {
+    std::scoped_lock lock(hitTestIndicesMutex_);
+    hitTestIndices_.erase(surfaceId);
+  }
+
   // Waiting for all concurrent commits to be finished and unregistering the
   // `ShadowTree`.
   auto shadowTree = getShadowTreeRegistry().remove(surfaceId);
@@ -352,8 +357,31 @@ ShadowTreeRevisionProvider* UIManager::getShadowTreeRevisionProvider() {
 std::shared_ptr<const ShadowNode> UIManager::findNodeAtPoint(
     const std::shared_ptr<const ShadowNode>& node,
     Point point) const {
-  return LayoutableShadowNode::findNodeAtPoint(
-      getNewestCloneOfShadowNode(*node), point);
+  auto surfaceId = node->getSurfaceId();
+  auto rootShadowNode = std::shared_ptr<const ShadowNode>{};
+  shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
+    rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+  });
+
+  auto newestCloneOfShadowNode = getShadowNodeInSubtree(*node, rootShadowNode);
+  if (newestCloneOfShadowNode == nullptr) {
+    return nullptr;
+  }
+
+  // The index of a surface is reused until the surface commits again.
+  auto hitTestIndex = std::shared_ptr<const HitTestIndex>{};
+  {
+    std::scoped_lock lock(hitTestIndicesMutex_);
+    auto& surfaceHitTestIndex = hitTestIndices_[surfaceId];
+    if (surfaceHitTestIndex == nullptr ||
+        surfaceHitTestIndex->getRootShadowNode() != rootShadowNode) {
+      surfaceHitTestIndex =
+          std::make_shared<const HitTestIndex>(rootShadowNode);
+    }
+    hitTestIndex = surfaceHitTestIndex;
+  }
+
+  return hitTestIndex->findNodeAtPoint(newestCloneOfShadowNode, point);
 }
 
 LayoutMetrics UIManager::getRelativeLayoutMetrics(
@@ -642,6 +670,13 @@ void UIManager::shadowTreeDidFinishTransaction(
     bool mountSynchronously) const {
   TraceSection s("UIManager::shadowTreeDidFinishTransaction");
 
+  // The index retains the whole previous revision; drop it as soon as that
+  // revision is superseded instead of waiting for the next hit test.
+  {
+    std::scoped_lock lock(hitTestIndicesMutex_);
+    hitTestIndices_.erase(mountingCoordinator->getSurfaceId());
+  }
+
   if (delegate_ != nullptr) {
     delegate_->uiManagerDidFinishTransaction(
         std::move(mountingCoordinator), mountSynchronously);
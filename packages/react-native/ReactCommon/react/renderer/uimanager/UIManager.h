@@ -11,10 +11,13 @@
 #include <jsi/jsi.h>
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 
 #include <react/renderer/componentregistry/ComponentDescriptorRegistry.h>
 #include <react/renderer/consistency/ShadowTreeRevisionConsistencyManager.h>
+#include <react/renderer/core/HitTestIndex.h>
 #include <react/renderer/core/InstanceHandle.h>
 #include <react/renderer/core/RawValue.h>
 #include <react/renderer/core/ShadowNode.h>
@@ -261,6 +264,11 @@ class UIManager final : public ShadowTreeDelegate {
   mutable std::shared_mutex mountHookMutex_;
   mutable std::vector<UIManagerMountHook *> mountHooks_;
 
+  // Hit-testing indices of the current revision of each surface. An entry
+  // retains its revision, so it is erased as soon as the surface commits.
+  mutable std::mutex hitTestIndicesMutex_;
+  mutable std::unordered_map<SurfaceId, std::shared_ptr<const HitTestIndex>> hitTestIndices_;
+
   std::unique_ptr<LeakChecker> leakChecker_;
 
   std::unique_ptr<LazyShadowTreeRevisionConsistencyManager> lazyShadowTreeRevisionConsistencyManager_;
@@ -61,7 +61,7 @@ inline static std::shared_ptr<std::vector<std::shared_ptr<const ShadowNode>>> sh
     auto jsArray = std::move(object).asArray(runtime);
     size_t jsArrayLen = jsArray.length(runtime);
     if (jsArrayLen > 0) {
-      auto shadowNodeArray = std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>();
+      auto shadowNodeArray = ShadowNode::makeSharedChildren();
       shadowNodeArray->reserve(jsArrayLen);
 
       for (size_t i = 0; i < jsArrayLen; i++) {
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <react/utils/PoolAllocator.h>
+
+namespace facebook::react {
+
+/*
+ * Unbounded multi-producer queue which is consumed in batches.
+ *
+ * Producers push onto an intrusive stack with a single compare-and-swap; a
+ * consumer detaches the whole stack with a single exchange and restores the
+ * FIFO order. Because items are never popped one by one, the queue is free of
+ * the ABA problem and several consumers may drain it concurrently (each one
+ * receives a disjoint batch).
+ * Nodes are allocated from `PoolAllocator`, so a steady stream of items does
+ * not hit the heap. Linking and detaching nodes is lock-free, but allocating
+ * and freeing them is only mostly so: `PoolAllocator` takes a mutex when a
+ * thread's cache has to be refilled from, or spilled to, the shared pool.
+ */
+template <typename T>
+class MPSCQueue final {
+ public:
+  MPSCQueue() = default;
+
+  MPSCQueue(const MPSCQueue &) = delete;
+  MPSCQueue &operator=(const MPSCQueue &) = delete;
+
+  ~MPSCQueue()
+  {
+    deleteNodes(head_.exchange(nullptr, std::memory_order_acquire));
+  }
+
+  /*
+   * Adds an item to the queue.
+   * Can be called on any thread.
+   */
+  void push(T &&value) const
+  {
+    auto allocator = NodeAllocator{};
+    auto node = NodeAllocatorTraits::allocate(allocator, 1);
+    NodeAllocatorTraits::construct(allocator, node, std::move(value));
+
+    node->next = head_.load(std::memory_order_relaxed);
+    while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+  }
+
+  /*
+   * Returns `true` if there are no items in the queue at the moment of the
+   * call.
+   * Can be called on any thread.
+   */
+  bool empty() const
+  {
+    return head_.load(std::memory_order_relaxed) == nullptr;
+  }
+
+  /*
+   * Removes all items from the queue and returns them in the order they were
+   * pushed in.
+   * Can be called on any thread.
+   */
+  std::vector<T> drain() const
+  {
+    auto node = head_.exchange(nullptr, std::memory_order_acquire);
+    if (node == nullptr) {
+      return {};
+    }
+
+    // Reversing the stack gives the FIFO order.
+    Node *first = nullptr;
+    size_t size = 0;
+    while (node != nullptr) {
+      auto next = node->next;
+      node->next = first;
+      first = node;
+      node = next;
+      size++;
+    }
+
+    auto result = std::vector<T>{};
+    result.reserve(size);
+    for (auto it = first; it != nullptr; it = it->next) {
+      result.push_back(std::move(it->value));
+    }
+
+    deleteNodes(first);
+    return result;
+  }
+
+ private:
+  struct Node {
+    explicit Node(T &&value) : value(std::move(value)) {}
+
+    T value;
+    Node *next{nullptr};
+  };
+
+  using NodeAllocator = PoolAllocator<Node>;
+  using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+  static void deleteNodes(Node *node) noexcept
+  {
+    auto allocator = NodeAllocator{};
+    while (node != nullptr) {
+      auto next = node->next;
+      NodeAllocatorTraits::destroy(allocator, node);
+      NodeAllocatorTraits::deallocate(allocator, node, 1);
+      node = next;
+    }
+  }
+
+  mutable std::atomic<Node *> head_{nullptr};
+};
+
+} // namespace facebook::react
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PoolAllocator.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kGranularity = alignof(std::max_align_t);
+constexpr size_t kSizeClassCount = kPoolAllocatorMaxBlockSize / kGranularity;
+
+// Free blocks a thread keeps per size class before handing half of them back
+// to the shared free list.
+constexpr size_t kThreadCacheCapacity = 64;
+
+// Free blocks the shared free list of a size class retains; the rest are
+// returned to the heap.
+constexpr size_t kSharedFreeListCapacity = 4096;
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+struct FreeList {
+  FreeBlock* head{nullptr};
+  size_t size{0};
+
+  void push(FreeBlock* block) {
+    block->next = head;
+    head = block;
+    size++;
+  }
+
+  FreeBlock* pop() {
+    auto block = head;
+    head = block->next;
+    size--;
+    return block;
+  }
+};
+
+struct SizeClass {
+  std::mutex mutex;
+  FreeList freeList;
+  std::atomic<size_t> allocations{0};
+  std::atomic<size_t> reusedAllocations{0};
+  std::atomic<size_t> deallocations{0};
+};
+
+size_t blockSize(size_t sizeClassIndex) {
+  return (sizeClassIndex + 1) * kGranularity;
+}
+
+size_t sizeClassIndex(size_t size) {
+  return size == 0 ? 0 : (size - 1) / kGranularity;
+}
+
+std::array<SizeClass, kSizeClassCount>& sizeClasses() {
+  // Leaked on purpose: thread caches flush into it when their threads exit,
+  // which may happen after static destructors ran.
+  static auto& sizeClasses = *new std::array<SizeClass, kSizeClassCount>();
+  return sizeClasses;
+}
+
+// Moves up to `count` blocks from `from` to `to`.
+void transferBlocks(FreeList& from, FreeList& to, size_t count) {
+  while (count-- > 0 && from.head != nullptr) {
+    to.push(from.pop());
+  }
+}
+
+// Hands `count` blocks of `freeList` to the shared free list of a size class,
+// freeing whatever does not fit there.
+void releaseBlocks(size_t index, FreeList& freeList, size_t count) {
+  auto& sizeClass = sizeClasses()[index];
+  {
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    auto available = kSharedFreeListCapacity - sizeClass.freeList.size;
+    transferBlocks(freeList, sizeClass.freeList, std::min(count, available));
+    count -= std::min(count, available);
+  }
+
+  while (count-- > 0 && freeList.head != nullptr) {
+    ::operator delete(freeList.pop());
+  }
+}
+
+// Set once the thread cache of the current thread is destroyed; blocks freed
+// by later thread-local destructors bypass it.
+thread_local bool threadCacheDestroyed{false}; // NOLINT
+
+struct ThreadCache {
+  std::array<FreeList, kSizeClassCount> freeLists;
+
+  ~ThreadCache() {
+    threadCacheDestroyed = true;
+    for (size_t index = 0; index < kSizeClassCount; index++) {
+      releaseBlocks(index, freeLists[index], freeLists[index].size);
+    }
+  }
+};
+
+thread_local ThreadCache threadCache; // NOLINT
+
+} // namespace
+
+void* allocatePooledBlock(size_t size) {
+  auto index = sizeClassIndex(size);
+  auto& sizeClass = sizeClasses()[index];
+  sizeClass.allocations.fetch_add(1, std::memory_order_relaxed);
+
+  if (threadCacheDestroyed) {
+    return ::operator new(blockSize(index));
+  }
+
+  auto& freeList = threadCache.freeLists[index];
+  if (freeList.head == nullptr) {
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    transferBlocks(sizeClass.freeList, freeList, kThreadCacheCapacity / 2);
+  }
+
+  if (freeList.head == nullptr) {
+    return ::operator new(blockSize(index));
+  }
+
+  sizeClass.reusedAllocations.fetch_add(1, std::memory_order_relaxed);
+  return freeList.pop();
+}
+
+void deallocatePooledBlock(void* block, size_t size) noexcept {
+  auto index = sizeClassIndex(size);
+  sizeClasses()[index].deallocations.fetch_add(1, std::memory_order_relaxed);
+
+  if (threadCacheDestroyed) {
+    auto freeList = FreeList{};
+    freeList.push(static_cast<FreeBlock*>(block));
+    releaseBlocks(index, freeList, 1);
+    return;
+  }
+
+  auto& freeList = threadCache.freeLists[index];
+  freeList.push(static_cast<FreeBlock*>(block));
+  if (freeList.size > kThreadCacheCapacity) {
+    releaseBlocks(index, freeList, kThreadCacheCapacity / 2);
+  }
+}
+
+void releasePooledBlocks() noexcept {
+  for (auto& sizeClass : sizeClasses()) {
+    auto freeList = FreeList{};
+    {
+      std::lock_guard<std::mutex> lock(sizeClass.mutex);
+      std::swap(freeList, sizeClass.freeList);
+    }
+    while (freeList.head != nullptr) {
+      ::operator delete(freeList.pop());
+    }
+  }
+}
+
+PoolAllocatorTelemetry getPoolAllocatorTelemetry() {
+  auto telemetry = PoolAllocatorTelemetry{};
+  for (auto& sizeClass : sizeClasses()) {
+    telemetry.allocations +=
+        sizeClass.allocations.load(std::memory_order_relaxed);
+    telemetry.reusedAllocations +=
+        sizeClass.reusedAllocations.load(std::memory_order_relaxed);
+    telemetry.deallocations +=
+        sizeClass.deallocations.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    telemetry.retainedBlocks += sizeClass.freeList.size;
+  }
+  return telemetry;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace facebook::react {
+
+/*
+ * Cumulative counters of all size-class pools.
+ */
+struct PoolAllocatorTelemetry {
+  /*
+   * Number of blocks handed out, and how many of those were recycled from a
+   * free list instead of being allocated on the heap.
+   */
+  size_t allocations{0};
+  size_t reusedAllocations{0};
+  size_t deallocations{0};
+
+  /*
+   * Number of free blocks currently retained in the shared free lists. Blocks
+   * cached by individual threads are not included.
+   */
+  size_t retainedBlocks{0};
+};
+
+/*
+ * Largest block size served from the pools; bigger requests go to the heap.
+ */
+constexpr size_t kPoolAllocatorMaxBlockSize = 2048;
+
+/*
+ * Returns a block of at least `size` bytes, aligned to
+ * `alignof(std::max_align_t)`, recycling a block of the same size class if one
+ * is available. `size` must not exceed `kPoolAllocatorMaxBlockSize`.
+ * Can be called from any thread.
+ */
+void *allocatePooledBlock(size_t size);
+
+/*
+ * Returns a block obtained from `allocatePooledBlock` with the same `size` to
+ * its size-class pool. Can be called from any thread, not necessarily the one
+ * which allocated the block.
+ */
+void deallocatePooledBlock(void *block, size_t size) noexcept;
+
+/*
+ * Frees all blocks retained in the shared free lists (e.g. on memory warning).
+ */
+void releasePooledBlocks() noexcept;
+
+PoolAllocatorTelemetry getPoolAllocatorTelemetry();
+
+/*
+ * Stateless allocator which serves single objects from process-wide free lists
+ * grouped by size class (rounded up to `alignof(std::max_align_t)`).
+ *
+ * Intended for `std::allocate_shared` of objects which are created and
+ * destroyed at a high rate, such as shadow nodes: the control block and the
+ * object share one block, and every type (after rebinding to the control
+ * block type) maps to its own size class. Each thread keeps a small cache of
+ * free blocks per size class, so most allocations do not take a lock.
+ */
+template <typename T>
+class PoolAllocator {
+ public:
+  using value_type = T;
+
+  PoolAllocator() noexcept = default;
+
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U> & /*other*/) noexcept
+  {
+  }
+
+  T *allocate(size_t n)
+  {
+    if (n == 1 && isPoolable) {
+      return static_cast<T *>(allocatePooledBlock(sizeof(T)));
+    }
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T *pointer, size_t n) noexcept
+  {
+    if (n == 1 && isPoolable) {
+      deallocatePooledBlock(pointer, sizeof(T));
+      return;
+    }
+    std::allocator<T>{}.deallocate(pointer, n);
+  }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U> & /*rhs*/) const noexcept
+  {
+    return true;
+  }
+
+ private:
+  static constexpr bool isPoolable =
+      sizeof(T) <= kPoolAllocatorMaxBlockSize && alignof(T) <= alignof(std::max_align_t);
+};
+
+} // namespace facebook::react
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <react/utils/SimpleThreadSafeCache.h>
+
+namespace facebook::react {
+
+/*
+ * Cumulative counters describing how effective a thread-safe cache is.
+ */
+struct ThreadSafeCacheTelemetry {
+  size_t hits{0};
+  size_t misses{0};
+  size_t evictions{0};
+  size_t size{0};
+  size_t capacity{0};
+};
+
+/*
+ * Thread-safe LRU cache split into independently locked shards.
+ *
+ * A key is assigned to a shard by its hash, so concurrent lookups of different
+ * keys rarely contend on the same mutex. Every shard evicts its own least
+ * recently used entry once it holds more than its share of `capacity` (the
+ * shares add up to exactly `capacity`), which approximates an LRU policy for
+ * the cache as a whole.
+ * The hash of a key is computed once per lookup and shared between shard
+ * selection and the shard's own hash table.
+ */
+template <typename KeyT, typename ValueT>
+class ShardedThreadSafeCache {
+ public:
+  static constexpr size_t kDefaultShardCount = 16;
+
+  explicit ShardedThreadSafeCache(size_t capacity, size_t shardCount = kDefaultShardCount)
+      : capacity_(std::max<size_t>(capacity, 1)), shards_(std::clamp<size_t>(shardCount, 1, capacity_))
+  {
+    // Spread the remainder over the first shards, so that the total capacity
+    // of the shards is exactly `capacity`.
+    auto shardCapacity = capacity_ / shards_.size();
+    auto remainder = capacity_ % shards_.size();
+    for (size_t index = 0; index < shards_.size(); index++) {
+      shards_[index].capacity = shardCapacity + (index < remainder ? 1 : 0);
+    }
+  }
+
+  /*
+   * Not copyable, not movable.
+   */
+  ShardedThreadSafeCache(const ShardedThreadSafeCache &) = delete;
+  ShardedThreadSafeCache &operator=(const ShardedThreadSafeCache &) = delete;
+
+  /*
+   * Returns a value from the cache with a given key.
+   * If the value wasn't found in the cache, constructs the value using given
+   * generator function, stores it inside a cache and returns it.
+   * The generator runs under the lock of the key's shard only.
+   * Can be called from any thread.
+   */
+  ValueT get(const KeyT &key, CacheGeneratorFunction<ValueT> auto generator) const
+  {
+    auto hash = std::hash<KeyT>{}(key);
+    auto &shard = shardForHash(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.getOrGenerate(key, hash, std::move(generator))->value;
+  }
+
+  /*
+   * Returns pointers to both the key and value from the cache with a given
+   * key. If the value wasn't found in the cache, constructs the value using
+   * given generator function, stores it inside a cache and returns it.
+   * Can be called from any thread.
+   */
+  std::pair<const KeyT *, const ValueT *> getWithKey(const KeyT &key, CacheGeneratorFunction<ValueT> auto generator)
+      const
+  {
+    auto hash = std::hash<KeyT>{}(key);
+    auto &shard = shardForHash(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.getOrGenerate(key, hash, std::move(generator));
+    return std::make_pair(&it->key, &it->value);
+  }
+
+  /*
+   * Returns a value from the cache with a given key.
+   * If the value wasn't found in the cache, returns a default-constructed
+   * value, like `SimpleThreadSafeCache::get`.
+   * Can be called from any thread.
+   */
+  std::optional<ValueT> get(const KeyT &key) const
+  {
+    auto hash = std::hash<KeyT>{}(key);
+    auto &shard = shardForHash(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    if (auto it = shard.find(key, hash); it != shard.list.end()) {
+      shard.hits++;
+      return it->value;
+    }
+
+    shard.misses++;
+    return ValueT{};
+  }
+
+  /*
+   * Removes all entries from the cache. Counters are preserved.
+   * Can be called from any thread.
+   */
+  void clear() const
+  {
+    for (auto &shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.evictions += shard.list.size();
+      shard.map.clear();
+      shard.list.clear();
+    }
+  }
+
+  /*
+   * Returns the aggregated counters of all shards.
+   * Can be called from any thread.
+   */
+  ThreadSafeCacheTelemetry getTelemetry() const
+  {
+    auto telemetry = ThreadSafeCacheTelemetry{.capacity = capacity_};
+    for (auto &shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      telemetry.hits += shard.hits;
+      telemetry.misses += shard.misses;
+      telemetry.evictions += shard.evictions;
+      telemetry.size += shard.list.size();
+    }
+    return telemetry;
+  }
+
+  size_t getCapacity() const
+  {
+    return capacity_;
+  }
+
+ private:
+  struct Entry {
+    KeyT key;
+    ValueT value;
+    size_t hash;
+  };
+
+  /*
+   * Key of the shard's hash table: points to the key stored in the list entry
+   * (or to the key being looked up) and carries its precomputed hash.
+   */
+  struct HashedKey {
+    const KeyT *key;
+    size_t hash;
+
+    bool operator==(const HashedKey &rhs) const
+    {
+      return hash == rhs.hash && *key == *rhs.key;
+    }
+  };
+
+  struct HashedKeyHasher {
+    size_t operator()(const HashedKey &hashedKey) const
+    {
+      return hashedKey.hash;
+    }
+  };
+
+  using iterator = typename std::list<Entry>::iterator;
+
+  struct Shard {
+    std::mutex mutex;
+    std::list<Entry> list;
+    std::unordered_map<HashedKey, iterator, HashedKeyHasher> map;
+    size_t capacity{0};
+    size_t hits{0};
+    size_t misses{0};
+    size_t evictions{0};
+
+    iterator find(const KeyT &key, size_t hash)
+    {
+      auto it = map.find(HashedKey{.key = &key, .hash = hash});
+      if (it == map.end()) {
+        return list.end();
+      }
+
+      // Move accessed item to front of list
+      list.splice(list.begin(), list, it->second);
+      return it->second;
+    }
+
+    iterator getOrGenerate(const KeyT &key, size_t hash, CacheGeneratorFunction<ValueT> auto generator)
+    {
+      if (auto it = find(key, hash); it != list.end()) {
+        hits++;
+        return it;
+      }
+
+      misses++;
+      list.emplace_front(Entry{.key = key, .value = generator(), .hash = hash});
+      map.emplace(HashedKey{.key = &list.front().key, .hash = hash}, list.begin());
+
+      if (list.size() > capacity) {
+        // Evict least recently used item (back of list)
+        auto &back = list.back();
+        map.erase(HashedKey{.key = &back.key, .hash = back.hash});
+        list.pop_back();
+        evictions++;
+      }
+
+      return list.begin();
+    }
+  };
+
+  Shard &shardForHash(size_t hash) const
+  {
+    // Mix the upper bits in so that hashes which only differ there (e.g.
+    // results of `hash_combine`) still spread across shards.
+    return shards_[(hash ^ (hash >> (sizeof(size_t) * 4))) % shards_.size()];
+  }
+
+  const size_t capacity_;
+  mutable std::vector<Shard> shards_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/utils/MPSCQueue.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+TEST(MPSCQueueTest, DrainsItemsInPushOrder) {
+  auto queue = MPSCQueue<std::string>{};
+  EXPECT_TRUE(queue.empty());
+
+  queue.push("first");
+  queue.push("second");
+  queue.push("third");
+  EXPECT_FALSE(queue.empty());
+
+  auto items = queue.drain();
+  EXPECT_EQ(items, (std::vector<std::string>{"first", "second", "third"}));
+  EXPECT_TRUE(queue.empty());
+  EXPECT_TRUE(queue.drain().empty());
+}
+
+TEST(MPSCQueueTest, DestroysPendingItems) {
+  auto item = std::make_shared<int>(42);
+  {
+    auto queue = MPSCQueue<std::shared_ptr<int>>{};
+    queue.push(std::shared_ptr<int>(item));
+    EXPECT_EQ(item.use_count(), 2);
+  }
+  EXPECT_EQ(item.use_count(), 1);
+}
+
+TEST(MPSCQueueTest, KeepsOrderOfEveryProducer) {
+  constexpr int kProducerCount = 4;
+  constexpr int kItemsPerProducer = 10000;
+
+  auto queue = MPSCQueue<std::pair<int, int>>{};
+  auto items = std::vector<std::pair<int, int>>{};
+
+  auto producers = std::vector<std::thread>{};
+  for (int producer = 0; producer < kProducerCount; producer++) {
+    producers.emplace_back([&queue, producer] {
+      for (int item = 0; item < kItemsPerProducer; item++) {
+        queue.push({producer, item});
+      }
+    });
+  }
+
+  while (items.size() < kProducerCount * kItemsPerProducer) {
+    auto batch = queue.drain();
+    items.insert(
+        items.end(),
+        std::make_move_iterator(batch.begin()),
+        std::make_move_iterator(batch.end()));
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  auto nextItems = std::vector<int>(kProducerCount, 0);
+  for (const auto& [producer, item] : items) {
+    EXPECT_EQ(item, nextItems[producer]++);
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+} // namespace facebook::react
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/utils/PoolAllocator.h>
+
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+struct Payload {
+  std::array<int, 20> values{};
+};
+
+} // namespace
+
+TEST(PoolAllocatorTest, RecyclesFreedBlocks) {
+  auto allocator = PoolAllocator<Payload>{};
+  auto first = allocator.allocate(1);
+  allocator.deallocate(first, 1);
+
+  auto before = getPoolAllocatorTelemetry();
+  auto second = allocator.allocate(1);
+  auto after = getPoolAllocatorTelemetry();
+
+  EXPECT_EQ(second, first);
+  EXPECT_EQ(after.allocations - before.allocations, 1u);
+  EXPECT_EQ(after.reusedAllocations - before.reusedAllocations, 1u);
+  allocator.deallocate(second, 1);
+}
+
+TEST(PoolAllocatorTest, AllocateShared) {
+  auto before = getPoolAllocatorTelemetry();
+  {
+    auto payload =
+        std::allocate_shared<Payload>(PoolAllocator<Payload>{}, Payload{});
+    payload->values[19] = 42;
+    EXPECT_EQ(payload->values[19], 42);
+  }
+  auto after = getPoolAllocatorTelemetry();
+
+  EXPECT_EQ(after.allocations - before.allocations, 1u);
+  EXPECT_EQ(after.deallocations - before.deallocations, 1u);
+}
+
+TEST(PoolAllocatorTest, ArraysBypassThePool) {
+  auto allocator = PoolAllocator<Payload>{};
+  auto before = getPoolAllocatorTelemetry();
+  auto payloads = allocator.allocate(4);
+  allocator.deallocate(payloads, 4);
+  auto after = getPoolAllocatorTelemetry();
+
+  EXPECT_EQ(after.allocations, before.allocations);
+  EXPECT_EQ(after.deallocations, before.deallocations);
+}
+
+TEST(PoolAllocatorTest, BlocksCanBeFreedOnAnotherThread) {
+  auto allocator = PoolAllocator<Payload>{};
+  auto payloads = std::vector<Payload*>{};
+  for (int i = 0; i < 1000; i++) {
+    payloads.push_back(allocator.allocate(1));
+  }
+
+  std::thread([&]() {
+    for (auto payload : payloads) {
+      allocator.deallocate(payload, 1);
+    }
+  }).join();
+
+  // The exiting thread handed its cached blocks to the shared free list.
+  EXPECT_GT(getPoolAllocatorTelemetry().retainedBlocks, 0u);
+
+  auto before = getPoolAllocatorTelemetry();
+  allocator.deallocate(allocator.allocate(1), 1);
+  auto after = getPoolAllocatorTelemetry();
+  EXPECT_EQ(after.reusedAllocations - before.reusedAllocations, 1u);
+
+  releasePooledBlocks();
+  EXPECT_EQ(getPoolAllocatorTelemetry().retainedBlocks, 0u);
+}
+
+} // namespace facebook::react
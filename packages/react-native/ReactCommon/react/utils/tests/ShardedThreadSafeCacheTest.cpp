@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/utils/ShardedThreadSafeCache.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+TEST(ShardedThreadSafeCacheTest, BasicInsertAndGet) {
+  ShardedThreadSafeCache<int, std::string> cache{16};
+  EXPECT_EQ(cache.get(1), std::string{});
+
+  cache.get(1, []() { return std::string("one"); });
+  cache.get(2, []() { return std::string("two"); });
+  EXPECT_EQ(cache.get(1), "one");
+  EXPECT_EQ(cache.get(2), "two");
+
+  auto [key, value] =
+      cache.getWithKey(2, []() { return std::string("unused"); });
+  EXPECT_EQ(*key, 2);
+  EXPECT_EQ(*value, "two");
+}
+
+TEST(ShardedThreadSafeCacheTest, GeneratorIsCalledOnlyOnMiss) {
+  ShardedThreadSafeCache<int, int> cache{16};
+  int calls = 0;
+  auto generator = [&]() { return ++calls; };
+
+  EXPECT_EQ(cache.get(1, generator), 1);
+  EXPECT_EQ(cache.get(1, generator), 1);
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(ShardedThreadSafeCacheTest, EvictionWithinSingleShard) {
+  ShardedThreadSafeCache<int, std::string> cache{2, 1};
+  cache.get(1, []() { return std::string("one"); });
+  cache.get(2, []() { return std::string("two"); });
+  cache.get(1); // key 1 becomes the most recently used one
+  cache.get(3, []() { return std::string("three"); }); // should evict key 2
+
+  EXPECT_EQ(cache.get(1), "one");
+  EXPECT_EQ(cache.get(2), std::string{});
+  EXPECT_EQ(cache.get(3), "three");
+}
+
+TEST(ShardedThreadSafeCacheTest, Telemetry) {
+  ShardedThreadSafeCache<int, int> cache{4, 1};
+  for (int i = 0; i < 6; i++) {
+    cache.get(i, [=]() { return i; });
+  }
+  cache.get(5, []() { return 0; });
+
+  auto telemetry = cache.getTelemetry();
+  EXPECT_EQ(telemetry.hits, 1);
+  EXPECT_EQ(telemetry.misses, 6);
+  EXPECT_EQ(telemetry.evictions, 2);
+  EXPECT_EQ(telemetry.size, 4);
+  EXPECT_EQ(telemetry.capacity, 4);
+
+  cache.clear();
+  telemetry = cache.getTelemetry();
+  EXPECT_EQ(telemetry.size, 0);
+  EXPECT_EQ(telemetry.evictions, 6);
+}
+
+TEST(ShardedThreadSafeCacheTest, CapacityIsNeverExceeded) {
+  ShardedThreadSafeCache<int, int> cache{64, 8};
+  for (int i = 0; i < 1000; i++) {
+    cache.get(i, [=]() { return i; });
+  }
+
+  auto telemetry = cache.getTelemetry();
+  EXPECT_LE(telemetry.size, 64);
+  EXPECT_EQ(telemetry.size + telemetry.evictions, 1000);
+}
+
+TEST(ShardedThreadSafeCacheTest, CapacityIsNeverExceededWithUnevenShards) {
+  ShardedThreadSafeCache<int, int> cache{100, 16};
+  for (int i = 0; i < 1000; i++) {
+    cache.get(i, [=]() { return i; });
+  }
+
+  auto telemetry = cache.getTelemetry();
+  EXPECT_LE(telemetry.size, 100);
+  EXPECT_EQ(telemetry.capacity, 100);
+  EXPECT_EQ(telemetry.size + telemetry.evictions, 1000);
+}
+
+TEST(ShardedThreadSafeCacheTest, ConcurrentAccess) {
+  ShardedThreadSafeCache<int, int> cache{256};
+  auto threads = std::vector<std::thread>{};
+  for (int t = 0; t < 8; t++) {
+    threads.emplace_back([&]() {
+      for (int i = 0; i < 10000; i++) {
+        auto key = i % 512;
+        EXPECT_EQ(cache.get(key, [=]() { return key * 2; }), key * 2);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto telemetry = cache.getTelemetry();
+  EXPECT_EQ(telemetry.hits + telemetry.misses, 80000);
+}
+
+} // namespace facebook::react
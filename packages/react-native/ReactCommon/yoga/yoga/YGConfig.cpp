@@ -5,6 +5,8 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <limits>
+
 #include <yoga/Yoga.h>
 #include <yoga/debug/AssertFatal.h>
 #include <yoga/debug/Log.h>
@@ -47,6 +49,23 @@ float YGConfigGetPointScaleFactor(const YGConfigConstRef config) {
   return resolveRef(config)->getPointScaleFactor();
 }
 
+void YGConfigSetMaxCachedMeasurements(
+    const YGConfigRef config,
+    const size_t maxCachedMeasurements) {
+  yoga::assertFatalWithConfig(
+      resolveRef(config),
+      maxCachedMeasurements >= 1 &&
+          maxCachedMeasurements <= std::numeric_limits<uint32_t>::max(),
+      "Measurement cache should hold at least one entry");
+
+  resolveRef(config)->setMaxCachedMeasurements(
+      static_cast<uint32_t>(maxCachedMeasurements));
+}
+
+size_t YGConfigGetMaxCachedMeasurements(const YGConfigConstRef config) {
+  return resolveRef(config)->getMaxCachedMeasurements();
+}
+
 void YGConfigSetErrata(YGConfigRef config, YGErrata errata) {
   resolveRef(config)->setErrata(scopedEnum(errata));
 }
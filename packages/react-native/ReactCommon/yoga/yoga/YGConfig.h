@@ -75,6 +75,22 @@ YG_EXPORT void YGConfigSetPointScaleFactor(
  */
 YG_EXPORT float YGConfigGetPointScaleFactor(YGConfigConstRef config);
 
+/**
+ * Sets how many measurements Yoga caches per node (8 by default). Nodes which
+ * are measured under many different constraints during a single layout pass
+ * (e.g. text nested in flexible rows) may benefit from a larger cache.
+ *
+ * Must be at least 1.
+ */
+YG_EXPORT void YGConfigSetMaxCachedMeasurements(
+    YGConfigRef config,
+    size_t maxCachedMeasurements);
+
+/**
+ * Get the currently set number of measurements cached per node.
+ */
+YG_EXPORT size_t YGConfigGetMaxCachedMeasurements(YGConfigConstRef config);
+
 /**
  * Configures how Yoga balances W3C conformance vs compatibility with layouts
  * created against earlier versions of Yoga.
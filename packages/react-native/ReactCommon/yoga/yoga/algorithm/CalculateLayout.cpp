@@ -2524,7 +2524,7 @@ bool calculateLayoutInternal(
 
   if (needToVisitNode) {
     // Invalidate the cached results.
-    layout->nextCachedMeasurementsIndex = 0;
+    layout->clearCachedMeasurements();
     layout->cachedLayout.availableWidth = -1;
     layout->cachedLayout.availableHeight = -1;
     layout->cachedLayout.widthSizingMode = SizingMode::MaxContent;
@@ -2533,7 +2533,8 @@ bool calculateLayoutInternal(
     layout->cachedLayout.computedHeight = -1;
   }
 
-  CachedMeasurement* cachedResults = nullptr;
+  const CachedMeasurement* cachedResults = nullptr;
+  bool usedMeasurementCache = false;
 
   // Determine whether the results are already cached. We maintain a separate
   // cache for layouts and measurements. A layout operation modifies the
@@ -2567,23 +2568,28 @@ bool calculateLayoutInternal(
       cachedResults = &layout->cachedLayout;
     } else {
       // Try to use the measurement cache.
-      for (size_t i = 0; i < layout->nextCachedMeasurementsIndex; i++) {
+      usedMeasurementCache = true;
+      cachedResults = layout->findExactCachedMeasurement(
+          availableWidth, availableHeight, widthSizingMode, heightSizingMode);
+      for (uint32_t i = 0;
+           cachedResults == nullptr && i < layout->nextCachedMeasurementsIndex;
+           i++) {
+        const auto& cachedMeasurement = layout->cachedMeasurement(i);
         if (canUseCachedMeasurement(
                 widthSizingMode,
                 availableWidth,
                 heightSizingMode,
                 availableHeight,
-                layout->cachedMeasurements[i].widthSizingMode,
-                layout->cachedMeasurements[i].availableWidth,
-                layout->cachedMeasurements[i].heightSizingMode,
-                layout->cachedMeasurements[i].availableHeight,
-                layout->cachedMeasurements[i].computedWidth,
-                layout->cachedMeasurements[i].computedHeight,
+                cachedMeasurement.widthSizingMode,
+                cachedMeasurement.availableWidth,
+                cachedMeasurement.heightSizingMode,
+                cachedMeasurement.availableHeight,
+                cachedMeasurement.computedWidth,
+                cachedMeasurement.computedHeight,
                 marginAxisRow,
                 marginAxisColumn,
                 node->getConfig())) {
-          cachedResults = &layout->cachedMeasurements[i];
-          break;
+          cachedResults = &cachedMeasurement;
         }
       }
     }
@@ -2597,19 +2603,30 @@ bool calculateLayoutInternal(
       cachedResults = &layout->cachedLayout;
     }
   } else {
-    for (uint32_t i = 0; i < layout->nextCachedMeasurementsIndex; i++) {
+    usedMeasurementCache = true;
+    cachedResults = layout->findExactCachedMeasurement(
+        availableWidth, availableHeight, widthSizingMode, heightSizingMode);
+    for (uint32_t i = 0;
+         cachedResults == nullptr && i < layout->nextCachedMeasurementsIndex;
+         i++) {
+      const auto& cachedMeasurement = layout->cachedMeasurement(i);
       if (yoga::inexactEquals(
-              layout->cachedMeasurements[i].availableWidth, availableWidth) &&
+              cachedMeasurement.availableWidth, availableWidth) &&
           yoga::inexactEquals(
-              layout->cachedMeasurements[i].availableHeight, availableHeight) &&
-          layout->cachedMeasurements[i].widthSizingMode == widthSizingMode &&
-          layout->cachedMeasurements[i].heightSizingMode == heightSizingMode) {
-        cachedResults = &layout->cachedMeasurements[i];
-        break;
+              cachedMeasurement.availableHeight, availableHeight) &&
+          cachedMeasurement.widthSizingMode == widthSizingMode &&
+          cachedMeasurement.heightSizingMode == heightSizingMode) {
+        cachedResults = &cachedMeasurement;
       }
     }
   }
 
+  if (usedMeasurementCache) {
+    (!needToVisitNode && cachedResults != nullptr
+         ? layoutMarkerData.measureCacheHits
+         : layoutMarkerData.measureCacheMisses) += 1;
+  }
+
   if (!needToVisitNode && cachedResults != nullptr) {
     layout->setMeasuredDimension(
         Dimension::Width, cachedResults->computedWidth);
@@ -2642,30 +2659,24 @@ bool calculateLayoutInternal(
           layoutMarkerData.maxMeasureCache,
           layout->nextCachedMeasurementsIndex + 1u);
 
-      if (layout->nextCachedMeasurementsIndex ==
-          LayoutResults::MaxCachedMeasurements) {
-        layout->nextCachedMeasurementsIndex = 0;
-      }
+      const CachedMeasurement newCacheEntry{
+          .availableWidth = availableWidth,
+          .availableHeight = availableHeight,
+          .widthSizingMode = widthSizingMode,
+          .heightSizingMode = heightSizingMode,
+          .computedWidth = layout->measuredDimension(Dimension::Width),
+          .computedHeight = layout->measuredDimension(Dimension::Height),
+      };
 
-      CachedMeasurement* newCacheEntry = nullptr;
       if (performLayout) {
         // Use the single layout cache entry.
-        newCacheEntry = &layout->cachedLayout;
+        layout->cachedLayout = newCacheEntry;
       } else {
         // Allocate a new measurement cache entry.
-        newCacheEntry =
-            &layout->cachedMeasurements[layout->nextCachedMeasurementsIndex];
-        layout->nextCachedMeasurementsIndex++;
+        layoutMarkerData.measureCacheEvictions +=
+            layout->addCachedMeasurement(
+                newCacheEntry, node->getConfig()->getMaxCachedMeasurements());
       }
-
-      newCacheEntry->availableWidth = availableWidth;
-      newCacheEntry->availableHeight = availableHeight;
-      newCacheEntry->widthSizingMode = widthSizingMode;
-      newCacheEntry->heightSizingMode = heightSizingMode;
-      newCacheEntry->computedWidth =
-          layout->measuredDimension(Dimension::Width);
-      newCacheEntry->computedHeight =
-          layout->measuredDimension(Dimension::Height);
     }
   }
 
@@ -2701,7 +2712,8 @@ void calculateLayout(
     yoga::Node* const node,
     const float ownerWidth,
     const float ownerHeight,
-    const Direction ownerDirection) {
+    const Direction ownerDirection,
+    const bool roundToPixelGrid) {
   Event::publish<Event::LayoutPassStart>(node);
   LayoutData markerData = {};
 
@@ -2780,7 +2792,9 @@ void calculateLayout(
           0, // tree root
           gCurrentGenerationCount.load(std::memory_order_relaxed))) {
     node->setPosition(node->getLayout().direction(), ownerWidth, ownerHeight);
-    roundLayoutResultsToPixelGrid(node, 0.0f, 0.0f);
+    if (roundToPixelGrid) {
+      roundLayoutResultsToPixelGrid(node, 0.0f, 0.0f);
+    }
   }
 
   Event::publish<Event::LayoutPassEnd>(node, {&markerData});
@@ -14,11 +14,14 @@
 
 namespace facebook::yoga {
 
+// Pass `roundToPixelGrid = false` to lay out a subtree ahead of the layout
+// pass of its owner; the owner's pass rounds the whole tree at once.
 void calculateLayout(
     yoga::Node* node,
     float ownerWidth,
     float ownerHeight,
-    Direction ownerDirection);
+    Direction ownerDirection,
+    bool roundToPixelGrid = true);
 
 bool calculateLayoutInternal(
     yoga::Node* node,
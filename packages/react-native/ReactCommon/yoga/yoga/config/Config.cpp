@@ -85,6 +85,14 @@ float Config::getPointScaleFactor() const {
   return pointScaleFactor_;
 }
 
+void Config::setMaxCachedMeasurements(uint32_t maxCachedMeasurements) {
+  maxCachedMeasurements_ = maxCachedMeasurements;
+}
+
+uint32_t Config::getMaxCachedMeasurements() const {
+  return maxCachedMeasurements_;
+}
+
 void Config::setContext(void* context) {
   context_ = context;
 }
@@ -50,6 +50,16 @@ class YG_EXPORT Config : public ::YGConfig {
   void setPointScaleFactor(float pointScaleFactor);
   float getPointScaleFactor() const;
 
+  // Number of measurements cached per node by default. Caches of this size
+  // are held inline in each node's layout results.
+  static constexpr uint32_t DefaultMaxCachedMeasurements = 8;
+
+  // Number of measurements cached per node. Caches larger than the default
+  // spill to the heap and are indexed by their exact inputs. Takes effect on
+  // the next measurement of each node.
+  void setMaxCachedMeasurements(uint32_t maxCachedMeasurements);
+  uint32_t getMaxCachedMeasurements() const;
+
   void setContext(void* context);
   void* getContext() const;
 
@@ -78,6 +88,7 @@ class YG_EXPORT Config : public ::YGConfig {
   ExperimentalFeatureSet experimentalFeatures_{};
   Errata errata_ = Errata::MinSizeUndefinedInsteadOfAuto;
   float pointScaleFactor_ = 1.0f;
+  uint32_t maxCachedMeasurements_ = DefaultMaxCachedMeasurements;
   void* context_ = nullptr;
 };
 
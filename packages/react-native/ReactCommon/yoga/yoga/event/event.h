@@ -43,6 +43,11 @@ struct LayoutData {
   int cachedLayouts = 0;
   int cachedMeasures = 0;
   int measureCallbacks = 0;
+  // Lookups in the per-node measurement cache (excluding the layout cache),
+  // and entries dropped because a node's measurement cache was full.
+  int measureCacheHits = 0;
+  int measureCacheMisses = 0;
+  int measureCacheEvictions = 0;
   std::array<int, static_cast<uint8_t>(LayoutPassReason::COUNT)>
       measureCallbackReasonsCount;
 };
@@ -5,14 +5,151 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
 
+#include <yoga/config/Config.h>
 #include <yoga/node/LayoutResults.h>
 #include <yoga/numeric/Comparison.h>
 
 namespace facebook::yoga {
 
-bool LayoutResults::operator==(LayoutResults layout) const {
+static_assert(
+    Config::DefaultMaxCachedMeasurements ==
+        LayoutResults::MaxCachedMeasurements,
+    "The default measurement cache must fit in the inline entries");
+
+namespace {
+
+size_t hashConstraints(
+    float availableWidth,
+    float availableHeight,
+    SizingMode widthSizingMode,
+    SizingMode heightSizingMode) {
+  uint64_t hash = uint64_t{std::bit_cast<uint32_t>(availableWidth)} << 32 |
+      std::bit_cast<uint32_t>(availableHeight);
+  hash ^= static_cast<uint64_t>(
+      yoga::to_underlying(widthSizingMode) << 2 |
+      yoga::to_underlying(heightSizingMode));
+  hash *= 0xff51afd7ed558ccdULL;
+  return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+// Constraints are compared bitwise so that undefined (NaN) sizes match.
+bool hasSameConstraints(
+    const CachedMeasurement& measurement,
+    float availableWidth,
+    float availableHeight,
+    SizingMode widthSizingMode,
+    SizingMode heightSizingMode) {
+  return std::bit_cast<uint32_t>(measurement.availableWidth) ==
+      std::bit_cast<uint32_t>(availableWidth) &&
+      std::bit_cast<uint32_t>(measurement.availableHeight) ==
+      std::bit_cast<uint32_t>(availableHeight) &&
+      measurement.widthSizingMode == widthSizingMode &&
+      measurement.heightSizingMode == heightSizingMode;
+}
+
+void insertIntoIndex(
+    std::vector<uint32_t>& index,
+    const CachedMeasurement& measurement,
+    uint32_t entryIndex) {
+  const size_t mask = index.size() - 1;
+  size_t slot = hashConstraints(
+                    measurement.availableWidth,
+                    measurement.availableHeight,
+                    measurement.widthSizingMode,
+                    measurement.heightSizingMode) &
+      mask;
+  while (index[slot] != 0) {
+    slot = (slot + 1) & mask;
+  }
+  index[slot] = entryIndex + 1;
+}
+
+} // namespace
+
+const CachedMeasurement* LayoutResults::findExactCachedMeasurement(
+    float availableWidth,
+    float availableHeight,
+    SizingMode widthSizingMode,
+    SizingMode heightSizingMode) const {
+  if (!spill_ || spill_->index.empty()) {
+    return nullptr;
+  }
+
+  const auto& index = spill_->index;
+  const size_t mask = index.size() - 1;
+  size_t slot = hashConstraints(
+                    availableWidth,
+                    availableHeight,
+                    widthSizingMode,
+                    heightSizingMode) &
+      mask;
+  while (index[slot] != 0) {
+    const auto& measurement = cachedMeasurement(index[slot] - 1);
+    if (hasSameConstraints(
+            measurement,
+            availableWidth,
+            availableHeight,
+            widthSizingMode,
+            heightSizingMode)) {
+      return &measurement;
+    }
+    slot = (slot + 1) & mask;
+  }
+  return nullptr;
+}
+
+uint32_t LayoutResults::addCachedMeasurement(
+    const CachedMeasurement& measurement,
+    uint32_t maxCachedMeasurements) {
+  uint32_t evictedCount = 0;
+  if (nextCachedMeasurementsIndex >= maxCachedMeasurements) {
+    evictedCount = nextCachedMeasurementsIndex;
+    clearCachedMeasurements();
+  }
+
+  const uint32_t entryIndex = nextCachedMeasurementsIndex++;
+  if (maxCachedMeasurements > MaxCachedMeasurements && !spill_) {
+    spill_ = std::make_unique<CachedMeasurementsSpill>();
+  }
+
+  if (entryIndex < MaxCachedMeasurements) {
+    cachedMeasurements[entryIndex] = measurement;
+  } else if (entryIndex - MaxCachedMeasurements < spill_->entries.size()) {
+    spill_->entries[entryIndex - MaxCachedMeasurements] = measurement;
+  } else {
+    spill_->entries.push_back(measurement);
+  }
+
+  if (maxCachedMeasurements <= MaxCachedMeasurements) {
+    // A linear scan over the inline entries is fast enough. The config may
+    // have shrunk since the spill storage was allocated.
+    spill_.reset();
+  } else if (spill_->index.size() < 2 * maxCachedMeasurements) {
+    // Keep the load factor at or below one half. The config may have grown
+    // since the index was built, so rebuild it from scratch.
+    spill_->index.assign(std::bit_ceil(size_t{2} * maxCachedMeasurements), 0);
+    for (uint32_t i = 0; i < nextCachedMeasurementsIndex; i++) {
+      insertIntoIndex(spill_->index, cachedMeasurement(i), i);
+    }
+  } else {
+    insertIntoIndex(spill_->index, measurement, entryIndex);
+  }
+
+  return evictedCount;
+}
+
+void LayoutResults::clearCachedMeasurements() {
+  nextCachedMeasurementsIndex = 0;
+  if (spill_) {
+    std::fill(spill_->index.begin(), spill_->index.end(), 0);
+  }
+}
+
+bool LayoutResults::operator==(const LayoutResults& layout) const {
   bool isEqual = yoga::inexactEquals(position_, layout.position_) &&
       yoga::inexactEquals(dimensions_, layout.dimensions_) &&
       yoga::inexactEquals(margin_, layout.margin_) &&
@@ -30,6 +167,11 @@ bool LayoutResults::operator==(LayoutResults layout) const {
        ++i) {
     isEqual = isEqual && cachedMeasurements[i] == layout.cachedMeasurements[i];
   }
+  for (uint32_t i = LayoutResults::MaxCachedMeasurements;
+       i < nextCachedMeasurementsIndex && isEqual;
+       ++i) {
+    isEqual = cachedMeasurement(i) == layout.cachedMeasurement(i);
+  }
 
   if (!yoga::isUndefined(measuredDimensions_[0]) ||
       !yoga::isUndefined(layout.measuredDimensions_[0])) {
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <array>
+#include <memory>
+#include <vector>
 
 #include <yoga/debug/AssertFatal.h>
 #include <yoga/enums/Dimension.h>
@@ -46,6 +48,32 @@ struct LayoutResults {
 
   CachedMeasurement cachedLayout{};
 
+  // Returns the entry at `index`, which must be below
+  // `nextCachedMeasurementsIndex`. Entries past `MaxCachedMeasurements` only
+  // exist when the config asks for a larger cache.
+  const CachedMeasurement& cachedMeasurement(uint32_t index) const {
+    return index < MaxCachedMeasurements
+        ? cachedMeasurements[index]
+        : spill_->entries[index - MaxCachedMeasurements];
+  }
+
+  // Returns the entry measured under exactly the given constraints, or nullptr.
+  // Only caches larger than `MaxCachedMeasurements` are indexed; a nullptr
+  // result does not rule out an entry which is close enough to be reused.
+  const CachedMeasurement* findExactCachedMeasurement(
+      float availableWidth,
+      float availableHeight,
+      SizingMode widthSizingMode,
+      SizingMode heightSizingMode) const;
+
+  // Stores a new entry, emptying the cache first when it already holds
+  // `maxCachedMeasurements` entries. Returns the number of evicted entries.
+  uint32_t addCachedMeasurement(
+      const CachedMeasurement& measurement,
+      uint32_t maxCachedMeasurements);
+
+  void clearCachedMeasurements();
+
   Direction direction() const {
     return direction_;
   }
@@ -118,7 +146,7 @@ struct LayoutResults {
     padding_[yoga::to_underlying(physicalEdge)] = dimension;
   }
 
-  bool operator==(LayoutResults layout) const;
+  bool operator==(const LayoutResults& layout) const;
 
  private:
   Direction direction_ : bitCount<Direction>() = Direction::Inherit;
@@ -131,6 +159,44 @@ struct LayoutResults {
   std::array<float, 4> margin_ = {};
   std::array<float, 4> border_ = {};
   std::array<float, 4> padding_ = {};
+
+  // Storage for caches larger than `MaxCachedMeasurements`. Only allocated
+  // when the config asks for one, so that the default cache costs a single
+  // pointer per node and nothing to copy.
+  struct CachedMeasurementsSpill {
+    std::vector<CachedMeasurement> entries;
+    // Open addressing hash table of `index + 1` of cached measurements (0
+    // marks an empty slot), keyed by their exact constraints.
+    std::vector<uint32_t> index;
+  };
+
+  // Owns the spill storage, and deep-copies it so that LayoutResults stays
+  // copyable.
+  struct CachedMeasurementsSpillPtr
+      : std::unique_ptr<CachedMeasurementsSpill> {
+    using std::unique_ptr<CachedMeasurementsSpill>::operator=;
+
+    CachedMeasurementsSpillPtr() = default;
+    CachedMeasurementsSpillPtr(const CachedMeasurementsSpillPtr& other)
+        : std::unique_ptr<CachedMeasurementsSpill>(
+              other ? std::make_unique<CachedMeasurementsSpill>(*other)
+                    : nullptr) {}
+    CachedMeasurementsSpillPtr(CachedMeasurementsSpillPtr&&) noexcept =
+        default;
+    CachedMeasurementsSpillPtr& operator=(
+        const CachedMeasurementsSpillPtr& other) {
+      if (this != &other) {
+        reset(
+            other ? std::make_unique<CachedMeasurementsSpill>(*other).release()
+                  : nullptr);
+      }
+      return *this;
+    }
+    CachedMeasurementsSpillPtr& operator=(
+        CachedMeasurementsSpillPtr&&) noexcept = default;
+    ~CachedMeasurementsSpillPtr() = default;
+  };
+  CachedMeasurementsSpillPtr spill_;
 };
 
 } // namespace facebook::yoga
@@ -8,9 +8,59 @@
 #include "NetworkingModule.h"
 
 #include <react/debug/react_native_assert.h>
+#include <string_view>
 
 namespace facebook::react {
 
+namespace {
+
+// Response type XMLHttpRequest requests for "arraybuffer" responses. Platform
+// modules encode those bodies as base64 strings, which XMLHttpRequest decodes
+// into an ArrayBuffer; this module delivers the ArrayBuffer directly instead.
+constexpr std::string_view kArrayBufferResponseType = "base64";
+
+// Response body handed over to the JS thread. Its memory backs the JS string
+// or ArrayBuffer created from it, so the body isn't copied into an
+// intermediate std::string. Both need contiguous memory: a body received as a
+// single buffer is used as is, while a chained one is copied once, on the
+// network thread, by coalescing it.
+class ResponseData final : public jsi::MutableBuffer {
+ public:
+  ResponseData(std::unique_ptr<folly::IOBuf> buf, bool isArrayBuffer)
+      : buf_(std::move(buf)), isArrayBuffer_(isArrayBuffer) {
+    buf_->coalesce();
+    if (isArrayBuffer_ && buf_->isShared()) {
+      // ArrayBuffers are writable from JS, so they must not alias memory
+      // owned by other IOBufs.
+      buf_->unshare();
+    }
+  }
+
+  size_t size() const override {
+    return buf_->length();
+  }
+
+  uint8_t* data() override {
+    return buf_->writableData();
+  }
+
+  static jsi::Value toJs(
+      jsi::Runtime& rt,
+      const std::shared_ptr<ResponseData>& responseData) {
+    if (responseData->isArrayBuffer_) {
+      return jsi::ArrayBuffer(rt, responseData);
+    }
+    return jsi::String::createFromUtf8(
+        rt, responseData->buf_->data(), responseData->buf_->length());
+  }
+
+ private:
+  std::unique_ptr<folly::IOBuf> buf_;
+  bool isArrayBuffer_;
+};
+
+} // namespace
+
 // The requests abstraction is here to deal with a family of race conditions
 // which can happen due to the async nature of this code:
 //
@@ -133,6 +183,8 @@ void NetworkingModule::sendRequest(
     return;
   }
 
+  // Incremental chunks are strings that XMLHttpRequest concatenates, so they
+  // are only sent for text responses.
   bool sendIncrementalUpdates = responseType == "text" && useIncrementalUpdates;
   bool sendProgressUpdates = responseType != "text" && useIncrementalUpdates;
 
@@ -252,18 +304,19 @@ int64_t NetworkingModule::didReceiveNetworkIncrementalData(
     std::unique_ptr<folly::IOBuf> buf,
     int64_t progress,
     int64_t total) {
-  auto data = buf->moveToFbString().toStdString();
-  auto bytesRead = data.size();
+  auto data =
+      std::make_shared<ResponseData>(std::move(buf), /*isArrayBuffer*/ false);
+  auto bytesRead = static_cast<int64_t>(data->size());
   emitDeviceEvent(
       "didReceiveNetworkIncrementalData",
-      [requestId, data, progress, total, jsInvoker = jsInvoker_](
+      [requestId, data = std::move(data), progress, total](
           jsi::Runtime& rt, std::vector<jsi::Value>& args) {
         args.emplace_back(
             rt,
             jsi::Array::createWithElements(
                 rt,
                 static_cast<double>(requestId),
-                data,
+                ResponseData::toJs(rt, data),
                 static_cast<double>(progress),
                 static_cast<double>(total)));
       });
@@ -272,23 +325,24 @@ int64_t NetworkingModule::didReceiveNetworkIncrementalData(
 
 void NetworkingModule::didReceiveNetworkData(
     uint32_t requestId,
-    const std::string& /*responseType*/,
+    const std::string& responseType,
     std::unique_ptr<folly::IOBuf> buf) {
   if (requests_.isStopped()) {
     return;
   }
 
-  auto responseData = buf->toString();
+  auto responseData = std::make_shared<ResponseData>(
+      std::move(buf), responseType == kArrayBufferResponseType);
   emitDeviceEvent(
       "didReceiveNetworkData",
-      [requestId,
-       responseData = std::move(responseData),
-       jsInvoker = jsInvoker_](
+      [requestId, responseData = std::move(responseData)](
           jsi::Runtime& rt, std::vector<jsi::Value>& args) {
         args.emplace_back(
             rt,
             jsi::Array::createWithElements(
-                rt, static_cast<double>(requestId), responseData));
+                rt,
+                static_cast<double>(requestId),
+                ResponseData::toJs(rt, responseData)));
       });
 }
 
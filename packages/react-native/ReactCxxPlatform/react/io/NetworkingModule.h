@@ -72,6 +72,13 @@ class NetworkingModule : public NativeNetworkingAndroidCxxSpec<NetworkingModule>
 
   ~NetworkingModule() override;
 
+  /*
+   * Unlike the platform modules, `"base64"` delivers the response body as an
+   * ArrayBuffer rather than a base64 string, backed by the buffer received
+   * from the `IHttpClient` (copied only if it is chained or shared).
+   * With `useIncrementalUpdates`, only `"text"` responses are delivered in
+   * chunks; other types report progress.
+   */
   void sendRequest(
       jsi::Runtime &rt,
       const std::string &method,
@@ -21,6 +21,39 @@
 
 namespace facebook::react {
 
+namespace {
+
+// Records the callbacks of the last request, for the test to invoke them.
+class StubHttpClient : public IHttpClient {
+ public:
+  std::unique_ptr<http::IRequestToken> sendRequest(
+      http::NetworkCallbacks&& callbacks,
+      const std::string& /*method*/,
+      const std::string& /*url*/,
+      const http::Headers& /*headers*/,
+      const http::Body& /*body*/,
+      uint32_t /*timeout*/,
+      std::optional<std::string> /*loggingId*/) override {
+    callbacks_ = std::move(callbacks);
+    return nullptr;
+  }
+
+  http::NetworkCallbacks callbacks_;
+};
+
+struct ReceivedArrayBuffer {
+  std::string eventName;
+  const uint8_t* data;
+  std::string content;
+};
+
+struct ReceivedString {
+  std::string eventName;
+  std::string content;
+};
+
+} // namespace
+
 class NetworkingModuleTests : public testing::Test {
  protected:
   void SetUp() override {
@@ -28,6 +61,50 @@ class NetworkingModuleTests : public testing::Test {
     jsInvoker_ = std::make_shared<TestCallInvoker>(*rt_);
   }
 
+  std::shared_ptr<NetworkingModule> createNetworkingModule() {
+    return std::make_shared<NetworkingModule>(jsInvoker_, [this]() {
+      auto httpClient = std::make_unique<StubHttpClient>();
+      httpClient_ = httpClient.get();
+      return httpClient;
+    });
+  }
+
+  // Installs a device event emitter recording the ArrayBuffers and strings
+  // passed as the second element of the event payloads.
+  void installDeviceEventEmitter() {
+    auto emitter = jsi::Object(*rt_);
+    emitter.setProperty(
+        *rt_,
+        "emit",
+        jsi::Function::createFromHostFunction(
+            *rt_,
+            jsi::PropNameID::forAscii(*rt_, "emit"),
+            2,
+            [this](
+                jsi::Runtime& rt,
+                const jsi::Value& /*thisValue*/,
+                const jsi::Value* args,
+                size_t /*count*/) {
+              auto payload = args[1].getObject(rt).getArray(rt);
+              auto value = payload.getValueAtIndex(rt, 1);
+              if (value.isObject() && value.getObject(rt).isArrayBuffer(rt)) {
+                auto buffer = value.getObject(rt).getArrayBuffer(rt);
+                receivedArrayBuffers_.push_back(
+                    {.eventName = args[0].getString(rt).utf8(rt),
+                     .data = buffer.data(rt),
+                     .content = std::string(
+                         reinterpret_cast<const char*>(buffer.data(rt)),
+                         buffer.size(rt))});
+              } else if (value.isString()) {
+                receivedStrings_.push_back(
+                    {.eventName = args[0].getString(rt).utf8(rt),
+                     .content = value.getString(rt).utf8(rt)});
+              }
+              return jsi::Value::undefined();
+            }));
+    rt_->global().setProperty(*rt_, "__rctDeviceEventEmitter", emitter);
+  }
+
   static void verifyFormData(
       const http::FormDataField& formData,
       const std::string& fieldName,
@@ -42,7 +119,10 @@ class NetworkingModuleTests : public testing::Test {
   }
 
   std::shared_ptr<facebook::hermes::HermesRuntime> rt_;
-  std::shared_ptr<CallInvoker> jsInvoker_;
+  std::shared_ptr<TestCallInvoker> jsInvoker_;
+  StubHttpClient* httpClient_{nullptr};
+  std::vector<ReceivedArrayBuffer> receivedArrayBuffers_;
+  std::vector<ReceivedString> receivedStrings_;
 };
 
 // Test parsing a body with form data
@@ -109,4 +189,107 @@ TEST_F(NetworkingModuleTests, stringDataTest) {
   EXPECT_EQ(stringData, "testString");
 }
 
+// Test delivering "base64" response bodies as ArrayBuffers
+TEST_F(NetworkingModuleTests, arrayBufferResponseTest) {
+  installDeviceEventEmitter();
+  auto networkingModule = createNetworkingModule();
+  networkingModule->sendRequest(
+      *rt_,
+      "GET",
+      "https://example.com",
+      /*requestId*/ 1,
+      /*headers*/ {},
+      /*body*/ {},
+      "base64",
+      /*useIncrementalUpdates*/ false,
+      /*timeout*/ 0,
+      /*withCredentials*/ false);
+  EXPECT_FALSE(httpClient_->callbacks_.sendIncrementalUpdates);
+
+  auto body = folly::IOBuf::copyBuffer("response body");
+  const auto* bodyData = body->data();
+  httpClient_->callbacks_.onBody(std::move(body));
+  jsInvoker_->flushQueue();
+
+  ASSERT_EQ(receivedArrayBuffers_.size(), 1);
+  EXPECT_EQ(receivedArrayBuffers_[0].eventName, "didReceiveNetworkData");
+  EXPECT_EQ(receivedArrayBuffers_[0].content, "response body");
+  // The ArrayBuffer references the received buffer instead of a copy.
+  EXPECT_EQ(receivedArrayBuffers_[0].data, bodyData);
+}
+
+// Test delivering a chained body as a single ArrayBuffer
+TEST_F(NetworkingModuleTests, arrayBufferChainedResponseTest) {
+  installDeviceEventEmitter();
+  auto networkingModule = createNetworkingModule();
+  networkingModule->sendRequest(
+      *rt_,
+      "GET",
+      "https://example.com",
+      /*requestId*/ 1,
+      /*headers*/ {},
+      /*body*/ {},
+      "base64",
+      /*useIncrementalUpdates*/ false,
+      /*timeout*/ 0,
+      /*withCredentials*/ false);
+
+  auto body = folly::IOBuf::copyBuffer("response ");
+  body->appendToChain(folly::IOBuf::copyBuffer("body"));
+  httpClient_->callbacks_.onBody(std::move(body));
+  jsInvoker_->flushQueue();
+
+  ASSERT_EQ(receivedArrayBuffers_.size(), 1);
+  EXPECT_EQ(receivedArrayBuffers_[0].content, "response body");
+}
+
+// Test that incremental updates of ArrayBuffer responses only report progress
+TEST_F(NetworkingModuleTests, arrayBufferIncrementalUpdatesTest) {
+  auto networkingModule = createNetworkingModule();
+  networkingModule->sendRequest(
+      *rt_,
+      "GET",
+      "https://example.com",
+      /*requestId*/ 1,
+      /*headers*/ {},
+      /*body*/ {},
+      "base64",
+      /*useIncrementalUpdates*/ true,
+      /*timeout*/ 0,
+      /*withCredentials*/ false);
+  EXPECT_FALSE(httpClient_->callbacks_.sendIncrementalUpdates);
+  EXPECT_TRUE(httpClient_->callbacks_.sendProgressUpdates);
+}
+
+// Test delivering incremental chunks of text responses as strings
+TEST_F(NetworkingModuleTests, textIncrementalResponseTest) {
+  installDeviceEventEmitter();
+  auto networkingModule = createNetworkingModule();
+  networkingModule->sendRequest(
+      *rt_,
+      "GET",
+      "https://example.com",
+      /*requestId*/ 1,
+      /*headers*/ {},
+      /*body*/ {},
+      "text",
+      /*useIncrementalUpdates*/ true,
+      /*timeout*/ 0,
+      /*withCredentials*/ false);
+  EXPECT_TRUE(httpClient_->callbacks_.sendIncrementalUpdates);
+  EXPECT_FALSE(httpClient_->callbacks_.sendProgressUpdates);
+
+  auto chunk = folly::IOBuf::copyBuffer("first ");
+  chunk->appendToChain(folly::IOBuf::copyBuffer("chunk"));
+  auto bytesRead =
+      httpClient_->callbacks_.onBodyIncremental(11, 20, std::move(chunk));
+  EXPECT_EQ(bytesRead, 11);
+  jsInvoker_->flushQueue();
+
+  EXPECT_TRUE(receivedArrayBuffers_.empty());
+  ASSERT_EQ(receivedStrings_.size(), 1);
+  EXPECT_EQ(receivedStrings_[0].eventName, "didReceiveNetworkIncrementalData");
+  EXPECT_EQ(receivedStrings_[0].content, "first chunk");
+}
+
 } // namespace facebook::react
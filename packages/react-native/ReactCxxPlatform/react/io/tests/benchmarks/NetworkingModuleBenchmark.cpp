@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <ReactCommon/TestCallInvoker.h>
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <react/io/NetworkingModule.h>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kChunkSize = 64 * 1024;
+
+// Serves `payloadSize` bytes, split in 64KB buffers, to every request.
+class StubHttpClient : public IHttpClient {
+ public:
+  explicit StubHttpClient(size_t payloadSize) : payloadSize_(payloadSize) {}
+
+  std::unique_ptr<http::IRequestToken> sendRequest(
+      http::NetworkCallbacks&& callbacks,
+      const std::string& /*method*/,
+      const std::string& /*url*/,
+      const http::Headers& /*headers*/,
+      const http::Body& /*body*/,
+      uint32_t /*timeout*/,
+      std::optional<std::string> /*loggingId*/) override {
+    callbacks.onResponse(200, {});
+    auto body = std::unique_ptr<folly::IOBuf>{};
+    for (size_t offset = 0; offset < payloadSize_; offset += kChunkSize) {
+      auto chunk =
+          folly::IOBuf::create(std::min(kChunkSize, payloadSize_ - offset));
+      std::memset(chunk->writableData(), 'a', chunk->capacity());
+      chunk->append(chunk->capacity());
+      if (body) {
+        body->appendToChain(std::move(chunk));
+      } else {
+        body = std::move(chunk);
+      }
+    }
+    callbacks.onBody(std::move(body));
+    callbacks.onResponseComplete("", false);
+    return nullptr;
+  }
+
+ private:
+  size_t payloadSize_;
+};
+
+void receiveResponse(benchmark::State& state, const std::string& responseType) {
+  auto payloadSize = static_cast<size_t>(state.range(0)) * 1024 * 1024;
+  auto runtime = hermes::makeHermesRuntime();
+  auto jsInvoker = std::make_shared<TestCallInvoker>(*runtime);
+  runtime->evaluateJavaScript(
+      std::make_shared<jsi::StringBuffer>(
+          "globalThis.__rctDeviceEventEmitter = {emit() {}};"),
+      "");
+  auto networkingModule =
+      std::make_shared<NetworkingModule>(jsInvoker, [payloadSize]() {
+        return std::make_unique<StubHttpClient>(payloadSize);
+      });
+
+  uint32_t requestId = 0;
+  for (auto _ : state) {
+    networkingModule->sendRequest(
+        *runtime,
+        "GET",
+        "https://example.com",
+        requestId++,
+        /*headers*/ {},
+        /*body*/ {},
+        responseType,
+        /*useIncrementalUpdates*/ false,
+        /*timeout*/ 0,
+        /*withCredentials*/ false);
+    jsInvoker->flushQueue();
+  }
+  state.SetBytesProcessed(
+      static_cast<int64_t>(state.iterations() * payloadSize));
+}
+
+} // namespace
+
+static void textResponse(benchmark::State& state) {
+  receiveResponse(state, "text");
+}
+BENCHMARK(textResponse)->Arg(1)->Arg(8)->Arg(32);
+
+static void arrayBufferResponse(benchmark::State& state) {
+  receiveResponse(state, "arraybuffer");
+}
+BENCHMARK(arrayBufferResponse)->Arg(1)->Arg(8)->Arg(32);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -86,6 +86,11 @@ export interface Spec extends TurboModule {
     includeTransform: boolean,
   ) => ReadonlyArray<number> /* [x: number, y: number, width: number, height: number] */;
 
+  readonly getBoundingClientRects?: (
+    nativeElementReferences: ReadonlyArray<unknown> /* ReadonlyArray<NativeElementReference> */,
+    includeTransform: boolean,
+  ) => unknown /* Float64Array */;
+
   readonly getInnerSize: (
     nativeElementReference: unknown /* NativeElementReference */,
   ) => ReadonlyArray<number> /* [width: number, height: number] */;
@@ -281,6 +286,19 @@ export interface RefinedSpec {
     ],
   >;
 
+  /**
+   * Batched version of `getBoundingClientRect`, to measure many nodes at once
+   * (e.g.: all the visible cells of a list).
+   *
+   * The nodes of each surface are measured against the same revision of its
+   * shadow tree, in a single pass over it. The result contains `x`, `y`,
+   * `width` and `height` for each node, in order.
+   */
+  readonly getBoundingClientRects?: (
+    nativeElementReferences: ReadonlyArray<NativeElementReference>,
+    includeTransform: boolean,
+  ) => Float64Array;
+
   /**
    * This is a method to access the inner size of a shadow node, to implement
    * these methods: